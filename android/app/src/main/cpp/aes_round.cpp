@@ -0,0 +1,318 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * AES Round - Hardware and Table-Based AES Rounds with Measured Selection
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#include "aes_round.h"
+#include "trading_anarchy_jni.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <limits>
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace TradingAnarchy {
+namespace AesRound {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t kStateBytes = kLanes * kBlockBytes;
+constexpr size_t kKeyBytes = kRounds * kBlockBytes;
+
+// A timed pass is about 80k block-rounds: under a millisecond even for soft AES
+constexpr size_t kMeasureIterations = 1024;
+constexpr int kMeasureRepeats = 5;
+
+std::atomic<const Selection*> g_cached{nullptr};
+
+constexpr uint8_t kSbox[256] = {
+    0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
+    0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0, 0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0,
+    0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+    0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75,
+    0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0, 0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84,
+    0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+    0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8,
+    0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5, 0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2,
+    0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+    0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb,
+    0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c, 0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79,
+    0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+    0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a,
+    0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e, 0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e,
+    0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+    0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16,
+};
+
+constexpr uint8_t xtime(uint8_t x) {
+    return static_cast<uint8_t>((x << 1) ^ ((x & 0x80) ? 0x1b : 0x00));
+}
+
+/**
+ * Professional T-table - SubBytes and one MixColumns column fused per byte
+ *
+ * kTable[k][x] is the column contributed by input row k: the little-endian
+ * word (2s, s, s, 3s) for s = S(x), rotated left by 8k bits.
+ */
+constexpr std::array<std::array<uint32_t, 256>, 4> makeTables() {
+    std::array<std::array<uint32_t, 256>, 4> tables{};
+    for (uint32_t x = 0; x < 256; ++x) {
+        uint32_t s = kSbox[x];
+        uint32_t s2 = xtime(static_cast<uint8_t>(s));
+        uint32_t word = s2 | (s << 8) | (s << 16) | ((s2 ^ s) << 24);
+        for (int k = 0; k < 4; ++k) {
+            tables[k][x] = k == 0 ? word : (word << (8 * k)) | (word >> (32 - 8 * k));
+        }
+    }
+    return tables;
+}
+
+constexpr auto kTables = makeTables();
+
+inline uint32_t load32(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline void store32(uint8_t* p, uint32_t v) {
+    std::memcpy(p, &v, sizeof(v));
+}
+
+/**
+ * Enhanced soft round on four little-endian column words
+ *
+ * ShiftRows is folded into the byte picks: output column c takes row r
+ * from input column c + r.
+ */
+[[gnu::always_inline]] inline void softRound(uint32_t w[4], const uint32_t k[4]) {
+    uint32_t out[4];
+    for (int c = 0; c < 4; ++c) {
+        out[c] = kTables[0][w[c] & 0xff] ^
+                 kTables[1][(w[(c + 1) & 3] >> 8) & 0xff] ^
+                 kTables[2][(w[(c + 2) & 3] >> 16) & 0xff] ^
+                 kTables[3][w[(c + 3) & 3] >> 24] ^ k[c];
+    }
+    std::memcpy(w, out, sizeof(out));
+}
+
+void roundsSoft(uint8_t* blocks, const uint8_t* keys, size_t iterations) {
+    uint32_t k[kRounds][4];
+    uint32_t w[kLanes][4];
+    for (size_t r = 0; r < kRounds; ++r) {
+        for (int c = 0; c < 4; ++c) {
+            k[r][c] = load32(keys + r * kBlockBytes + 4 * c);
+        }
+    }
+    for (size_t lane = 0; lane < kLanes; ++lane) {
+        for (int c = 0; c < 4; ++c) {
+            w[lane][c] = load32(blocks + lane * kBlockBytes + 4 * c);
+        }
+    }
+
+    for (size_t i = 0; i < iterations; ++i) {
+        for (size_t r = 0; r < kRounds; ++r) {
+            for (size_t lane = 0; lane < kLanes; ++lane) {
+                softRound(w[lane], k[r]);
+            }
+        }
+    }
+
+    for (size_t lane = 0; lane < kLanes; ++lane) {
+        for (int c = 0; c < 4; ++c) {
+            store32(blocks + lane * kBlockBytes + 4 * c, w[lane][c]);
+        }
+    }
+}
+
+#if defined(__aarch64__)
+// AESE with a zero key is SubBytes + ShiftRows; AESMC and an EOR finish the round
+[[gnu::target("arch=armv8-a+aes")]]
+void roundsArmv8(uint8_t* blocks, const uint8_t* keys, size_t iterations) {
+    const uint8x16_t zero = vdupq_n_u8(0);
+    uint8x16_t k[kRounds];
+    uint8x16_t x[kLanes];
+    for (size_t r = 0; r < kRounds; ++r) {
+        k[r] = vld1q_u8(keys + r * kBlockBytes);
+    }
+    for (size_t lane = 0; lane < kLanes; ++lane) {
+        x[lane] = vld1q_u8(blocks + lane * kBlockBytes);
+    }
+
+    for (size_t i = 0; i < iterations; ++i) {
+        for (size_t r = 0; r < kRounds; ++r) {
+            for (size_t lane = 0; lane < kLanes; ++lane) {
+                x[lane] = veorq_u8(vaesmcq_u8(vaeseq_u8(x[lane], zero)), k[r]);
+            }
+        }
+    }
+
+    for (size_t lane = 0; lane < kLanes; ++lane) {
+        vst1q_u8(blocks + lane * kBlockBytes, x[lane]);
+    }
+}
+#endif
+
+#if defined(__x86_64__)
+[[gnu::target("aes,sse2")]]
+void roundsAesNi(uint8_t* blocks, const uint8_t* keys, size_t iterations) {
+    __m128i k[kRounds];
+    __m128i x[kLanes];
+    for (size_t r = 0; r < kRounds; ++r) {
+        k[r] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + r * kBlockBytes));
+    }
+    for (size_t lane = 0; lane < kLanes; ++lane) {
+        x[lane] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(blocks + lane * kBlockBytes));
+    }
+
+    for (size_t i = 0; i < iterations; ++i) {
+        for (size_t r = 0; r < kRounds; ++r) {
+            for (size_t lane = 0; lane < kLanes; ++lane) {
+                x[lane] = _mm_aesenc_si128(x[lane], k[r]);
+            }
+        }
+    }
+
+    for (size_t lane = 0; lane < kLanes; ++lane) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(blocks + lane * kBlockBytes), x[lane]);
+    }
+}
+#endif
+
+void seed(uint8_t* bytes, size_t length, uint8_t start) {
+    for (size_t i = 0; i < length; ++i) {
+        bytes[i] = static_cast<uint8_t>(start + 7 * i);
+    }
+}
+
+/**
+ * Professional best-of-N timing of one variant, in ns per block-round
+ */
+double measure(RoundsFn rounds) {
+    uint8_t blocks[kStateBytes];
+    uint8_t keys[kKeyBytes];
+    seed(blocks, sizeof(blocks), 1);
+    seed(keys, sizeof(keys), 2);
+
+    // Untimed pass warms the tables and wakes the crypto unit
+    rounds(blocks, keys, kMeasureIterations / 4);
+
+    double best = std::numeric_limits<double>::infinity();
+    for (int repeat = 0; repeat < kMeasureRepeats; ++repeat) {
+        auto start = Clock::now();
+        rounds(blocks, keys, kMeasureIterations);
+        best = std::min(best, std::chrono::duration<double, std::nano>(Clock::now() - start).count());
+    }
+    return best / static_cast<double>(kMeasureIterations * kLanes * kRounds);
+}
+
+Selection measureAndBind() {
+    KernelDispatch<RoundsFn>& dispatch = roundsKernel();
+    Selection result;
+    result.hardware_supported = cpuFeatures().has(CPU_AES);
+
+    std::string fastest;
+    double fastest_ns = std::numeric_limits<double>::infinity();
+    for (const KernelDispatchBase::VariantInfo& variant : dispatch.variants()) {
+        if (!variant.supported || !dispatch.force(variant.name)) {
+            continue;
+        }
+        double ns = measure(dispatch.get());
+        if (variant.required_features & CPU_AES) {
+            if (result.hardware_ns_per_round == 0.0 || ns < result.hardware_ns_per_round) {
+                result.hardware_ns_per_round = ns;
+            }
+        } else {
+            result.soft_ns_per_round = ns;
+        }
+        if (ns < fastest_ns) {
+            fastest_ns = ns;
+            fastest = variant.name;
+        }
+    }
+
+    dispatch.force(fastest.c_str());
+    result.variant = dispatch.selectedVariant();
+    result.hardware_preferred = result.hardware_ns_per_round > 0.0 &&
+                                result.hardware_ns_per_round < result.soft_ns_per_round;
+
+    if (result.hardware_supported && !result.hardware_preferred) {
+        TA_LOGW("Hardware AES slower than soft AES (%.2f vs %.2f ns/round); using soft AES",
+                result.hardware_ns_per_round, result.soft_ns_per_round);
+    }
+    TA_LOGI("AES round: %s selected, hardware %.2f ns/round, soft %.2f ns/round",
+            result.variant.c_str(), result.hardware_ns_per_round, result.soft_ns_per_round);
+    return result;
+}
+
+// Resolve at load time rather than on the first round
+[[maybe_unused]] const KernelDispatchBase& kLoadTimeResolution = roundsKernel();
+
+} // namespace
+
+void encryptRounds(uint8_t blocks[kLanes * kBlockBytes], const uint8_t keys[kRounds * kBlockBytes],
+                   size_t iterations) {
+    roundsKernel().get()(blocks, keys, iterations);
+}
+
+const Selection& selection() {
+    static const Selection measured = measureAndBind();
+    g_cached.store(&measured, std::memory_order_release);
+    return measured;
+}
+
+const Selection* cachedSelection() {
+    return g_cached.load(std::memory_order_acquire);
+}
+
+KernelDispatch<RoundsFn>& roundsKernel() {
+    static KernelDispatch<RoundsFn> dispatch("aes-round", {
+#if defined(__aarch64__)
+        {"armv8-aes", CPU_NEON | CPU_AES, roundsArmv8},
+#endif
+#if defined(__x86_64__)
+        {"aes-ni", CPU_AES, roundsAesNi},
+#endif
+        {"soft", 0, roundsSoft},
+    });
+
+    static const bool workload_installed = [] {
+        dispatch.setWorkload([](size_t iterations) {
+            uint8_t blocks[kStateBytes];
+            uint8_t keys[kKeyBytes];
+            seed(blocks, sizeof(blocks), 1);
+            seed(keys, sizeof(keys), 2);
+            encryptRounds(blocks, keys, iterations);
+            uint64_t checksum = 0;
+            for (size_t offset = 0; offset < sizeof(blocks); offset += sizeof(checksum)) {
+                uint64_t word;
+                std::memcpy(&word, blocks + offset, sizeof(word));
+                checksum ^= word;
+            }
+            return checksum;
+        });
+        return true;
+    }();
+    (void)workload_installed;
+
+    return dispatch;
+}
+
+} // namespace AesRound
+} // namespace TradingAnarchy
@@ -0,0 +1,279 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Bench Stats - Summary Statistics and Significance Tests for Benchmarks
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#include "bench_stats.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace TradingAnarchy {
+namespace BenchStats {
+
+namespace {
+
+constexpr int kMaxIterations = 200;
+constexpr double kEpsilon = 1e-14;
+constexpr size_t kExactMannWhitneyLimit = 40;    // n_a + n_b; C(40, 20) is exact in a double
+
+/**
+ * Professional continued fraction for the regularized incomplete beta (Lentz)
+ */
+double betaContinuedFraction(double a, double b, double x) {
+    const double tiny = std::numeric_limits<double>::min() / kEpsilon;
+    double qab = a + b;
+    double qap = a + 1.0;
+    double qam = a - 1.0;
+    double c = 1.0;
+    double d = 1.0 - qab * x / qap;
+    if (std::fabs(d) < tiny) d = tiny;
+    d = 1.0 / d;
+    double h = d;
+
+    for (int m = 1; m <= kMaxIterations; ++m) {
+        int m2 = 2 * m;
+        double aa = m * (b - m) * x / ((qam + m2) * (a + m2));
+        d = 1.0 + aa * d;
+        if (std::fabs(d) < tiny) d = tiny;
+        c = 1.0 + aa / c;
+        if (std::fabs(c) < tiny) c = tiny;
+        d = 1.0 / d;
+        h *= d * c;
+
+        aa = -(a + m) * (qab + m) * x / ((a + m2) * (qap + m2));
+        d = 1.0 + aa * d;
+        if (std::fabs(d) < tiny) d = tiny;
+        c = 1.0 + aa / c;
+        if (std::fabs(c) < tiny) c = tiny;
+        d = 1.0 / d;
+        double delta = d * c;
+        h *= delta;
+        if (std::fabs(delta - 1.0) < kEpsilon) {
+            break;
+        }
+    }
+    return h;
+}
+
+double regularizedIncompleteBeta(double a, double b, double x) {
+    if (x <= 0.0) return 0.0;
+    if (x >= 1.0) return 1.0;
+
+    double log_front = std::lgamma(a + b) - std::lgamma(a) - std::lgamma(b) +
+                       a * std::log(x) + b * std::log1p(-x);
+    double front = std::exp(log_front);
+
+    // The continued fraction converges fastest on the near side of the mean
+    if (x < (a + 1.0) / (a + b + 2.0)) {
+        return front * betaContinuedFraction(a, b, x) / a;
+    }
+    return 1.0 - front * betaContinuedFraction(b, a, 1.0 - x) / b;
+}
+
+double mean(const std::vector<double>& samples) {
+    return std::accumulate(samples.begin(), samples.end(), 0.0) / static_cast<double>(samples.size());
+}
+
+double variance(const std::vector<double>& samples, double sample_mean) {
+    if (samples.size() < 2) {
+        return 0.0;
+    }
+    double sum = 0.0;
+    for (double v : samples) {
+        sum += (v - sample_mean) * (v - sample_mean);
+    }
+    return sum / static_cast<double>(samples.size() - 1);
+}
+
+double median(std::vector<double> samples) {
+    size_t mid = samples.size() / 2;
+    std::nth_element(samples.begin(), samples.begin() + mid, samples.end());
+    double upper = samples[mid];
+    if (samples.size() % 2) {
+        return upper;
+    }
+    return 0.5 * (*std::max_element(samples.begin(), samples.begin() + mid) + upper);
+}
+
+/**
+ * Enhanced exact null distribution of U
+ *
+ * The number of arrangements with U = u is the q^u coefficient of the
+ * Gaussian binomial [n_a + n_b choose n_a], built as the product of
+ * (1 - q^(n_b + i)) / (1 - q^i) for i = 1..n_a.
+ */
+std::vector<double> exactUCounts(size_t n_a, size_t n_b) {
+    std::vector<double> counts(n_a * n_b + 1, 0.0);
+    counts[0] = 1.0;
+    for (size_t i = 1; i <= n_a; ++i) {
+        size_t up = n_b + i;
+        for (size_t u = counts.size(); u-- > up;) {
+            counts[u] -= counts[u - up];
+        }
+        for (size_t u = i; u < counts.size(); ++u) {
+            counts[u] += counts[u - i];
+        }
+    }
+    return counts;
+}
+
+} // namespace
+
+double studentTCdf(double t, double degrees_of_freedom) {
+    if (!(degrees_of_freedom > 0.0)) {
+        return 0.5;
+    }
+    double x = degrees_of_freedom / (degrees_of_freedom + t * t);
+    double tail = 0.5 * regularizedIncompleteBeta(degrees_of_freedom / 2.0, 0.5, x);
+    return t >= 0.0 ? 1.0 - tail : tail;
+}
+
+double studentTQuantile(double p, double degrees_of_freedom) {
+    if (p <= 0.0) return -std::numeric_limits<double>::infinity();
+    if (p >= 1.0) return std::numeric_limits<double>::infinity();
+
+    // Bisection on the monotonic CDF; 100 halvings of [-1e3, 1e3] is ample
+    double low = -1e3;
+    double high = 1e3;
+    for (int i = 0; i < 100; ++i) {
+        double mid = 0.5 * (low + high);
+        if (studentTCdf(mid, degrees_of_freedom) < p) {
+            low = mid;
+        } else {
+            high = mid;
+        }
+    }
+    return 0.5 * (low + high);
+}
+
+Summary summarize(const std::vector<double>& samples, double confidence) {
+    Summary summary;
+    summary.count = samples.size();
+    if (samples.empty()) {
+        return summary;
+    }
+
+    std::vector<double> sorted(samples);
+    std::sort(sorted.begin(), sorted.end());
+    size_t mid = sorted.size() / 2;
+
+    summary.mean = mean(samples);
+    summary.median = sorted.size() % 2 ? sorted[mid] : 0.5 * (sorted[mid - 1] + sorted[mid]);
+    summary.min = sorted.front();
+    summary.max = sorted.back();
+    summary.stddev = std::sqrt(variance(samples, summary.mean));
+
+    double half_width = 0.0;
+    if (samples.size() > 1) {
+        double df = static_cast<double>(samples.size() - 1);
+        double t = studentTQuantile(0.5 + confidence / 2.0, df);
+        half_width = t * summary.stddev / std::sqrt(static_cast<double>(samples.size()));
+    }
+    summary.ci_low = summary.mean - half_width;
+    summary.ci_high = summary.mean + half_width;
+    return summary;
+}
+
+WelchResult welchTest(const std::vector<double>& a, const std::vector<double>& b, double confidence) {
+    WelchResult result;
+    if (a.size() < 2 || b.size() < 2) {
+        return result;
+    }
+
+    double mean_a = mean(a);
+    double mean_b = mean(b);
+    double se_a = variance(a, mean_a) / static_cast<double>(a.size());
+    double se_b = variance(b, mean_b) / static_cast<double>(b.size());
+    double se = std::sqrt(se_a + se_b);
+
+    result.difference = mean_b - mean_a;
+    result.relative_difference = mean_a != 0.0 ? result.difference / mean_a : 0.0;
+
+    if (se == 0.0) {
+        // Identical constant samples: either no difference or a certain one
+        result.p_value = result.difference == 0.0 ? 1.0 : 0.0;
+        result.ci_low = result.ci_high = result.difference;
+        return result;
+    }
+
+    // Welch-Satterthwaite degrees of freedom
+    result.degrees_of_freedom = (se_a + se_b) * (se_a + se_b) /
+        (se_a * se_a / static_cast<double>(a.size() - 1) + se_b * se_b / static_cast<double>(b.size() - 1));
+    result.t = result.difference / se;
+    result.p_value = 2.0 * (1.0 - studentTCdf(std::fabs(result.t), result.degrees_of_freedom));
+
+    double t_crit = studentTQuantile(0.5 + confidence / 2.0, result.degrees_of_freedom);
+    result.ci_low = result.difference - t_crit * se;
+    result.ci_high = result.difference + t_crit * se;
+    return result;
+}
+
+MannWhitneyResult mannWhitneyTest(const std::vector<double>& a, const std::vector<double>& b) {
+    MannWhitneyResult result;
+    if (a.empty() || b.empty()) {
+        return result;
+    }
+
+    const size_t n_a = a.size();
+    const size_t n_b = b.size();
+    const double pairs = static_cast<double>(n_a) * static_cast<double>(n_b);
+
+    std::vector<double> differences;
+    differences.reserve(n_a * n_b);
+    for (double x : a) {
+        for (double y : b) {
+            result.u += y > x ? 1.0 : (y == x ? 0.5 : 0.0);
+            differences.push_back(y - x);
+        }
+    }
+    result.rank_biserial = 2.0 * result.u / pairs - 1.0;
+    result.shift = median(std::move(differences));
+    double median_a = median(a);
+    result.relative_shift = median_a != 0.0 ? result.shift / median_a : 0.0;
+
+    // Tie groups over the pooled sample
+    std::vector<double> pooled(a);
+    pooled.insert(pooled.end(), b.begin(), b.end());
+    std::sort(pooled.begin(), pooled.end());
+    double tie_term = 0.0;
+    for (size_t i = 0; i < pooled.size();) {
+        size_t j = i;
+        while (j < pooled.size() && pooled[j] == pooled[i]) {
+            ++j;
+        }
+        double t = static_cast<double>(j - i);
+        tie_term += t * t * t - t;
+        i = j;
+    }
+
+    const double n = static_cast<double>(n_a + n_b);
+    const double mean_u = pairs / 2.0;
+    double variance_u = pairs / 12.0 * ((n + 1.0) - tie_term / (n * (n - 1.0)));
+    if (variance_u > 0.0) {
+        double distance = std::max(0.0, std::fabs(result.u - mean_u) - 0.5);
+        result.z = std::copysign(distance / std::sqrt(variance_u), result.u - mean_u);
+    }
+
+    if (tie_term == 0.0 && n_a + n_b <= kExactMannWhitneyLimit) {
+        std::vector<double> counts = exactUCounts(n_a, n_b);
+        double total = std::accumulate(counts.begin(), counts.end(), 0.0);
+        size_t u = static_cast<size_t>(result.u);
+        double lower = std::accumulate(counts.begin(), counts.begin() + u + 1, 0.0);
+        double upper = std::accumulate(counts.begin() + u, counts.end(), 0.0);
+        result.p_value = std::min(1.0, 2.0 * std::min(lower, upper) / total);
+        result.exact = true;
+    } else if (variance_u > 0.0) {
+        result.p_value = std::min(1.0, std::erfc(std::fabs(result.z) / std::sqrt(2.0)));
+    }
+    return result;
+}
+
+} // namespace BenchStats
+} // namespace TradingAnarchy
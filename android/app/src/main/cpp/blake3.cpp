@@ -0,0 +1,407 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * BLAKE3 - SIMD Compression and Multi-Threaded Tree Hashing
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#include "blake3.h"
+#include "native_executor.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace TradingAnarchy {
+namespace Blake3 {
+
+namespace {
+
+constexpr uint32_t kIV[8] = {
+    0x6A09E667u, 0xBB67AE85u, 0x3C6EF372u, 0xA54FF53Au,
+    0x510E527Fu, 0x9B05688Cu, 0x1F83D9ABu, 0x5BE0CD19u,
+};
+
+constexpr uint8_t kSchedule[7][16] = {
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {2, 6, 3, 10, 7, 0, 4, 13, 1, 11, 12, 5, 9, 14, 15, 8},
+    {3, 4, 10, 12, 13, 2, 7, 14, 6, 5, 9, 0, 11, 15, 8, 1},
+    {10, 7, 12, 9, 14, 3, 13, 15, 4, 0, 11, 2, 5, 8, 1, 6},
+    {12, 13, 9, 11, 15, 10, 14, 8, 7, 2, 5, 3, 0, 1, 6, 4},
+    {9, 14, 11, 5, 8, 12, 15, 1, 13, 3, 0, 10, 2, 6, 4, 7},
+    {11, 15, 5, 0, 1, 9, 8, 6, 14, 10, 2, 12, 3, 4, 7, 13},
+};
+
+constexpr uint8_t kChunkStart = 1 << 0;
+constexpr uint8_t kChunkEnd = 1 << 1;
+constexpr uint8_t kParent = 1 << 2;
+constexpr uint8_t kRoot = 1 << 3;
+
+constexpr size_t kBlocksPerChunk = kChunkBytes / kBlockBytes;
+
+// Chunks per compute-pool task: 64 KiB keeps scheduling overhead negligible
+constexpr size_t kChunksPerTask = 64;
+
+// Lanes of the widest variant; sizes the per-group pointer arrays
+constexpr size_t kMaxLanes = 8;
+
+inline uint32_t load32(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;       // Android ABIs are all little-endian
+}
+
+inline void store32(uint8_t* p, uint32_t v) {
+    std::memcpy(p, &v, sizeof(v));
+}
+
+/**
+ * Professional lane-generic round function
+ *
+ * V is uint32_t for the portable path or a GCC/Clang vector of N words, in
+ * which case each element is an independent input. Always inlined so every
+ * target-attributed wrapper below gets code generation for its own ISA.
+ */
+// Vectors are passed by reference only: by-value AVX vectors change the ABI
+template <typename V>
+[[gnu::always_inline]] inline void xorRotr(V& x, const V& y, int n) {
+    x ^= y;
+    x = (x >> n) | (x << (32 - n));
+}
+
+template <typename V>
+[[gnu::always_inline]] inline void mix(V* v, int a, int b, int c, int d, const V& x, const V& y) {
+    v[a] = v[a] + v[b] + x;
+    xorRotr(v[d], v[a], 16);
+    v[c] = v[c] + v[d];
+    xorRotr(v[b], v[c], 12);
+    v[a] = v[a] + v[b] + y;
+    xorRotr(v[d], v[a], 8);
+    v[c] = v[c] + v[d];
+    xorRotr(v[b], v[c], 7);
+}
+
+template <typename V>
+[[gnu::always_inline]] inline void compressLanes(V cv[8], const V m[16], const V& counter_low, const V& counter_high,
+                                                 uint32_t block_len, uint32_t flags) {
+    V v[16] = {
+        cv[0], cv[1], cv[2], cv[3], cv[4], cv[5], cv[6], cv[7],
+        V{} + kIV[0], V{} + kIV[1], V{} + kIV[2], V{} + kIV[3],
+        counter_low, counter_high, V{} + block_len, V{} + flags,
+    };
+
+    for (const uint8_t* s : kSchedule) {
+        mix(v, 0, 4, 8, 12, m[s[0]], m[s[1]]);
+        mix(v, 1, 5, 9, 13, m[s[2]], m[s[3]]);
+        mix(v, 2, 6, 10, 14, m[s[4]], m[s[5]]);
+        mix(v, 3, 7, 11, 15, m[s[6]], m[s[7]]);
+        mix(v, 0, 5, 10, 15, m[s[8]], m[s[9]]);
+        mix(v, 1, 6, 11, 12, m[s[10]], m[s[11]]);
+        mix(v, 2, 7, 8, 13, m[s[12]], m[s[13]]);
+        mix(v, 3, 4, 9, 14, m[s[14]], m[s[15]]);
+    }
+
+    for (int i = 0; i < 8; ++i) {
+        cv[i] = v[i] ^ v[i + 8];
+    }
+}
+
+/**
+ * Enhanced single-input compression of one 64-byte block into cv
+ */
+void compress(uint32_t cv[8], const uint8_t block[kBlockBytes], uint32_t block_len,
+              uint64_t counter, uint8_t flags) {
+    uint32_t m[16];
+    for (int i = 0; i < 16; ++i) {
+        m[i] = load32(block + 4 * i);
+    }
+    compressLanes<uint32_t>(cv, m, static_cast<uint32_t>(counter),
+                            static_cast<uint32_t>(counter >> 32), block_len, flags);
+}
+
+/**
+ * Professional N-lane hash_many - each vector element carries one input
+ */
+template <typename V, size_t N>
+[[gnu::always_inline]] inline size_t hashManyLanes(const uint8_t* const* inputs, size_t num_inputs, size_t blocks,
+                                                   const uint32_t key[8], uint64_t counter, bool increment_counter,
+                                                   uint8_t flags, uint8_t flags_start, uint8_t flags_end, uint8_t* out) {
+    size_t done = 0;
+    for (; done + N <= num_inputs; done += N) {
+        V cv[8];
+        for (int i = 0; i < 8; ++i) {
+            cv[i] = V{} + key[i];
+        }
+
+        V counter_low{};
+        V counter_high{};
+        for (size_t lane = 0; lane < N; ++lane) {
+            uint64_t lane_counter = counter + (increment_counter ? done + lane : 0);
+            counter_low[lane] = static_cast<uint32_t>(lane_counter);
+            counter_high[lane] = static_cast<uint32_t>(lane_counter >> 32);
+        }
+
+        for (size_t block = 0; block < blocks; ++block) {
+            V m[16];
+            for (size_t lane = 0; lane < N; ++lane) {
+                const uint8_t* p = inputs[done + lane] + block * kBlockBytes;
+                for (int i = 0; i < 16; ++i) {
+                    m[i][lane] = load32(p + 4 * i);
+                }
+            }
+
+            uint8_t block_flags = flags;
+            if (block == 0) block_flags |= flags_start;
+            if (block + 1 == blocks) block_flags |= flags_end;
+            compressLanes(cv, m, counter_low, counter_high, kBlockBytes, block_flags);
+        }
+
+        for (size_t lane = 0; lane < N; ++lane) {
+            for (int i = 0; i < 8; ++i) {
+                store32(out + (done + lane) * kDigestBytes + 4 * i, cv[i][lane]);
+            }
+        }
+    }
+    return done;
+}
+
+[[gnu::always_inline]] inline void hashManyScalar(const uint8_t* const* inputs, size_t num_inputs, size_t blocks,
+                                                  const uint32_t key[8], uint64_t counter, bool increment_counter,
+                                                  uint8_t flags, uint8_t flags_start, uint8_t flags_end, uint8_t* out) {
+    for (size_t input = 0; input < num_inputs; ++input) {
+        uint32_t cv[8];
+        std::memcpy(cv, key, sizeof(cv));
+        uint64_t input_counter = counter + (increment_counter ? input : 0);
+
+        for (size_t block = 0; block < blocks; ++block) {
+            uint8_t block_flags = flags;
+            if (block == 0) block_flags |= flags_start;
+            if (block + 1 == blocks) block_flags |= flags_end;
+            compress(cv, inputs[input] + block * kBlockBytes, kBlockBytes, input_counter, block_flags);
+        }
+
+        for (int i = 0; i < 8; ++i) {
+            store32(out + input * kDigestBytes + 4 * i, cv[i]);
+        }
+    }
+}
+
+void hashManyGeneric(const uint8_t* const* inputs, size_t num_inputs, size_t blocks,
+                     const uint32_t key[8], uint64_t counter, bool increment_counter,
+                     uint8_t flags, uint8_t flags_start, uint8_t flags_end, uint8_t* out) {
+    hashManyScalar(inputs, num_inputs, blocks, key, counter, increment_counter,
+                   flags, flags_start, flags_end, out);
+}
+
+/**
+ * Enhanced SIMD variants - vector extensions lowered to the target ISA;
+ * leftover inputs drop to narrower lanes and finally the scalar path
+ */
+using U32x4 = uint32_t __attribute__((vector_size(16)));
+
+template <typename V, size_t N>
+[[gnu::always_inline]] inline void hashManyVector(const uint8_t* const* inputs, size_t num_inputs, size_t blocks,
+                                                  const uint32_t key[8], uint64_t counter, bool increment_counter,
+                                                  uint8_t flags, uint8_t flags_start, uint8_t flags_end, uint8_t* out) {
+    size_t done = hashManyLanes<V, N>(inputs, num_inputs, blocks, key, counter, increment_counter,
+                                      flags, flags_start, flags_end, out);
+    hashManyScalar(inputs + done, num_inputs - done, blocks, key,
+                   counter + (increment_counter ? done : 0), increment_counter,
+                   flags, flags_start, flags_end, out + done * kDigestBytes);
+}
+
+#if defined(__aarch64__)
+void hashManyNeon(const uint8_t* const* inputs, size_t num_inputs, size_t blocks,
+                  const uint32_t key[8], uint64_t counter, bool increment_counter,
+                  uint8_t flags, uint8_t flags_start, uint8_t flags_end, uint8_t* out) {
+    hashManyVector<U32x4, 4>(inputs, num_inputs, blocks, key, counter, increment_counter,
+                             flags, flags_start, flags_end, out);
+}
+#endif
+
+#if defined(__x86_64__)
+using U32x8 = uint32_t __attribute__((vector_size(32)));
+
+[[gnu::target("sse4.1")]]
+void hashManySse41(const uint8_t* const* inputs, size_t num_inputs, size_t blocks,
+                   const uint32_t key[8], uint64_t counter, bool increment_counter,
+                   uint8_t flags, uint8_t flags_start, uint8_t flags_end, uint8_t* out) {
+    hashManyVector<U32x4, 4>(inputs, num_inputs, blocks, key, counter, increment_counter,
+                             flags, flags_start, flags_end, out);
+}
+
+[[gnu::target("avx2")]]
+void hashManyAvx2(const uint8_t* const* inputs, size_t num_inputs, size_t blocks,
+                  const uint32_t key[8], uint64_t counter, bool increment_counter,
+                  uint8_t flags, uint8_t flags_start, uint8_t flags_end, uint8_t* out) {
+    size_t done = hashManyLanes<U32x8, 8>(inputs, num_inputs, blocks, key, counter, increment_counter,
+                                          flags, flags_start, flags_end, out);
+    hashManyVector<U32x4, 4>(inputs + done, num_inputs - done, blocks, key,
+                             counter + (increment_counter ? done : 0), increment_counter,
+                             flags, flags_start, flags_end, out + done * kDigestBytes);
+}
+#endif
+
+/**
+ * Professional chaining values for `count` full chunks starting at chunk `first`
+ */
+void hashFullChunks(const uint8_t* data, uint64_t first, size_t count, uint8_t* out) {
+    HashManyFn hashMany = hashManyKernel().get();
+    const uint8_t* inputs[kMaxLanes * 8];
+    constexpr size_t kGroup = sizeof(inputs) / sizeof(inputs[0]);
+
+    for (size_t done = 0; done < count; done += kGroup) {
+        size_t group = std::min(kGroup, count - done);
+        for (size_t i = 0; i < group; ++i) {
+            inputs[i] = data + (first + done + i) * kChunkBytes;
+        }
+        hashMany(inputs, group, kBlocksPerChunk, kIV, first + done, true,
+                 0, kChunkStart, kChunkEnd, out + done * kDigestBytes);
+    }
+}
+
+/**
+ * Enhanced final (possibly partial) chunk, 1..1024 bytes or empty input
+ */
+void hashLastChunk(const uint8_t* data, size_t length, uint64_t chunk_counter, bool is_root, uint32_t cv[8]) {
+    std::memcpy(cv, kIV, sizeof(kIV));
+    uint8_t start = kChunkStart;
+
+    while (length > kBlockBytes) {
+        compress(cv, data, kBlockBytes, chunk_counter, start);
+        start = 0;
+        data += kBlockBytes;
+        length -= kBlockBytes;
+    }
+
+    uint8_t block[kBlockBytes] = {};
+    std::memcpy(block, data, length);
+    compress(cv, block, static_cast<uint32_t>(length), chunk_counter,
+             start | kChunkEnd | (is_root ? kRoot : 0));
+}
+
+/**
+ * Professional tree reduction
+ *
+ * Pairing chaining values level by level from the left, promoting an odd
+ * last node, builds exactly BLAKE3's left-balanced tree. Parents at each
+ * level go through hash_many as one-block inputs.
+ */
+void reduceToRoot(std::vector<uint8_t>& cvs, size_t count, uint8_t out[kDigestBytes]) {
+    HashManyFn hashMany = hashManyKernel().get();
+    std::vector<uint8_t> next(cvs.size());
+    std::vector<const uint8_t*> inputs;
+
+    while (count > 2) {
+        size_t parents = count / 2;
+        inputs.resize(parents);
+        for (size_t i = 0; i < parents; ++i) {
+            inputs[i] = cvs.data() + 2 * i * kDigestBytes;
+        }
+        hashMany(inputs.data(), parents, 1, kIV, 0, false, kParent, 0, 0, next.data());
+        if (count % 2) {
+            std::memcpy(next.data() + parents * kDigestBytes, cvs.data() + (count - 1) * kDigestBytes, kDigestBytes);
+        }
+        count = parents + count % 2;
+        cvs.swap(next);
+    }
+
+    uint32_t cv[8];
+    std::memcpy(cv, kIV, sizeof(kIV));
+    compress(cv, cvs.data(), kBlockBytes, 0, kParent | kRoot);
+    for (int i = 0; i < 8; ++i) {
+        store32(out + 4 * i, cv[i]);
+    }
+}
+
+void hashImpl(const uint8_t* data, size_t length, uint8_t out[kDigestBytes], bool parallel) {
+    if (length <= kChunkBytes) {
+        uint32_t cv[8];
+        hashLastChunk(data, length, 0, true, cv);
+        for (int i = 0; i < 8; ++i) {
+            store32(out + 4 * i, cv[i]);
+        }
+        return;
+    }
+
+    size_t chunks = (length + kChunkBytes - 1) / kChunkBytes;
+    size_t full_chunks = chunks - 1;    // the last chunk may be partial
+    std::vector<uint8_t> cvs(chunks * kDigestBytes);
+
+    if (parallel && length >= kParallelThreshold) {
+        size_t tasks = (full_chunks + kChunksPerTask - 1) / kChunksPerTask;
+        NativeExecutor::compute().parallelFor(tasks, [&](size_t task) {
+            size_t first = task * kChunksPerTask;
+            size_t count = std::min(kChunksPerTask, full_chunks - first);
+            hashFullChunks(data, first, count, cvs.data() + first * kDigestBytes);
+        });
+    } else {
+        hashFullChunks(data, 0, full_chunks, cvs.data());
+    }
+
+    uint32_t cv[8];
+    size_t tail = full_chunks * kChunkBytes;
+    hashLastChunk(data + tail, length - tail, full_chunks, false, cv);
+    for (int i = 0; i < 8; ++i) {
+        store32(cvs.data() + full_chunks * kDigestBytes + 4 * i, cv[i]);
+    }
+
+    reduceToRoot(cvs, chunks, out);
+}
+
+// Resolve at load time rather than on the first hash
+[[maybe_unused]] const KernelDispatchBase& kLoadTimeResolution = hashManyKernel();
+
+} // namespace
+
+KernelDispatch<HashManyFn>& hashManyKernel() {
+    static KernelDispatch<HashManyFn> dispatch("blake3-hash-many", {
+#if defined(__aarch64__)
+        {"neon", CPU_NEON, hashManyNeon},
+#endif
+#if defined(__x86_64__)
+        {"avx2", CPU_AVX2, hashManyAvx2},
+        {"sse4.1", CPU_SSE41, hashManySse41},
+#endif
+        {"generic", 0, hashManyGeneric},
+    });
+
+    static const bool workload_installed = [] {
+        dispatch.setWorkload([](size_t iterations) {
+            // Eight chunks per call so every variant fills its lanes
+            uint8_t input[8 * kChunkBytes] = {};
+            const uint8_t* inputs[8];
+            for (size_t i = 0; i < 8; ++i) {
+                inputs[i] = input + i * kChunkBytes;
+            }
+            uint8_t cvs[8 * kDigestBytes] = {};
+            uint64_t checksum = 0;
+            for (size_t i = 0; i < iterations; ++i) {
+                input[i % sizeof(input)] ^= cvs[i % sizeof(cvs)];
+                hashManyKernel().get()(inputs, 8, kBlocksPerChunk, kIV, i, true,
+                                       0, kChunkStart, kChunkEnd, cvs);
+                uint64_t word;
+                std::memcpy(&word, cvs, sizeof(word));
+                checksum ^= word;
+            }
+            return checksum;
+        });
+        return true;
+    }();
+    (void)workload_installed;
+
+    return dispatch;
+}
+
+void hash(const uint8_t* data, size_t length, uint8_t out[kDigestBytes]) {
+    hashImpl(data, length, out, true);
+}
+
+void hashSerial(const uint8_t* data, size_t length, uint8_t out[kDigestBytes]) {
+    hashImpl(data, length, out, false);
+}
+
+} // namespace Blake3
+} // namespace TradingAnarchy
@@ -0,0 +1,163 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Callback Dispatcher Implementation - Rate-Limited JS Event Delivery
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#include "callback_dispatcher.h"
+#include "native_executor.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace TradingAnarchy {
+
+CallbackDispatcher::CallbackDispatcher(NativeExecutor& executor, Deliver deliver)
+    : executor_(executor),
+      deliver_(std::move(deliver)) {
+    setMaxRate(kDefaultMaxRateHz);
+}
+
+void CallbackDispatcher::setMaxRate(double hz) {
+    hz = std::clamp(hz, 0.1, 1000.0 / kFrameIntervalMs);
+    
+    // Professional frame alignment - never deliver mid-frame
+    double frames = std::ceil((1000.0 / hz) / kFrameIntervalMs - 1e-9);
+    auto interval = std::chrono::duration<double, std::milli>(frames * kFrameIntervalMs);
+    
+    std::lock_guard<std::mutex> lock(mutex_);
+    interval_ = std::chrono::duration_cast<Clock::duration>(interval);
+    max_rate_hz_ = 1000.0 / (frames * kFrameIntervalMs);
+}
+
+void CallbackDispatcher::publishMetrics(const PerformanceMetrics& metrics) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    if (pending_metrics_) {
+        dropped_metrics_.fetch_add(1, std::memory_order_relaxed);
+    }
+    pending_metrics_ = metrics;
+    
+    scheduleLocked(Clock::now());
+}
+
+void CallbackDispatcher::publishStatus(ComputeEngineStatus status) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_events_.push_back(Event{Event::Kind::STATUS, status, {}, {}});
+    }
+    flushEvents();
+}
+
+void CallbackDispatcher::publishError(const std::string& error, const std::string& message) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_events_.push_back(Event{Event::Kind::ERROR, ComputeEngineStatus::ERROR, error, message});
+    }
+    flushEvents();
+}
+
+void CallbackDispatcher::acknowledge(bool carried_metrics) {
+    if (!carried_metrics) {
+        return;
+    }
+    
+    std::lock_guard<std::mutex> lock(mutex_);
+    metrics_in_flight_ = false;
+    if (pending_metrics_) {
+        scheduleLocked(Clock::now());
+    }
+}
+
+void CallbackDispatcher::close() {
+    std::lock_guard<std::mutex> deliver_lock(deliver_mutex_);
+    closed_.store(true);
+}
+
+CallbackDispatcher::Stats CallbackDispatcher::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return Stats{
+        max_rate_hz_,
+        delivered_metrics_.load(std::memory_order_relaxed),
+        dropped_metrics_.load(std::memory_order_relaxed),
+        delivered_events_.load(std::memory_order_relaxed),
+    };
+}
+
+/**
+ * Enhanced scheduling - arms at most one timer and one immediate flush
+ */
+void CallbackDispatcher::scheduleLocked(Clock::time_point now) {
+    if (metrics_in_flight_ || timer_armed_ || immediate_armed_) {
+        return;  // an outstanding flush or acknowledgement will pick it up
+    }
+    
+    if (now >= next_metrics_due_) {
+        immediate_armed_ = true;
+        executor_.submit([self = shared_from_this()] { self->flush(false); });
+    } else {
+        timer_armed_ = true;
+        auto delay = std::chrono::ceil<std::chrono::milliseconds>(next_metrics_due_ - now);
+        executor_.submitAfter(delay, [self = shared_from_this()] { self->flush(true); });
+    }
+}
+
+void CallbackDispatcher::flush(bool from_timer) {
+    std::lock_guard<std::mutex> deliver_lock(deliver_mutex_);
+    Batch batch;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (from_timer) {
+            timer_armed_ = false;
+        } else {
+            immediate_armed_ = false;
+        }
+        
+        batch.events.swap(pending_events_);
+        
+        auto now = Clock::now();
+        if (pending_metrics_ && !metrics_in_flight_ && now >= next_metrics_due_) {
+            batch.metrics = std::move(pending_metrics_);
+            pending_metrics_.reset();
+            metrics_in_flight_ = true;
+            next_metrics_due_ = now + interval_;
+        } else if (pending_metrics_) {
+            scheduleLocked(now);
+        }
+    }
+    
+    if (batch.empty() || closed_.load()) {
+        return;
+    }
+    
+    if (batch.metrics) {
+        delivered_metrics_.fetch_add(1, std::memory_order_relaxed);
+    }
+    delivered_events_.fetch_add(batch.events.size(), std::memory_order_relaxed);
+    
+    deliver_(std::move(batch));
+}
+
+/**
+ * Enhanced lifecycle delivery - straight to deliver_ on the publishing thread
+ */
+void CallbackDispatcher::flushEvents() {
+    std::lock_guard<std::mutex> deliver_lock(deliver_mutex_);
+    Batch batch;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        batch.events.swap(pending_events_);
+    }
+    
+    if (batch.empty() || closed_.load()) {
+        return;
+    }
+    
+    delivered_events_.fetch_add(batch.events.size(), std::memory_order_relaxed);
+    deliver_(std::move(batch));
+}
+
+} // namespace TradingAnarchy
@@ -8,6 +8,8 @@
  */
 
 #include "trading_anarchy_jni.h"
+#include "blake3.h"
+#include "keccak.h"
 #include <openssl/evp.h>
 #include <openssl/rand.h>
 #include <openssl/sha.h>
@@ -89,40 +91,49 @@ public:
         
         try {
             const EVP_MD* md = nullptr;
+            unsigned char hash[EVP_MAX_MD_SIZE];
+            unsigned int hash_len = 0;
             
             // Enhanced algorithm selection
-            if (algorithm == "SHA256") {
+            if (algorithm == "BLAKE3") {
+                // Native tree hash; large inputs fan out over the compute pool
+                Blake3::hash(reinterpret_cast<const uint8_t*>(input.data()), input.size(), hash);
+                hash_len = Blake3::kDigestBytes;
+            } else if (algorithm == "SHA256") {
                 md = EVP_sha256();
             } else if (algorithm == "SHA512") {
                 md = EVP_sha512();
             } else if (algorithm == "SHA3-256") {
                 md = EVP_sha3_256();
+            } else if (algorithm == "KECCAK-256") {
+                // Original Keccak padding, which EVP does not provide
+                Keccak::keccak_256(reinterpret_cast<const uint8_t*>(input.data()), input.size(), hash);
+                hash_len = Keccak::kDigestBytes;
             } else {
                 TA_LOGW("Unsupported hash algorithm: %s, using SHA256", algorithm.c_str());
                 md = EVP_sha256();
             }
             
             // Professional hash computation
-            unsigned char hash[EVP_MAX_MD_SIZE];
-            unsigned int hash_len;
-            
-            EVP_MD_CTX* ctx = EVP_MD_CTX_new();
-            if (!ctx) {
-                failed_operations_++;
-                return "";
-            }
-            
-            if (EVP_DigestInit_ex(ctx, md, nullptr) != 1 ||
-                EVP_DigestUpdate(ctx, input.c_str(), input.length()) != 1 ||
-                EVP_DigestFinal_ex(ctx, hash, &hash_len) != 1) {
+            if (md) {
+                EVP_MD_CTX* ctx = EVP_MD_CTX_new();
+                if (!ctx) {
+                    failed_operations_++;
+                    return "";
+                }
+                
+                if (EVP_DigestInit_ex(ctx, md, nullptr) != 1 ||
+                    EVP_DigestUpdate(ctx, input.c_str(), input.length()) != 1 ||
+                    EVP_DigestFinal_ex(ctx, hash, &hash_len) != 1) {
+                    
+                    EVP_MD_CTX_free(ctx);
+                    failed_operations_++;
+                    return "";
+                }
                 
                 EVP_MD_CTX_free(ctx);
-                failed_operations_++;
-                return "";
             }
             
-            EVP_MD_CTX_free(ctx);
-            
             // Enhanced hex string conversion
             std::stringstream ss;
             for (unsigned int i = 0; i < hash_len; i++) {
@@ -147,6 +158,63 @@ public:
         }
     }
     
+    /**
+     * Enhanced batch hash computation
+     *
+     * SHA3-256 and KECCAK-256 batches share interleaved Keccak permutations
+     * across messages; any other algorithm is hashed one message at a time.
+     */
+    std::vector<std::string> computeHashBatch(const std::vector<std::string>& inputs, const std::string& algorithm) {
+        bool sha3 = algorithm == "SHA3-256";
+        if (!sha3 && algorithm != "KECCAK-256") {
+            std::vector<std::string> digests;
+            digests.reserve(inputs.size());
+            for (const std::string& input : inputs) {
+                digests.push_back(computeHash(input, algorithm));
+            }
+            return digests;
+        }
+        
+        auto start_time = std::chrono::high_resolution_clock::now();
+        
+        std::vector<const uint8_t*> messages;
+        std::vector<size_t> lengths;
+        messages.reserve(inputs.size());
+        lengths.reserve(inputs.size());
+        for (const std::string& input : inputs) {
+            messages.push_back(reinterpret_cast<const uint8_t*>(input.data()));
+            lengths.push_back(input.size());
+        }
+        
+        std::vector<uint8_t> hashes(inputs.size() * Keccak::kDigestBytes);
+        if (sha3) {
+            Keccak::sha3_256Many(messages.data(), lengths.data(), inputs.size(), hashes.data());
+        } else {
+            Keccak::keccak_256Many(messages.data(), lengths.data(), inputs.size(), hashes.data());
+        }
+        
+        std::vector<std::string> digests;
+        digests.reserve(inputs.size());
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            std::stringstream ss;
+            for (size_t j = 0; j < Keccak::kDigestBytes; j++) {
+                ss << std::hex << std::setw(2) << std::setfill('0') << (int)hashes[i * Keccak::kDigestBytes + j];
+            }
+            digests.push_back(ss.str());
+        }
+        
+        // Professional performance tracking - one sample for the whole batch
+        auto end_time = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+            end_time - start_time).count();
+        
+        updatePerformanceMetrics(duration);
+        successful_operations_ += inputs.size();
+        total_computations_ += inputs.size();
+        
+        return digests;
+    }
+    
     /**
      * Enhanced mining simulation with realistic performance characteristics
      */
@@ -332,6 +400,25 @@ std::atomic<bool> ComputeEngineBridge::initialized_{false};
 std::mutex ComputeEngineBridge::bridge_mutex_;
 std::unique_ptr<ComputeEngineBridge> ComputeEngineBridge::instance_;
 
+/**
+ * Shared hash entry point for the Turbo Module
+ */
+std::string computeBridgeHash(const std::string& input, const std::string& algorithm) {
+    ComputeEngineBridge& bridge = ComputeEngineBridge::getInstance();
+    if (!bridge.initialize()) {
+        return "";
+    }
+    return bridge.computeHash(input, algorithm);
+}
+
+std::vector<std::string> computeBridgeHashBatch(const std::vector<std::string>& inputs, const std::string& algorithm) {
+    ComputeEngineBridge& bridge = ComputeEngineBridge::getInstance();
+    if (!bridge.initialize()) {
+        return {};
+    }
+    return bridge.computeHashBatch(inputs, algorithm);
+}
+
 } // namespace TradingAnarchy
 
 // Professional C-style interface for JNI integration
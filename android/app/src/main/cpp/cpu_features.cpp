@@ -0,0 +1,155 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * CPU Features - Runtime ISA Extension Detection
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#include "cpu_features.h"
+
+#if defined(__aarch64__) || defined(__arm__)
+#include <sys/auxv.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+namespace TradingAnarchy {
+
+namespace {
+
+#if defined(__aarch64__)
+// Linux arm64 uapi hwcap bits; older NDK headers lack the ARMv8.2 ones
+constexpr unsigned long kHwcapAsimd   = 1ul << 1;
+constexpr unsigned long kHwcapAes     = 1ul << 3;
+constexpr unsigned long kHwcapPmull   = 1ul << 4;
+constexpr unsigned long kHwcapSha1    = 1ul << 5;
+constexpr unsigned long kHwcapSha2    = 1ul << 6;
+constexpr unsigned long kHwcapFphp    = 1ul << 9;
+constexpr unsigned long kHwcapAsimdHp = 1ul << 10;
+constexpr unsigned long kHwcapLrcpc   = 1ul << 15;
+constexpr unsigned long kHwcapSha3    = 1ul << 17;
+constexpr unsigned long kHwcapAsimdDp = 1ul << 20;
+constexpr unsigned long kHwcapSha512  = 1ul << 21;
+constexpr unsigned long kHwcapSve     = 1ul << 22;
+
+uint64_t detect() {
+    unsigned long hwcap = getauxval(AT_HWCAP);
+    uint64_t mask = 0;
+
+    if (hwcap & kHwcapAsimd)   mask |= CPU_NEON;
+    if (hwcap & kHwcapAes)     mask |= CPU_AES;
+    if (hwcap & kHwcapPmull)   mask |= CPU_PMULL;
+    if (hwcap & kHwcapSha1)    mask |= CPU_SHA1;
+    if (hwcap & kHwcapSha2)    mask |= CPU_SHA2;
+    if (hwcap & kHwcapSha3)    mask |= CPU_SHA3;
+    if (hwcap & kHwcapSha512)  mask |= CPU_SHA512;
+    if (hwcap & kHwcapAsimdDp) mask |= CPU_DOTPROD;
+    if (hwcap & kHwcapSve)     mask |= CPU_SVE;
+    if (hwcap & kHwcapLrcpc)   mask |= CPU_RCPC;
+    if ((hwcap & kHwcapFphp) && (hwcap & kHwcapAsimdHp)) mask |= CPU_FP16;
+
+    return mask;
+}
+
+#elif defined(__arm__)
+constexpr unsigned long kHwcapNeon   = 1ul << 12;
+constexpr unsigned long kHwcap2Aes   = 1ul << 0;
+constexpr unsigned long kHwcap2Pmull = 1ul << 1;
+constexpr unsigned long kHwcap2Sha1  = 1ul << 2;
+constexpr unsigned long kHwcap2Sha2  = 1ul << 3;
+
+uint64_t detect() {
+    unsigned long hwcap = getauxval(AT_HWCAP);
+    unsigned long hwcap2 = getauxval(AT_HWCAP2);
+    uint64_t mask = 0;
+
+    if (hwcap & kHwcapNeon)    mask |= CPU_NEON;
+    if (hwcap2 & kHwcap2Aes)   mask |= CPU_AES;
+    if (hwcap2 & kHwcap2Pmull) mask |= CPU_PMULL;
+    if (hwcap2 & kHwcap2Sha1)  mask |= CPU_SHA1;
+    if (hwcap2 & kHwcap2Sha2)  mask |= CPU_SHA2;
+
+    return mask;
+}
+
+#elif defined(__x86_64__) || defined(__i386__)
+uint64_t detect() {
+    __builtin_cpu_init();
+    uint64_t mask = 0;
+
+    // __builtin_cpu_supports also checks that the OS saves the wide registers
+    if (__builtin_cpu_supports("ssse3"))    mask |= CPU_SSSE3;
+    if (__builtin_cpu_supports("sse4.1"))   mask |= CPU_SSE41;
+    if (__builtin_cpu_supports("aes"))      mask |= CPU_AES;
+    if (__builtin_cpu_supports("pclmul"))   mask |= CPU_PMULL;
+    if (__builtin_cpu_supports("avx"))      mask |= CPU_AVX;
+    if (__builtin_cpu_supports("avx2"))     mask |= CPU_AVX2;
+    if (__builtin_cpu_supports("bmi2"))     mask |= CPU_BMI2;
+    if (__builtin_cpu_supports("avx512f"))  mask |= CPU_AVX512F;
+    if (__builtin_cpu_supports("avx512vl")) mask |= CPU_AVX512VL;
+
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) && (ebx & (1u << 29))) {
+        mask |= CPU_SHA1 | CPU_SHA2;
+    }
+
+    return mask;
+}
+
+#else
+uint64_t detect() {
+    return 0;
+}
+#endif
+
+struct FeatureName {
+    CpuFeature feature;
+    const char* name;
+};
+
+constexpr FeatureName kFeatureNames[] = {
+    {CPU_NEON, "neon"},
+    {CPU_AES, "aes"},
+    {CPU_PMULL, "pmull"},
+    {CPU_SHA1, "sha1"},
+    {CPU_SHA2, "sha2"},
+    {CPU_SHA3, "sha3"},
+    {CPU_SHA512, "sha512"},
+    {CPU_DOTPROD, "dotprod"},
+    {CPU_SVE, "sve"},
+    {CPU_FP16, "fp16"},
+    {CPU_RCPC, "rcpc"},
+    {CPU_SSSE3, "ssse3"},
+    {CPU_SSE41, "sse4.1"},
+    {CPU_AVX, "avx"},
+    {CPU_AVX2, "avx2"},
+    {CPU_BMI2, "bmi2"},
+    {CPU_AVX512F, "avx512f"},
+    {CPU_AVX512VL, "avx512vl"},
+};
+
+} // namespace
+
+std::string CpuFeatures::describe() const {
+    std::string names;
+    for (const FeatureName& entry : kFeatureNames) {
+        if (has(entry.feature)) {
+            if (!names.empty()) {
+                names.push_back(' ');
+            }
+            names += entry.name;
+        }
+    }
+    return names;
+}
+
+const CpuFeatures& cpuFeatures() {
+    static const CpuFeatures features{detect()};
+    return features;
+}
+
+} // namespace TradingAnarchy
@@ -334,6 +334,35 @@ public:
 std::mutex CryptoUtils::crypto_mutex_;
 std::atomic<bool> CryptoUtils::initialized_{false};
 
+/**
+ * Shared entry points for the Turbo Module
+ */
+std::vector<uint8_t> generateSecureRandom(size_t length) {
+    return CryptoUtils::generateSecureRandom(length);
+}
+
+std::vector<uint8_t> deriveKeyPBKDF2(
+    const std::string& password,
+    const std::vector<uint8_t>& salt,
+    int iterations,
+    int keyLength) {
+    return CryptoUtils::deriveKeyPBKDF2(password, salt, iterations, keyLength);
+}
+
+std::vector<uint8_t> encryptAES256GCM(
+    const std::vector<uint8_t>& plaintext,
+    const std::vector<uint8_t>& key,
+    const std::vector<uint8_t>& iv,
+    std::vector<uint8_t>& tag) {
+    return CryptoUtils::encryptAES256GCM(plaintext, key, iv, tag);
+}
+
+std::vector<uint8_t> computeHMAC_SHA256(
+    const std::vector<uint8_t>& data,
+    const std::vector<uint8_t>& key) {
+    return CryptoUtils::computeHMAC_SHA256(data, key);
+}
+
 } // namespace Crypto
 } // namespace TradingAnarchy
 
@@ -0,0 +1,422 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Diagnostics - Native Self-Test and Microbenchmark Battery
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#include "diagnostics.h"
+#include "keccak.h"
+#include "scratchpad_kernel.h"
+#include "blake3.h"
+#include "aes_round.h"
+#include "trading_anarchy_jni.h"
+
+#include <openssl/evp.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <thread>
+
+namespace TradingAnarchy {
+namespace Diagnostics {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr auto kHashWindow = std::chrono::milliseconds(250);
+constexpr auto kMemoryWindow = std::chrono::milliseconds(200);
+constexpr size_t kMemoryBufferBytes = 32u << 20;   // well past any mobile L3
+constexpr size_t kLatencySteps = 2u << 20;
+constexpr int kMaxThermalZones = 64;
+
+/**
+ * Reference device for the score - a mid-range 2023 handset scores 1000
+ */
+constexpr double kReferenceSingleCoreHps = 1.0e6;
+constexpr double kReferenceAllCoreHps = 4.0e6;
+constexpr double kReferenceReadBytesPerSec = 10.0e9;
+constexpr double kReferenceLatencyNs = 120.0;
+
+double elapsedUs(Clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+std::string toHex(const std::vector<uint8_t>& bytes) {
+    static const char digits[] = "0123456789abcdef";
+    std::string hex;
+    hex.reserve(bytes.size() * 2);
+    for (uint8_t b : bytes) {
+        hex.push_back(digits[b >> 4]);
+        hex.push_back(digits[b & 0x0f]);
+    }
+    return hex;
+}
+
+std::vector<uint8_t> bytesOf(const char* text) {
+    return std::vector<uint8_t>(text, text + std::strlen(text));
+}
+
+// Runs a sponge hash through whichever permutation variant was dispatched
+std::string spongeHex(void (*hash)(const uint8_t*, size_t, uint8_t*), const char* text) {
+    std::vector<uint8_t> digest(Keccak::kDigestBytes);
+    hash(reinterpret_cast<const uint8_t*>(text), std::strlen(text), digest.data());
+    return toHex(digest);
+}
+
+// Messages of 0, 3, 136 and 300 bytes fill one interleaved group; the result
+// is SHA3-256 over the four digests, so a wrong lane changes it
+std::string batchHex(void (*hashMany)(const uint8_t* const*, const size_t*, size_t, uint8_t*)) {
+    std::vector<uint8_t> message(300);
+    for (size_t i = 0; i < message.size(); ++i) {
+        message[i] = static_cast<uint8_t>(i % 251);
+    }
+    const uint8_t* inputs[] = {message.data(), message.data(), message.data(), message.data()};
+    const size_t lengths[] = {0, 3, 136, 300};
+
+    std::vector<uint8_t> digests(4 * Keccak::kDigestBytes);
+    hashMany(inputs, lengths, 4, digests.data());
+
+    std::vector<uint8_t> digest(Keccak::kDigestBytes);
+    Keccak::sha3_256(digests.data(), digests.size(), digest.data());
+    return toHex(digest);
+}
+
+/**
+ * Professional known-answer table
+ *
+ * Each entry runs the engine's own kernel entry point, not a parallel
+ * implementation, so a miscompiled or mis-dispatched kernel fails here.
+ */
+struct KnownAnswerTest {
+    const char* kernel;
+    std::function<std::string()> compute;
+    const char* expected_hex;
+};
+
+const std::vector<KnownAnswerTest>& knownAnswerTests() {
+    static const std::vector<KnownAnswerTest> tests = {
+        {"sha256", [] { return computeBridgeHash("abc", "SHA256"); },
+         "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"},
+        {"sha512", [] { return computeBridgeHash("abc", "SHA512"); },
+         "ddaf35a193617abacc417349ae20413112e6fa4e89a97ea20a9eeee64b55d39a"
+         "2192992a274fc1a836ba3c23a3feebbd454d4423643ce80e2a9ac94fa54ca49f"},
+        {"sha3-256", [] { return computeBridgeHash("abc", "SHA3-256"); },
+         "3a985da74fe225b2045c172d6bd390bd855f086e3e9d525b46bfe24511431532"},
+        {"sha3-256-native", [] { return spongeHex(Keccak::sha3_256, "abc"); },
+         "3a985da74fe225b2045c172d6bd390bd855f086e3e9d525b46bfe24511431532"},
+        {"keccak-256", [] { return spongeHex(Keccak::keccak_256, "abc"); },
+         "4e03657aea45a94fc7d47ba826c8d667c0d1e6e33a64a036ec44f58fa12d6c45"},
+        {"sha3-256-batch", [] { return batchHex(Keccak::sha3_256Many); },
+         "ef651d92d970c119d28296fd3f1426335479e659691b12a3a503836ea87b71b0"},
+        {"keccak-256-batch", [] { return batchHex(Keccak::keccak_256Many); },
+         "3b0dddcf57d4db37bf36ab6a27ddfa7901fe1f5f8d016253fd70a125f6f97b68"},
+        {"blake3", [] { return computeBridgeHash("abc", "BLAKE3"); },
+         "6437b3ac38465133ffb63b75273a8db548c558465d79db03fd359c6cd5bd9d85"},
+        // 300 KiB of i % 251 - above the threshold, so the parallel tree path runs
+        {"blake3-tree", [] {
+             std::vector<uint8_t> input(300 * 1024);
+             for (size_t i = 0; i < input.size(); ++i) {
+                 input[i] = static_cast<uint8_t>(i % 251);
+             }
+             std::vector<uint8_t> digest(Blake3::kDigestBytes);
+             Blake3::hash(input.data(), input.size(), digest.data());
+             return toHex(digest);
+         },
+         "6254a933aaafd6dd9036a5266346c429424cc738431560f0b7531be0005be5ce"},
+        // 256 KiB scratchpad from the large-page allocator through the dispatched main loop
+        {"cn-scratchpad", [] {
+             LargePageBuffer scratchpad(Scratchpad::kMinBytes);
+             std::vector<uint8_t> digest(Scratchpad::kDigestBytes);
+             Scratchpad::hash(reinterpret_cast<const uint8_t*>("abc"), 3, scratchpad.data(),
+                              Scratchpad::kMinBytes, digest.data());
+             return toHex(digest);
+         },
+         "0730bac820843d626e6746d2246b48ea776c03f11f15d06cda5b9b941d7551d7"},
+        // Blocks seeded 1 + 7i and keys 2 + 7i; the first two lanes after one pass of ten rounds
+        {"aes-round", [] {
+             std::vector<uint8_t> blocks(AesRound::kLanes * AesRound::kBlockBytes);
+             std::vector<uint8_t> keys(AesRound::kRounds * AesRound::kBlockBytes);
+             for (size_t i = 0; i < keys.size(); ++i) {
+                 keys[i] = static_cast<uint8_t>(2 + 7 * i);
+             }
+             for (size_t i = 0; i < blocks.size(); ++i) {
+                 blocks[i] = static_cast<uint8_t>(1 + 7 * i);
+             }
+             AesRound::encryptRounds(blocks.data(), keys.data(), 1);
+             blocks.resize(2 * AesRound::kBlockBytes);
+             return toHex(blocks);
+         },
+         "5e90b3c90ed73d69d926beed35eb158d768878ef40648f6a58487f64a63c976e"},
+        // NIST GCM test case 14: zero key, zero IV, one zero block
+        {"aes-256-gcm", [] {
+             std::vector<uint8_t> tag;
+             std::vector<uint8_t> ciphertext = Crypto::encryptAES256GCM(
+                 std::vector<uint8_t>(16, 0), std::vector<uint8_t>(32, 0),
+                 std::vector<uint8_t>(12, 0), tag);
+             ciphertext.insert(ciphertext.end(), tag.begin(), tag.end());
+             return toHex(ciphertext);
+         },
+         "cea7403d4d606b6e074ec5d3baf39d18d0d1c8a799996bf0265b98b5d48ab919"},
+        // RFC 4231 test case 2
+        {"hmac-sha256", [] {
+             return toHex(Crypto::computeHMAC_SHA256(
+                 bytesOf("what do ya want for nothing?"), bytesOf("Jefe")));
+         },
+         "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843"},
+        {"pbkdf2-sha256", [] {
+             return toHex(Crypto::deriveKeyPBKDF2(
+                 "password", bytesOf("saltSALTsaltSALT"), 100000, 32));
+         },
+         "a7e3b4657d7ec5eee255d87157b73f2907eb21576c3926644f9ed7664dcc6e5d"},
+    };
+    return tests;
+}
+
+void runKnownAnswerTests(DiagnosticsReport& report) {
+    report.self_test_passed = true;
+
+    for (const KnownAnswerTest& test : knownAnswerTests()) {
+        KnownAnswerResult result;
+        result.kernel = test.kernel;
+
+        auto start = Clock::now();
+        try {
+            result.passed = test.compute() == test.expected_hex;
+        } catch (const std::exception& e) {
+            TA_LOGE("Known-answer test %s threw: %s", test.kernel, e.what());
+        }
+        result.duration_us = elapsedUs(start);
+
+        if (!result.passed) {
+            TA_LOGE("Known-answer test failed: %s", test.kernel);
+            report.self_test_passed = false;
+        }
+        report.known_answer_tests.push_back(std::move(result));
+    }
+}
+
+/**
+ * Enhanced hash throughput loop - one EVP context per thread, no locks
+ */
+uint64_t hashUntil(Clock::time_point deadline, uint64_t seed) {
+    EVP_MD_CTX* ctx = EVP_MD_CTX_new();
+    if (!ctx) {
+        return 0;
+    }
+
+    uint8_t message[64] = {};
+    uint8_t digest[EVP_MAX_MD_SIZE];
+    unsigned int digest_len = 0;
+    uint64_t count = 0;
+
+    while (Clock::now() < deadline) {
+        for (int i = 0; i < 256; ++i) {
+            uint64_t nonce = seed + count;
+            std::memcpy(message, &nonce, sizeof(nonce));
+            EVP_DigestInit_ex(ctx, EVP_sha256(), nullptr);
+            EVP_DigestUpdate(ctx, message, sizeof(message));
+            EVP_DigestFinal_ex(ctx, digest, &digest_len);
+            message[8] ^= digest[0];
+            ++count;
+        }
+    }
+
+    EVP_MD_CTX_free(ctx);
+    return count;
+}
+
+void measureHashThroughput(DiagnosticsReport& report) {
+    auto seconds = std::chrono::duration<double>(kHashWindow).count();
+
+    report.single_core_hashes_per_sec = hashUntil(Clock::now() + kHashWindow, 0) / seconds;
+
+    uint32_t threads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<uint64_t> counts(threads, 0);
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+
+    // Common deadline so every worker measures the same window
+    auto deadline = Clock::now() + std::chrono::milliseconds(5) + kHashWindow;
+    for (uint32_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&counts, t, deadline] {
+            counts[t] = hashUntil(deadline, static_cast<uint64_t>(t) << 40);
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    report.hash_threads = threads;
+    report.all_core_hashes_per_sec =
+        std::accumulate(counts.begin(), counts.end(), uint64_t{0}) / seconds;
+}
+
+/**
+ * Professional memory probes - streaming read, copy and dependent-load latency
+ */
+void measureMemory(DiagnosticsReport& report) {
+    const size_t words = kMemoryBufferBytes / sizeof(uint64_t);
+    std::vector<uint64_t> buffer(words, 1);
+
+    volatile uint64_t sink = 0;
+    size_t bytes_read = 0;
+    auto start = Clock::now();
+    while (Clock::now() - start < kMemoryWindow) {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < words; i += 4) {
+            sum += buffer[i] + buffer[i + 1] + buffer[i + 2] + buffer[i + 3];
+        }
+        sink = sink + sum;
+        bytes_read += kMemoryBufferBytes;
+    }
+    report.memory_read_bytes_per_sec = bytes_read / (elapsedUs(start) / 1e6);
+
+    uint8_t* base = reinterpret_cast<uint8_t*>(buffer.data());
+    const size_t half = kMemoryBufferBytes / 2;
+    size_t bytes_copied = 0;
+    start = Clock::now();
+    while (Clock::now() - start < kMemoryWindow) {
+        std::memcpy(base + half, base, half);
+        std::memmove(base, base + half, half);
+        bytes_copied += 2 * half;
+    }
+    // Copy traffic counts read plus write
+    report.memory_copy_bytes_per_sec = 2.0 * bytes_copied / (elapsedUs(start) / 1e6);
+
+    // Sattolo shuffle over cache lines yields a single cycle the prefetcher cannot follow
+    const size_t stride = 64 / sizeof(uint64_t);
+    const size_t lines = words / stride;
+    std::vector<size_t> order(lines);
+    std::iota(order.begin(), order.end(), size_t{0});
+    std::mt19937_64 rng(0x5eed);
+    for (size_t i = lines - 1; i > 0; --i) {
+        std::uniform_int_distribution<size_t> pick(0, i - 1);
+        std::swap(order[i], order[pick(rng)]);
+    }
+    for (size_t i = 0; i < lines; ++i) {
+        buffer[order[i] * stride] = order[(i + 1) % lines] * stride;
+    }
+
+    size_t index = 0;
+    start = Clock::now();
+    for (size_t step = 0; step < kLatencySteps; ++step) {
+        index = buffer[index];
+    }
+    report.memory_latency_ns = elapsedUs(start) * 1000.0 / kLatencySteps;
+    sink = sink + index;
+}
+
+/**
+ * Enhanced timer probe - smallest observable steady_clock tick
+ */
+void measureTimerResolution(DiagnosticsReport& report) {
+    auto best = Clock::duration::max();
+    for (int sample = 0; sample < 1000; ++sample) {
+        auto first = Clock::now();
+        auto next = Clock::now();
+        while (next == first) {
+            next = Clock::now();
+        }
+        best = std::min(best, next - first);
+    }
+    report.timer_resolution_ns = std::chrono::duration<double, std::nano>(best).count();
+}
+
+/**
+ * Professional thermal probe - sysfs zones may be hidden by SELinux
+ */
+void measureThermalSensors(DiagnosticsReport& report) {
+    double total_us = 0.0;
+
+    for (int zone = 0; zone < kMaxThermalZones; ++zone) {
+        char path[64];
+        std::snprintf(path, sizeof(path), "/sys/class/thermal/thermal_zone%d/temp", zone);
+
+        auto start = Clock::now();
+        FILE* file = std::fopen(path, "r");
+        if (!file) {
+            break;
+        }
+        long millidegrees = 0;
+        int parsed = std::fscanf(file, "%ld", &millidegrees);
+        std::fclose(file);
+        double read_us = elapsedUs(start);
+
+        if (parsed != 1) {
+            continue;
+        }
+
+        report.thermal_zones++;
+        total_us += read_us;
+
+        // Some vendors report whole degrees instead of millidegrees
+        double celsius = std::labs(millidegrees) >= 1000 ? millidegrees / 1000.0 : millidegrees;
+        report.max_temperature_c = std::max(report.max_temperature_c, celsius);
+    }
+
+    if (report.thermal_zones > 0) {
+        report.thermal_read_us = total_us / report.thermal_zones;
+    }
+}
+
+/**
+ * Enhanced fleet score - geometric mean of ratios against the reference device
+ */
+double computeDeviceScore(const DiagnosticsReport& report) {
+    if (!report.self_test_passed || report.memory_latency_ns <= 0.0) {
+        return 0.0;
+    }
+
+    const double ratios[] = {
+        report.single_core_hashes_per_sec / kReferenceSingleCoreHps,
+        report.all_core_hashes_per_sec / kReferenceAllCoreHps,
+        report.memory_read_bytes_per_sec / kReferenceReadBytesPerSec,
+        kReferenceLatencyNs / report.memory_latency_ns,
+    };
+
+    double log_sum = 0.0;
+    for (double ratio : ratios) {
+        if (ratio <= 0.0) {
+            return 0.0;
+        }
+        log_sum += std::log(ratio);
+    }
+    return std::round(1000.0 * std::exp(log_sum / std::size(ratios)));
+}
+
+} // namespace
+
+DiagnosticsReport runBattery() {
+    DiagnosticsReport report;
+    auto start = Clock::now();
+
+    TA_LOGI("Running diagnostics battery v%u", kBatteryVersion);
+
+    runKnownAnswerTests(report);
+    measureTimerResolution(report);
+    measureThermalSensors(report);
+    measureHashThroughput(report);
+    measureMemory(report);
+
+    report.device_score = computeDeviceScore(report);
+    report.duration_ms = elapsedUs(start) / 1000.0;
+
+    TA_LOGI("Diagnostics complete: score=%.0f self_test=%s duration=%.0fms",
+            report.device_score, report.self_test_passed ? "pass" : "FAIL", report.duration_ms);
+
+    return report;
+}
+
+} // namespace Diagnostics
+} // namespace TradingAnarchy
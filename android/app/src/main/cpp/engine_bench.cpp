@@ -0,0 +1,832 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Engine Bench - Standalone Benchmark Runner and PGO Training Workload
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#include "diagnostics.h"
+#include "kernel_dispatch.h"
+#include "blake3.h"
+#include "keccak.h"
+#include "scratchpad_kernel.h"
+#include "aes_round.h"
+#include "memory_probe.h"
+#include "thread_planner.h"
+#include "share_verifier.h"
+#include "hashrate_watchdog.h"
+#include "telemetry_simulator.h"
+#include "regression_bench.h"
+#include "promise_slab.h"
+
+#include <openssl/evp.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Professional on-device runner for the diagnostics battery
+ *
+ * Pushed to /data/local/tmp by engine-pgo.sh. In a GENERATE build the
+ * instrumented hot sources write their profile on exit (LLVM_PROFILE_FILE).
+ * Each run prints one "run" line and a final "median" line of key=value
+ * pairs so the script can diff plain and PGO builds.
+ *
+ * "tradingAnarchyEngineBench kernels [iterations]" instead times every
+ * supported variant of each dispatched kernel, checks that all variants
+ * agree with the portable baseline and that load-time selection picked
+ * the preferred one. A variant that is not faster than the baseline
+ * prints gain=0 and fails the run, since it is dead weight.
+ *
+ * "tradingAnarchyEngineBench hashes [megabytes]" prints SHA-256, BLAKE3
+ * (single-threaded and tree-parallel) and SHA3-256 (one message at a time
+ * and kBatchWays messages per interleaved permutation) throughput across
+ * input sizes.
+ *
+ * "tradingAnarchyEngineBench scratchpad [seconds]" sweeps the CryptoNight
+ * scratchpad kernel from 256 KiB to 2 MiB on one thread, then runs the
+ * 2 MiB size on every core.
+ *
+ * "tradingAnarchyEngineBench aes" runs the one-time AES round measurement
+ * and prints which variant won and the ns per round of each side.
+ *
+ * "tradingAnarchyEngineBench memory" prints the pointer-chase latency
+ * curve, triad bandwidth at 1 to N threads and the cache sizes and
+ * saturation point read from them.
+ *
+ * "tradingAnarchyEngineBench plan [algorithm...]" prints the thread
+ * planner's recommendation and predicted throughput curve for each
+ * algorithm, from the topology alone.
+ *
+ * "tradingAnarchyEngineBench topology [directory]" loads the planner's
+ * topology with its XML cache in the directory (default: the working
+ * directory) and prints how long the load took. The first run discovers
+ * through sysfs and writes the cache; later runs load the XML.
+ *
+ * "tradingAnarchyEngineBench shares [count]" feeds the share verifier
+ * count candidates with known outcomes - valid, below target, stale,
+ * duplicate nonce and corrupted hash - and fails unless every reason
+ * count matches.
+ *
+ * "tradingAnarchyEngineBench watchdog" replays a synthetic four-worker
+ * hashrate trace with a stall, a single-worker drop and a device-wide
+ * drop through the hashrate watchdog, prints each captured bundle and
+ * fails unless exactly those three anomalies were reported.
+ *
+ * "tradingAnarchyEngineBench simulate [multiplier] [seconds]" runs the
+ * telemetry simulator at multiplier times realistic event rates (default
+ * 100) for the given wall seconds into a share verifier, prints sink time
+ * and lag per event type and fails unless the verifier's verdicts match
+ * the simulated outcomes. Shares overtaken by a job switch may turn
+ * stale; any other difference is a failure.
+ *
+ * "tradingAnarchyEngineBench regress [directory] [repetitions]" runs the
+ * reproducible scratchpad benchmark - fixed seed, pinned threads and a
+ * cool-down before each repetition - and compares it with the baseline
+ * stored in the directory (default: the working directory), recording
+ * one when there is none. It prints the Mann-Whitney verdict with its
+ * effect sizes and fails on a regression. "regress-baseline" takes the
+ * same arguments and replaces the stored baseline with the new run.
+ *
+ * "tradingAnarchyEngineBench promises [threads] [cycles]" stresses the
+ * promise slab the Turbo Module keeps its pending calls in. Each thread
+ * runs cycles insert/take pairs (default 8 threads of 200000) while a
+ * reaper thread sweeps expired entries, as the timeout sweep does. Every
+ * sixteenth entry is inserted already expired so take and reap race for
+ * it. Fails unless every inserted entry was settled exactly once, no
+ * stale handle took a value and the slab ends empty. Build it with
+ * -fsanitize=thread to check the slab for data races.
+ */
+namespace {
+
+using TradingAnarchy::Diagnostics::DiagnosticsReport;
+
+void printReport(const char* label, const DiagnosticsReport& report) {
+    double kat_us = 0.0;
+    for (const auto& kat : report.known_answer_tests) {
+        kat_us += kat.duration_us;
+    }
+
+    std::printf("%s self_test=%d single_core_hps=%.0f all_core_hps=%.0f "
+                "hash_latency_ns=%.1f kat_us=%.1f mem_read_bps=%.0f mem_latency_ns=%.1f score=%.0f\n",
+                label,
+                report.self_test_passed ? 1 : 0,
+                report.single_core_hashes_per_sec,
+                report.all_core_hashes_per_sec,
+                report.single_core_hashes_per_sec > 0.0 ? 1e9 / report.single_core_hashes_per_sec : 0.0,
+                kat_us,
+                report.memory_read_bytes_per_sec,
+                report.memory_latency_ns,
+                report.device_score);
+}
+
+template <typename Field>
+double median(std::vector<DiagnosticsReport>& runs, Field field) {
+    std::vector<double> values;
+    values.reserve(runs.size());
+    for (const auto& run : runs) {
+        values.push_back(field(run));
+    }
+    std::sort(values.begin(), values.end());
+    size_t mid = values.size() / 2;
+    return values.size() % 2 ? values[mid] : (values[mid - 1] + values[mid]) / 2.0;
+}
+
+int runKernelBench(size_t iterations) {
+    using TradingAnarchy::KernelDispatchBase;
+
+    std::printf("cpu_features=\"%s\"\n", TradingAnarchy::cpuFeatures().describe().c_str());
+    bool all_passed = true;
+
+    for (KernelDispatchBase* kernel : TradingAnarchy::kernelRegistry()) {
+        const auto& workload = kernel->workload();
+        if (!workload) {
+            continue;
+        }
+
+        bool selection_ok = std::strcmp(kernel->selectedVariant(), kernel->preferredVariant()) == 0;
+        std::printf("kernel=%s selected=%s preferred=%s selection_ok=%d\n",
+                    kernel->kernelName(), kernel->selectedVariant(),
+                    kernel->preferredVariant(), selection_ok ? 1 : 0);
+        all_passed = all_passed && selection_ok;
+
+        // The baseline is listed last and always supported
+        std::vector<KernelDispatchBase::VariantInfo> variants = kernel->variants();
+        kernel->force(variants.back().name);
+        uint64_t expected = workload(iterations);
+        double baseline_ns = 0.0;
+        bool baseline = true;
+
+        for (auto it = variants.rbegin(); it != variants.rend(); ++it) {
+            if (!it->supported) {
+                std::printf("variant kernel=%s name=%s supported=0\n", kernel->kernelName(), it->name);
+                continue;
+            }
+
+            kernel->force(it->name);
+            workload(iterations / 10 + 1);    // warm-up
+
+            auto start = std::chrono::steady_clock::now();
+            uint64_t checksum = workload(iterations);
+            double elapsed_ns = std::chrono::duration<double, std::nano>(
+                std::chrono::steady_clock::now() - start).count();
+
+            double ns_per_call = elapsed_ns / static_cast<double>(iterations);
+            if (baseline) {
+                baseline_ns = ns_per_call;
+            }
+
+            double speedup = baseline_ns / ns_per_call;
+            bool gain = baseline || speedup > 1.0;
+            bool match = checksum == expected;
+            all_passed = all_passed && match && gain;
+            std::printf("variant kernel=%s name=%s supported=1 ns_per_call=%.1f speedup=%.2f gain=%d match=%d\n",
+                        kernel->kernelName(), it->name, ns_per_call, speedup, gain ? 1 : 0, match ? 1 : 0);
+            baseline = false;
+        }
+
+        kernel->reset();
+    }
+
+    return all_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/**
+ * Professional throughput of one hash over `size`-byte inputs, in MB/s
+ */
+template <typename Hash>
+double throughputMBps(const std::vector<uint8_t>& input, size_t size, size_t total_bytes, Hash hash) {
+    size_t iterations = std::max<size_t>(1, total_bytes / size);
+    hash(input.data(), size);    // warm-up
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        hash(input.data(), size);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return static_cast<double>(iterations * size) / seconds / 1e6;
+}
+
+int runHashBench(size_t megabytes) {
+    using namespace TradingAnarchy;
+
+    static const size_t kSizes[] = {64, 1024, 16 * 1024, 256 * 1024, 1024 * 1024, 16 * 1024 * 1024};
+    size_t total_bytes = megabytes * 1024 * 1024;
+
+    std::vector<uint8_t> input(kSizes[sizeof(kSizes) / sizeof(kSizes[0]) - 1]);
+    for (size_t i = 0; i < input.size(); ++i) {
+        input[i] = static_cast<uint8_t>(i * 131 + (i >> 8));
+    }
+
+    std::printf("blake3_variant=%s parallel_threshold=%zu keccak_variant=%s keccak_batch_variant=%s\n",
+                Blake3::hashManyKernel().selectedVariant(), Blake3::kParallelThreshold,
+                Keccak::permutationKernel().selectedVariant(), Keccak::batchPermutationKernel().selectedVariant());
+
+    uint8_t digest[EVP_MAX_MD_SIZE];
+    for (size_t size : kSizes) {
+        double sha256 = throughputMBps(input, size, total_bytes, [&](const uint8_t* data, size_t length) {
+            unsigned int digest_len = 0;
+            EVP_Digest(data, length, digest, &digest_len, EVP_sha256(), nullptr);
+        });
+        double blake3 = throughputMBps(input, size, total_bytes, [&](const uint8_t* data, size_t length) {
+            Blake3::hashSerial(data, length, digest);
+        });
+        double blake3_parallel = throughputMBps(input, size, total_bytes, [&](const uint8_t* data, size_t length) {
+            Blake3::hash(data, length, digest);
+        });
+
+        double sha3 = throughputMBps(input, size, total_bytes, [&](const uint8_t* data, size_t length) {
+            Keccak::sha3_256(data, length, digest);
+        });
+        // Each call hashes kBatchWays messages of `size` bytes
+        uint8_t batch_digests[Keccak::kBatchWays * Keccak::kDigestBytes];
+        double sha3_batch = Keccak::kBatchWays * throughputMBps(
+            input, size, total_bytes / Keccak::kBatchWays, [&](const uint8_t* data, size_t length) {
+                const uint8_t* inputs[Keccak::kBatchWays];
+                size_t lengths[Keccak::kBatchWays];
+                std::fill(inputs, inputs + Keccak::kBatchWays, data);
+                std::fill(lengths, lengths + Keccak::kBatchWays, length);
+                Keccak::sha3_256Many(inputs, lengths, Keccak::kBatchWays, batch_digests);
+            });
+
+        std::printf("hash size=%zu sha256_mbps=%.1f blake3_mbps=%.1f blake3_parallel_mbps=%.1f "
+                    "speedup=%.2f parallel_speedup=%.2f sha3_mbps=%.1f sha3_batch_mbps=%.1f batch_speedup=%.2f\n",
+                    size, sha256, blake3, blake3_parallel, blake3 / sha256, blake3_parallel / sha256,
+                    sha3, sha3_batch, sha3_batch / sha3);
+    }
+    return EXIT_SUCCESS;
+}
+
+int runScratchpadBench(double seconds) {
+    using namespace TradingAnarchy;
+
+    std::printf("scratchpad_variant=%s\n", Scratchpad::mainLoopKernel().selectedVariant());
+
+    auto print = [](const char* label, const Scratchpad::BenchResult& result) {
+        std::printf("%s bytes=%zu threads=%u hps=%.1f ns_per_iteration=%.2f pages=%s\n",
+                    label, result.scratchpad_bytes, result.threads, result.hashes_per_sec,
+                    result.ns_per_iteration, LargePageBuffer::modeName(result.page_mode));
+    };
+    for (const Scratchpad::BenchResult& result : Scratchpad::sweep(seconds)) {
+        print("sweep", result);
+    }
+    print("all_cores", Scratchpad::benchmark(Scratchpad::kMaxBytes, 0, seconds));
+    return EXIT_SUCCESS;
+}
+
+int runAesBench() {
+    using namespace TradingAnarchy;
+
+    const AesRound::Selection& aes = AesRound::selection();
+    std::printf("aes_variant=%s hardware_supported=%d hardware_preferred=%d "
+                "hardware_ns_per_round=%.3f soft_ns_per_round=%.3f\n",
+                aes.variant.c_str(), aes.hardware_supported ? 1 : 0, aes.hardware_preferred ? 1 : 0,
+                aes.hardware_ns_per_round, aes.soft_ns_per_round);
+    return EXIT_SUCCESS;
+}
+
+int runMemoryBench() {
+    using namespace TradingAnarchy;
+
+    MemoryProbe::Hierarchy memory = MemoryProbe::probe();
+    for (const MemoryProbe::LatencyPoint& point : memory.latency) {
+        std::printf("latency bytes=%zu ns=%.2f\n", point.bytes, point.ns_per_load);
+    }
+    for (const MemoryProbe::BandwidthPoint& point : memory.bandwidth) {
+        std::printf("bandwidth threads=%u bps=%.0f\n", point.threads, point.bytes_per_sec);
+    }
+    std::printf("l1=%llu l2=%llu l3=%llu memory_latency_ns=%.1f peak_bps=%.0f saturation_threads=%u duration_ms=%.0f\n",
+                static_cast<unsigned long long>(memory.l1_cache),
+                static_cast<unsigned long long>(memory.l2_cache),
+                static_cast<unsigned long long>(memory.l3_cache),
+                memory.memory_latency_ns, memory.peak_bytes_per_sec, memory.saturation_threads,
+                memory.duration_ms);
+    return EXIT_SUCCESS;
+}
+
+int runPlanBench(int argc, char** argv) {
+    using namespace TradingAnarchy;
+
+    std::vector<std::string> algorithms(argv, argv + argc);
+    if (algorithms.empty()) {
+        algorithms = {"rx/0", "rx/wow", "rx/arq", "cn/r", "cn-lite/1", "cn-heavy/0", "cn-pico",
+                      "argon2/chukwav2", "ghostrider"};
+    }
+
+    for (const std::string& algorithm : algorithms) {
+        ThreadPlanner::Plan plan = ThreadPlanner::plan(algorithm);
+        std::printf("plan algorithm=%s scratchpad=%zu threads=%u relative=%.2f all_cores=%.2f "
+                    "limited_by=%s source=%s cpus=",
+                    plan.algorithm.c_str(), plan.scratchpad_bytes, plan.threads, plan.relative_throughput,
+                    plan.all_cores_relative_throughput, plan.limited_by.c_str(), plan.topology_source.c_str());
+        for (size_t i = 0; i < plan.cpus.size(); ++i) {
+            std::printf(i == 0 ? "%u" : ",%u", plan.cpus[i]);
+        }
+        std::printf(" predicted=");
+        for (size_t i = 0; i < plan.predicted.size(); ++i) {
+            std::printf(i == 0 ? "%.2f" : ",%.2f", plan.predicted[i]);
+        }
+        std::printf("\n");
+    }
+    std::printf("topology_load_ms=%.1f\n", ThreadPlanner::topology().load_ms);
+    return EXIT_SUCCESS;
+}
+
+int runTopologyBench(const char* directory) {
+    using namespace TradingAnarchy;
+
+    ThreadPlanner::setCacheDirectory(directory);
+    const ThreadPlanner::Topology& topology = ThreadPlanner::topology();
+    std::printf("topology cpus=%zu caches=%zu from_cache=%d load_ms=%.2f discovery_ms=%.2f\n",
+                topology.cpus.size(), topology.caches.size(), topology.from_cache ? 1 : 0,
+                topology.load_ms, topology.discovery_ms);
+    return EXIT_SUCCESS;
+}
+
+int runSharesBench(size_t count) {
+    using namespace TradingAnarchy;
+
+    ShareVerifier::Job job;
+    job.job_id = "bench-1";
+    job.blob.assign(76, 0);
+    for (size_t i = 0; i < job.blob.size(); ++i) {
+        job.blob[i] = static_cast<uint8_t>(i * 131 + 7);
+    }
+    job.target = ShareVerifier::targetFromHex("ffffff7f");     // difficulty 2
+    job.scratchpad_bytes = Scratchpad::kMinBytes;
+
+    std::atomic<uint64_t> accepted{0};
+    ShareVerifier verifier([&accepted](const ShareVerifier::Candidate&) {
+        accepted.fetch_add(1, std::memory_order_relaxed);
+    });
+    verifier.setJob(job);
+
+    // Workers' side: hash every nonce once, then mix in the bad cases
+    LargePageBuffer scratchpad(job.scratchpad_bytes);
+    std::vector<uint8_t> blob = job.blob;
+    std::array<uint64_t, ShareVerifier::kReasonCount> expected{};
+    uint64_t expected_submitted = 0;
+
+    auto started = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < count; ++i) {
+        ShareVerifier::Candidate candidate;
+        candidate.job_id = job.job_id;
+        candidate.nonce = static_cast<uint32_t>(i);
+        candidate.worker = static_cast<uint32_t>(i % 4);
+        std::memcpy(blob.data() + job.nonce_offset, &candidate.nonce, sizeof(candidate.nonce));
+        Scratchpad::hash(blob.data(), blob.size(), scratchpad.data(), job.scratchpad_bytes,
+                         candidate.hash.data());
+
+        ShareVerifier::Reason reason = ShareVerifier::Reason::COUNT;
+        switch (i % 10) {
+        case 7:
+            candidate.job_id = "bench-0";
+            reason = ShareVerifier::Reason::STALE;
+            break;
+        case 8:
+            // The corrupted copy must not claim the nonce; the correct one follows
+            candidate.hash[0] ^= 0x80;
+            verifier.enqueue(candidate);
+            ++expected[static_cast<size_t>(ShareVerifier::Reason::HASH_MISMATCH)];
+            candidate.hash[0] ^= 0x80;
+            if (!ShareVerifier::meetsTarget(candidate.hash.data(), job.target)) {
+                reason = ShareVerifier::Reason::LOW_DIFFICULTY;
+            }
+            break;
+        default:
+            if (!ShareVerifier::meetsTarget(candidate.hash.data(), job.target)) {
+                reason = ShareVerifier::Reason::LOW_DIFFICULTY;
+            }
+            break;
+        }
+        verifier.enqueue(candidate);
+        if (reason == ShareVerifier::Reason::COUNT) {
+            ++expected_submitted;
+        } else {
+            ++expected[static_cast<size_t>(reason)];
+        }
+
+        if (i % 10 == 9) {
+            // Resubmitting a verified nonce, whether or not it met the target
+            verifier.enqueue(candidate);
+            ++expected[static_cast<size_t>(ShareVerifier::Reason::DUPLICATE_NONCE)];
+        }
+    }
+    verifier.drain();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+
+    ShareVerifier::Stats stats = verifier.stats();
+    bool ok = stats.submitted == expected_submitted && accepted.load() == expected_submitted &&
+              stats.rejected == expected && stats.dropped == 0;
+    std::printf("shares enqueued=%llu verified=%llu submitted=%llu batches=%llu mean_batch=%.1f "
+                "hash_us=%.1f seconds=%.2f",
+                static_cast<unsigned long long>(stats.enqueued),
+                static_cast<unsigned long long>(stats.verified),
+                static_cast<unsigned long long>(stats.submitted),
+                static_cast<unsigned long long>(stats.batches), stats.mean_batch_size, stats.hash_us,
+                seconds);
+    for (size_t i = 0; i < ShareVerifier::kReasonCount; ++i) {
+        std::printf(" %s=%llu/%llu", ShareVerifier::reasonName(static_cast<ShareVerifier::Reason>(i)),
+                    static_cast<unsigned long long>(stats.rejected[i]),
+                    static_cast<unsigned long long>(expected[i]));
+    }
+    std::printf(" ok=%d\n", ok ? 1 : 0);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int runWatchdogBench() {
+    using namespace TradingAnarchy;
+    using Watchdog = HashrateWatchdog;
+
+    constexpr uint32_t kWorkers = 4;
+    const int32_t tid = static_cast<int32_t>(syscall(SYS_gettid));
+    std::atomic<uint32_t> restarts{0};
+    std::atomic<uint32_t> repins{0};
+
+    Watchdog watchdog;
+    Watchdog::Remediation remediation;
+    remediation.worker_tid = [tid](uint32_t) { return tid; };
+    remediation.restart_worker = [&restarts](uint32_t) { restarts++; return true; };
+    remediation.repin_worker = [&repins](uint32_t, uint32_t) { repins++; return true; };
+    watchdog.setRemediation(remediation);
+
+    // Per-worker level over the trace: a stall, one slow worker, then every worker halved
+    std::mt19937 rng(42);
+    std::normal_distribution<double> noise(0.0, 3.0);
+    auto level = [](uint32_t worker, int second) {
+        if (worker == 1 && second >= 200 && second < 210) {
+            return 0.0;
+        }
+        double hps = worker == 2 && second >= 300 ? 70.0 : 100.0;
+        return second >= 700 ? hps / 2.0 : hps;
+    };
+
+    auto wait_for_captures = [&watchdog](uint64_t captures) {
+        for (int i = 0; i < 100 && watchdog.report().captures < captures; ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        }
+    };
+
+    for (int second = 0; second < 800; ++second) {
+        LiveMetricsSnapshot snapshot;
+        snapshot.timestamp_ms = second * 1000.0;
+        snapshot.thread_count = kWorkers;
+        for (uint32_t worker = 0; worker < kWorkers; ++worker) {
+            double hps = level(worker, second);
+            snapshot.thread_hashrate[worker] = hps > 0.0 ? std::max(0.0, hps + noise(rng)) : 0.0;
+        }
+        watchdog.observe(snapshot);
+        if (second == 250 || second == 450) {
+            wait_for_captures(second == 250 ? 1 : 2);
+        }
+    }
+    wait_for_captures(3);
+    watchdog.shutdown();
+
+    Watchdog::Report report = watchdog.report();
+    for (const Watchdog::Bundle& bundle : report.bundles) {
+        size_t counters = std::count_if(bundle.perf.begin(), bundle.perf.end(),
+                                        [](const Watchdog::PerfCounter& c) { return c.available; });
+        std::printf("bundle kind=%s worker=%d t=%.0f baseline=%.1f recent=%.1f p=%.2g recommended=%s "
+                    "remediated=%d counters=%zu/%zu thermal=%zu cpus=%zu threads=%zu capture_ms=%.0f reason=\"%s\"\n",
+                    Watchdog::kindName(bundle.anomaly.kind),
+                    bundle.anomaly.worker == Watchdog::kAllWorkers ? -1 : static_cast<int>(bundle.anomaly.worker),
+                    bundle.anomaly.timestamp_ms / 1000.0, bundle.anomaly.baseline_hps, bundle.anomaly.recent_hps,
+                    bundle.anomaly.p_value, Watchdog::actionName(bundle.recommended), bundle.remediated ? 1 : 0,
+                    counters, bundle.perf.size(), bundle.thermal.size(), bundle.frequencies.size(),
+                    bundle.threads.size(), bundle.capture_ms, bundle.reason.c_str());
+    }
+
+    bool ok = report.bundles.size() == 3 &&
+              report.bundles[0].anomaly.kind == Watchdog::Kind::STALL && report.bundles[0].anomaly.worker == 1 &&
+              report.bundles[1].anomaly.kind == Watchdog::Kind::DROP && report.bundles[1].anomaly.worker == 2 &&
+              report.bundles[2].anomaly.kind == Watchdog::Kind::DROP &&
+              report.bundles[2].anomaly.worker == Watchdog::kAllWorkers && restarts.load() == 1;
+    std::printf("watchdog samples=%llu stalls=%llu drops=%llu captures=%llu remediations=%llu "
+                "restarts=%u repins=%u device_baseline=%.1f ok=%d\n",
+                static_cast<unsigned long long>(report.samples), static_cast<unsigned long long>(report.stalls),
+                static_cast<unsigned long long>(report.drops), static_cast<unsigned long long>(report.captures),
+                static_cast<unsigned long long>(report.remediations), restarts.load(), repins.load(),
+                report.device_baseline_hps, ok ? 1 : 0);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int runSimulateBench(double multiplier, double seconds) {
+    using namespace TradingAnarchy;
+    using Simulator = TelemetrySimulator;
+
+    constexpr size_t kStale = static_cast<size_t>(ShareVerifier::Reason::STALE);
+
+    ShareVerifier verifier(nullptr);
+    std::array<std::atomic<uint64_t>, ShareVerifier::kReasonCount + 1> expected{};
+    std::atomic<uint64_t> disconnects{0};
+
+    Simulator::Sink sink;
+    sink.share = [&](const Simulator::Share& share) {
+        expected[static_cast<size_t>(share.expected)].fetch_add(1, std::memory_order_relaxed);
+        verifier.enqueue(share.candidate);
+    };
+    sink.job = [&verifier](const ShareVerifier::Job& job) { verifier.setJob(job); };
+    sink.connection = [&disconnects](bool connected) {
+        if (!connected) {
+            disconnects.fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+
+    Simulator::Config config;
+    config.seed = 42;
+    config.rate_multiplier = multiplier;
+    config.hash_mismatch_fraction = 0.01;
+    config.disconnects_per_hour = 30.0;
+
+    Simulator simulator(sink);
+    if (!simulator.start(config)) {
+        std::printf("simulate start failed ok=0\n");
+        return EXIT_FAILURE;
+    }
+    std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+    simulator.stop();
+    verifier.drain();
+
+    Simulator::Stats stats = simulator.stats();
+    for (size_t i = 0; i < Simulator::kEventTypeCount; ++i) {
+        std::printf("event type=%s count=%llu rate_hz=%.1f sink_mean_us=%.1f sink_max_us=%.1f\n",
+                    Simulator::eventName(static_cast<Simulator::EventType>(i)),
+                    static_cast<unsigned long long>(stats.events[i]), stats.events[i] / stats.wall_seconds,
+                    stats.sink_mean_us[i], stats.sink_max_us[i]);
+    }
+
+    // Job switches can only turn a share stale, never the other way round
+    ShareVerifier::Stats verdicts = verifier.stats();
+    uint64_t late = 0;
+    bool ok = verdicts.dropped == 0 && verdicts.verified == stats.events[static_cast<size_t>(Simulator::EventType::SHARE)];
+    uint64_t valid = expected[ShareVerifier::kReasonCount].load();
+    ok = ok && verdicts.submitted <= valid;
+    late += valid - std::min(valid, verdicts.submitted);
+    for (size_t i = 0; i < ShareVerifier::kReasonCount; ++i) {
+        if (i == kStale) {
+            continue;
+        }
+        ok = ok && verdicts.rejected[i] <= expected[i].load();
+        late += expected[i].load() - std::min(expected[i].load(), verdicts.rejected[i]);
+    }
+    ok = ok && verdicts.rejected[kStale] == expected[kStale].load() + late;
+
+    std::printf("simulate multiplier=%.0f wall_s=%.2f simulated_s=%.0f shares=%llu submitted=%llu/%llu",
+                stats.rate_multiplier, stats.wall_seconds, stats.simulated_seconds,
+                static_cast<unsigned long long>(verdicts.verified),
+                static_cast<unsigned long long>(verdicts.submitted), static_cast<unsigned long long>(valid));
+    for (size_t i = 0; i < ShareVerifier::kReasonCount; ++i) {
+        std::printf(" %s=%llu/%llu", ShareVerifier::reasonName(static_cast<ShareVerifier::Reason>(i)),
+                    static_cast<unsigned long long>(verdicts.rejected[i]),
+                    static_cast<unsigned long long>(expected[i].load()));
+    }
+    std::printf(" late_stale=%llu lost=%llu disconnects=%llu max_lag_ms=%.2f ok=%d\n",
+                static_cast<unsigned long long>(late), static_cast<unsigned long long>(stats.lost_shares),
+                static_cast<unsigned long long>(disconnects.load()), stats.max_lag_ms, ok ? 1 : 0);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int runRegressionBench(const char* directory, uint32_t repetitions, bool update_baseline) {
+    using namespace TradingAnarchy;
+
+    RegressionBench::Options options;
+    options.directory = directory;
+    options.repetitions = repetitions;
+    options.update_baseline = update_baseline;
+    if (const char* celsius = std::getenv("TA_BENCH_COOLDOWN_C")) {
+        options.cooldown_celsius = std::atof(celsius);
+    }
+
+    RegressionBench::Result result = RegressionBench::run(options);
+    for (size_t i = 0; i < result.hashrates.size(); ++i) {
+        std::printf("rep index=%zu hps=%.2f start_c=%.1f\n", i, result.hashrates[i],
+                    i < result.start_celsius.size() ? result.start_celsius[i] : std::nan(""));
+    }
+    std::printf("regress key=%s checksum=%s pinned=%d thermal=%d cooldown_s=%.0f median=%.2f "
+                "baseline_n=%zu baseline_median=%.2f u=%.1f p=%.4g exact=%d rank_biserial=%.3f "
+                "shift=%.2f relative_shift=%+.2f%% verdict=%s baseline_updated=%d seconds=%.1f%s%s\n",
+                result.key.c_str(), result.checksum.c_str(), result.pinned ? 1 : 0,
+                result.thermal_available ? 1 : 0, result.cooldown_seconds, result.summary.median,
+                result.baseline.size(), BenchStats::summarize(result.baseline).median, result.test.u,
+                result.test.p_value, result.test.exact ? 1 : 0, result.test.rank_biserial, result.test.shift,
+                result.test.relative_shift * 100.0, RegressionBench::verdictName(result.verdict),
+                result.baseline_updated ? 1 : 0, result.duration_seconds,
+                result.error.empty() ? "" : " error=", result.error.c_str());
+    bool ok = result.verdict == RegressionBench::Verdict::PASS ||
+              result.verdict == RegressionBench::Verdict::NO_BASELINE;
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int runPromiseBench(uint32_t threads, size_t cycles) {
+    using Slab = TradingAnarchy::PromiseSlab<uint64_t, 256>;
+    using Clock = Slab::Clock;
+
+    auto slab = std::make_unique<Slab>();
+    const size_t total = static_cast<size_t>(threads) * cycles;
+    std::vector<std::atomic<uint8_t>> settled(total);
+    std::vector<std::atomic<uint8_t>> inserted(total);
+
+    std::atomic<uint64_t> taken{0};
+    std::atomic<uint64_t> reaped{0};
+    std::atomic<uint64_t> full{0};
+    std::atomic<uint64_t> stale_taken{0};
+    std::atomic<uint64_t> mismatched{0};
+    std::atomic<bool> done{false};
+
+    auto settle = [&](uint64_t id) {
+        if (id < total) {
+            settled[id].fetch_add(1, std::memory_order_relaxed);
+        } else {
+            mismatched.fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+
+    std::thread reaper([&] {
+        while (!done.load(std::memory_order_acquire)) {
+            reaped.fetch_add(slab->reapExpired(Clock::now(), settle), std::memory_order_relaxed);
+        }
+    });
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (uint32_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            const auto expired = Clock::now() - std::chrono::seconds(1);
+            const auto pending = Clock::now() + std::chrono::hours(1);
+            for (size_t i = 0; i < cycles; ++i) {
+                uint64_t id = static_cast<uint64_t>(t) * cycles + i;
+                bool expires = i % 16 == 0;
+                Slab::Handle handle = slab->insert(id, expires ? expired : pending);
+                if (handle == Slab::kInvalidHandle) {
+                    full.fetch_add(1, std::memory_order_relaxed);
+                    continue;
+                }
+                inserted[id].store(1, std::memory_order_relaxed);
+                if (expires) {
+                    std::this_thread::yield();  // give the reaper a chance at it
+                }
+
+                if (auto value = slab->take(handle)) {
+                    if (*value != id) {
+                        mismatched.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    settle(*value);
+                    taken.fetch_add(1, std::memory_order_relaxed);
+                }
+                if (slab->take(handle)) {
+                    stale_taken.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    done.store(true, std::memory_order_release);
+    reaper.join();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    size_t drained = 0;
+    slab->drain([&](uint64_t id) {
+        settle(id);
+        ++drained;
+    });
+
+    uint64_t lost = 0;
+    uint64_t doubled = 0;
+    for (size_t id = 0; id < total; ++id) {
+        uint8_t count = settled[id].load(std::memory_order_relaxed);
+        uint8_t expected = inserted[id].load(std::memory_order_relaxed);
+        lost += count < expected ? 1 : 0;
+        doubled += count > expected ? 1 : 0;
+    }
+
+    bool ok = lost == 0 && doubled == 0 && stale_taken.load() == 0 && mismatched.load() == 0 &&
+              drained == 0 && slab->inFlight() == 0;
+    std::printf("promises threads=%u cycles=%zu taken=%llu reaped=%llu full=%llu stale_taken=%llu "
+                "mismatched=%llu lost=%llu double_settled=%llu drained=%zu in_flight=%zu "
+                "mcycles_per_s=%.2f ok=%d\n",
+                threads, total, static_cast<unsigned long long>(taken.load()),
+                static_cast<unsigned long long>(reaped.load()), static_cast<unsigned long long>(full.load()),
+                static_cast<unsigned long long>(stale_taken.load()),
+                static_cast<unsigned long long>(mismatched.load()), static_cast<unsigned long long>(lost),
+                static_cast<unsigned long long>(doubled), drained, slab->inFlight(),
+                seconds > 0.0 ? total / seconds / 1e6 : 0.0, ok ? 1 : 0);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc > 1 && std::strcmp(argv[1], "kernels") == 0) {
+        long kernel_iterations = argc > 2 ? std::atol(argv[2]) : 200000;
+        return runKernelBench(static_cast<size_t>(std::max(1L, kernel_iterations)));
+    }
+
+    if (argc > 1 && std::strcmp(argv[1], "hashes") == 0) {
+        long megabytes = argc > 2 ? std::atol(argv[2]) : 64;
+        return runHashBench(static_cast<size_t>(std::max(1L, megabytes)));
+    }
+
+    if (argc > 1 && std::strcmp(argv[1], "scratchpad") == 0) {
+        double seconds = argc > 2 ? std::atof(argv[2]) : 1.0;
+        return runScratchpadBench(std::max(0.1, seconds));
+    }
+
+    if (argc > 1 && std::strcmp(argv[1], "aes") == 0) {
+        return runAesBench();
+    }
+
+    if (argc > 1 && std::strcmp(argv[1], "memory") == 0) {
+        return runMemoryBench();
+    }
+
+    if (argc > 1 && std::strcmp(argv[1], "plan") == 0) {
+        return runPlanBench(argc - 2, argv + 2);
+    }
+
+    if (argc > 1 && std::strcmp(argv[1], "topology") == 0) {
+        return runTopologyBench(argc > 2 ? argv[2] : ".");
+    }
+
+    if (argc > 1 && std::strcmp(argv[1], "shares") == 0) {
+        long candidates = argc > 2 ? std::atol(argv[2]) : 2000;
+        return runSharesBench(static_cast<size_t>(std::max(1L, candidates)));
+    }
+
+    if (argc > 1 && std::strcmp(argv[1], "watchdog") == 0) {
+        return runWatchdogBench();
+    }
+
+    if (argc > 1 && std::strcmp(argv[1], "simulate") == 0) {
+        double multiplier = argc > 2 ? std::atof(argv[2]) : 100.0;
+        double seconds = argc > 3 ? std::atof(argv[3]) : 5.0;
+        return runSimulateBench(std::max(1.0, multiplier), std::max(0.5, seconds));
+    }
+
+    if (argc > 1 && std::strcmp(argv[1], "promises") == 0) {
+        long threads = argc > 2 ? std::atol(argv[2]) : 8;
+        long cycles = argc > 3 ? std::atol(argv[3]) : 200000;
+        return runPromiseBench(static_cast<uint32_t>(std::max(1L, threads)),
+                               static_cast<size_t>(std::max(1L, cycles)));
+    }
+
+    if (argc > 1 && (std::strcmp(argv[1], "regress") == 0 || std::strcmp(argv[1], "regress-baseline") == 0)) {
+        long repetitions = argc > 3 ? std::atol(argv[3]) : 10;
+        return runRegressionBench(argc > 2 ? argv[2] : ".", static_cast<uint32_t>(std::max(2L, repetitions)),
+                                  std::strcmp(argv[1], "regress-baseline") == 0);
+    }
+    
+    int iterations = argc > 1 ? std::atoi(argv[1]) : 5;
+    iterations = std::max(1, iterations);
+
+    std::vector<DiagnosticsReport> runs;
+    bool all_passed = true;
+
+    for (int i = 0; i < iterations; ++i) {
+        runs.push_back(TradingAnarchy::Diagnostics::runBattery());
+        printReport("run", runs.back());
+        all_passed = all_passed && runs.back().self_test_passed;
+    }
+
+    DiagnosticsReport summary;
+    summary.self_test_passed = all_passed;
+    summary.single_core_hashes_per_sec =
+        median(runs, [](const DiagnosticsReport& r) { return r.single_core_hashes_per_sec; });
+    summary.all_core_hashes_per_sec =
+        median(runs, [](const DiagnosticsReport& r) { return r.all_core_hashes_per_sec; });
+    summary.memory_read_bytes_per_sec =
+        median(runs, [](const DiagnosticsReport& r) { return r.memory_read_bytes_per_sec; });
+    summary.memory_latency_ns =
+        median(runs, [](const DiagnosticsReport& r) { return r.memory_latency_ns; });
+    summary.device_score =
+        median(runs, [](const DiagnosticsReport& r) { return r.device_score; });
+
+    double kat_us = median(runs, [](const DiagnosticsReport& r) {
+        double total = 0.0;
+        for (const auto& kat : r.known_answer_tests) {
+            total += kat.duration_us;
+        }
+        return total;
+    });
+    summary.known_answer_tests.push_back({"total", all_passed, kat_us});
+
+    printReport("median", summary);
+    return all_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
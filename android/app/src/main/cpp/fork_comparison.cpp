@@ -0,0 +1,181 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Fork Comparison - A/B Harness for the Upstream and MoneroOcean Miners
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#include "fork_comparison.h"
+#include "xmrig_bench.h"
+#include "xmrig_launcher.h"
+#include "trading_anarchy_jni.h"
+
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+namespace TradingAnarchy {
+namespace ForkComparison {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr char kWinnerFile[] = "/xmrig-fork-ab.tsv";
+
+ForkSamples prepare(const ComparisonOptions& options, const char* binary_base) {
+    Launcher::Selection selection = Launcher::selectBinary(options.native_lib_dir, binary_base);
+    ForkSamples samples;
+    samples.binary_base = binary_base;
+    samples.file_name = selection.file_name;
+    samples.variant = selection.variant->name;
+    return samples;
+}
+
+/**
+ * Professional single run; returns false when the comparison must stop
+ */
+bool benchOnce(const ComparisonOptions& options, ForkSamples& fork) {
+    XmrigBench::BenchOptions bench;
+    bench.binary_path = options.native_lib_dir + "/" + fork.file_name;
+    bench.algorithm = options.algorithm;
+    bench.size = options.size;
+    bench.threads = options.threads;
+    bench.affinity = options.affinity;
+
+    XmrigBench::BenchResult result = XmrigBench::run(bench);
+    if (result.success) {
+        fork.hashrates.push_back(result.hashrate);
+        if (fork.hash_sum.empty()) {
+            fork.hash_sum = result.hash_sum;
+        }
+        return true;
+    }
+
+    fork.failures++;
+    fork.last_error = result.error;
+    TA_LOGW("Fork comparison run failed for %s: %s", fork.file_name.c_str(), result.error.c_str());
+    return result.error != "cancelled" && result.error != "busy";
+}
+
+} // namespace
+
+ComparisonResult compare(const ComparisonOptions& options) {
+    ComparisonResult result;
+    auto started = Clock::now();
+
+    result.upstream = prepare(options, kUpstreamBinary);
+    result.moneroocean = prepare(options, kMoneroOceanBinary);
+
+    TA_LOGI("Comparing %s vs %s on %s --bench=%s, %u repetitions",
+            result.upstream.file_name.c_str(), result.moneroocean.file_name.c_str(),
+            options.algorithm.c_str(), options.size.c_str(), options.repetitions);
+
+    bool keep_going = true;
+    bool first_run = true;
+    for (uint32_t rep = 0; rep < options.repetitions && keep_going; ++rep) {
+        // ABBA: alternate which fork runs first in each repetition
+        ForkSamples* order[2] = {&result.upstream, &result.moneroocean};
+        if (rep % 2) {
+            std::swap(order[0], order[1]);
+        }
+
+        for (ForkSamples* fork : order) {
+            if (!first_run && options.cooldown.count() > 0) {
+                std::this_thread::sleep_for(options.cooldown);
+            }
+            first_run = false;
+
+            keep_going = benchOnce(options, *fork);
+            if (!keep_going) {
+                result.error = fork->last_error;
+                break;
+            }
+        }
+    }
+
+    result.upstream.summary = BenchStats::summarize(result.upstream.hashrates);
+    result.moneroocean.summary = BenchStats::summarize(result.moneroocean.hashrates);
+    result.test = BenchStats::welchTest(result.upstream.hashrates, result.moneroocean.hashrates);
+    result.hashes_agree = !result.upstream.hash_sum.empty() &&
+                          result.upstream.hash_sum == result.moneroocean.hash_sum;
+    result.duration_seconds = std::chrono::duration<double>(Clock::now() - started).count();
+
+    if (result.upstream.hashrates.size() < 2 || result.moneroocean.hashrates.size() < 2) {
+        if (result.error.empty()) {
+            result.error = "fewer than two successful runs per fork";
+        }
+        return result;
+    }
+
+    result.success = true;
+    result.significant = result.test.p_value < options.alpha;
+    if (!result.hashes_agree) {
+        TA_LOGW("Fork hash sums differ (%s vs %s) - no winner declared",
+                result.upstream.hash_sum.c_str(), result.moneroocean.hash_sum.c_str());
+    } else if (result.significant) {
+        result.winner = result.test.difference > 0.0 ? kMoneroOceanBinary : kUpstreamBinary;
+    }
+
+    TA_LOGI("Fork comparison: %.1f vs %.1f H/s (%+.2f%%, p=%.4f) winner=%s",
+            result.upstream.summary.mean, result.moneroocean.summary.mean,
+            result.test.relative_difference * 100.0, result.test.p_value,
+            result.winner.empty() ? "none" : result.winner.c_str());
+    return result;
+}
+
+bool saveWinner(const std::string& directory, const std::string& algorithm, const ComparisonResult& result) {
+    if (!result.success) {
+        return false;
+    }
+
+    std::string path = directory + kWinnerFile;
+    std::ostringstream kept;
+    {
+        std::ifstream in(path);
+        std::string line;
+        while (std::getline(in, line)) {
+            if (line.compare(0, algorithm.size() + 1, algorithm + "\t") != 0) {
+                kept << line << '\n';
+            }
+        }
+    }
+
+    // algorithm, winner ("-" for none), relative difference, p-value, unix time
+    char entry[256];
+    std::snprintf(entry, sizeof(entry), "%s\t%s\t%.6f\t%.6g\t%lld\n",
+                  algorithm.c_str(), result.winner.empty() ? "-" : result.winner.c_str(),
+                  result.test.relative_difference, result.test.p_value,
+                  static_cast<long long>(std::time(nullptr)));
+
+    std::string temp = path + ".tmp";
+    {
+        std::ofstream out(temp, std::ios::trunc);
+        out << kept.str() << entry;
+        if (!out) {
+            return false;
+        }
+    }
+    return std::rename(temp.c_str(), path.c_str()) == 0;
+}
+
+std::string preferredFork(const std::string& directory, const std::string& algorithm) {
+    std::ifstream in(directory + kWinnerFile);
+    std::string line;
+    while (std::getline(in, line)) {
+        std::istringstream fields(line);
+        std::string algo, winner;
+        if (std::getline(fields, algo, '\t') && std::getline(fields, winner, '\t') &&
+            algo == algorithm && winner != "-") {
+            return winner;
+        }
+    }
+    return {};
+}
+
+} // namespace ForkComparison
+} // namespace TradingAnarchy
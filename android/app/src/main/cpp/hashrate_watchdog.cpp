@@ -0,0 +1,719 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Hashrate Watchdog - Per-Worker Anomaly Detection and Diagnostics Capture
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#include "hashrate_watchdog.h"
+#include "bench_stats.h"
+#include "native_executor.h"
+#include "trading_anarchy_jni.h"
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <dirent.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <thread>
+
+namespace TradingAnarchy {
+
+namespace {
+
+constexpr int kMaxThermalZones = 64;
+constexpr double kRecoveryFraction = 1.0 - HashrateWatchdog::kDropFraction / 2.0;
+constexpr double kRepinSpeedup = 1.25;      // another CPU must clock this much higher
+
+constexpr const char* kKindNames[] = {"stall", "drop"};
+constexpr const char* kActionNames[] = {"none", "restartWorker", "repinWorker"};
+
+struct CounterSpec {
+    const char* name;
+    uint32_t type;
+    uint64_t config;
+};
+
+constexpr CounterSpec kCounters[] = {
+    {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {"cacheMisses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+    {"taskClockNs", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK},
+    {"contextSwitches", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES},
+    {"cpuMigrations", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CPU_MIGRATIONS},
+};
+
+double wallClockMs() {
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+}
+
+double median(std::vector<double> values) {
+    if (values.empty()) {
+        return 0.0;
+    }
+    auto middle = values.begin() + values.size() / 2;
+    std::nth_element(values.begin(), middle, values.end());
+    return *middle;
+}
+
+double mean(const std::deque<double>& values) {
+    double sum = 0.0;
+    for (double value : values) {
+        sum += value;
+    }
+    return values.empty() ? 0.0 : sum / values.size();
+}
+
+bool readFirstLine(const char* path, std::string& line) {
+    FILE* file = std::fopen(path, "r");
+    if (!file) {
+        return false;
+    }
+    char buffer[256];
+    bool read = std::fgets(buffer, sizeof(buffer), file) != nullptr;
+    std::fclose(file);
+    if (read) {
+        line = buffer;
+        while (!line.empty() && (line.back() == '\n' || line.back() == '\r')) {
+            line.pop_back();
+        }
+    }
+    return read;
+}
+
+uint64_t readUnsigned(const char* path) {
+    std::string line;
+    return readFirstLine(path, line) ? std::strtoull(line.c_str(), nullptr, 10) : 0;
+}
+
+std::vector<int32_t> processTasks() {
+    std::vector<int32_t> tids;
+    DIR* dir = opendir("/proc/self/task");
+    if (!dir) {
+        return tids;
+    }
+    while (dirent* entry = readdir(dir)) {
+        int32_t tid = std::atoi(entry->d_name);
+        if (tid > 0) {
+            tids.push_back(tid);
+        }
+    }
+    closedir(dir);
+    return tids;
+}
+
+struct TaskSample {
+    std::string name;
+    uint64_t cpu_ticks = 0;
+    int32_t last_cpu = -1;
+    uint64_t involuntary_switches = 0;
+};
+
+/**
+ * Professional /proc/self/task/<tid> reader
+ *
+ * The comm field may hold spaces and parentheses, so fields are counted
+ * from the last ')'. utime and stime are fields 14 and 15, the CPU the
+ * task last ran on is field 39.
+ */
+bool readTask(int32_t tid, TaskSample& sample) {
+    char path[64];
+    std::snprintf(path, sizeof(path), "/proc/self/task/%d/stat", tid);
+    FILE* file = std::fopen(path, "r");
+    if (!file) {
+        return false;
+    }
+    char buffer[1024];
+    size_t length = std::fread(buffer, 1, sizeof(buffer) - 1, file);
+    std::fclose(file);
+    buffer[length] = '\0';
+
+    char* open = std::strchr(buffer, '(');
+    char* close = std::strrchr(buffer, ')');
+    if (!open || !close || close < open) {
+        return false;
+    }
+    sample.name.assign(open + 1, close);
+
+    int field = 2;
+    char* cursor = close + 1;
+    uint64_t utime = 0;
+    uint64_t stime = 0;
+    while (*cursor) {
+        while (*cursor == ' ') {
+            ++cursor;
+        }
+        if (!*cursor) {
+            break;
+        }
+        ++field;
+        char* end = nullptr;
+        if (field == 14) {
+            utime = std::strtoull(cursor, &end, 10);
+        } else if (field == 15) {
+            stime = std::strtoull(cursor, &end, 10);
+        } else if (field == 39) {
+            sample.last_cpu = static_cast<int32_t>(std::strtol(cursor, &end, 10));
+            break;
+        }
+        cursor = std::strchr(cursor, ' ');
+        if (!cursor) {
+            break;
+        }
+    }
+    sample.cpu_ticks = utime + stime;
+
+    std::snprintf(path, sizeof(path), "/proc/self/task/%d/status", tid);
+    file = std::fopen(path, "r");
+    if (file) {
+        char line[256];
+        while (std::fgets(line, sizeof(line), file)) {
+            unsigned long long switches = 0;
+            if (std::sscanf(line, "nonvoluntary_ctxt_switches: %llu", &switches) == 1) {
+                sample.involuntary_switches = switches;
+                break;
+            }
+        }
+        std::fclose(file);
+    }
+    return true;
+}
+
+int openCounter(const CounterSpec& spec, int32_t tid) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = spec.type;
+    attr.config = spec.config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;        // allowed at perf_event_paranoid 2, the Android default
+    attr.exclude_hv = 1;
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, tid, -1, -1, 0));
+}
+
+} // namespace
+
+HashrateWatchdog::HashrateWatchdog() = default;
+
+HashrateWatchdog::~HashrateWatchdog() {
+    shutdown();
+}
+
+void HashrateWatchdog::setRemediation(Remediation remediation) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    remediation_ = std::move(remediation);
+}
+
+void HashrateWatchdog::setAutoRemediate(bool enabled) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto_remediate_ = enabled;
+}
+
+void HashrateWatchdog::restartWindows(Worker& worker) {
+    worker.recent.clear();
+    worker.warmup = 0;
+    worker.stall_run = 0;
+    worker.seen_hashing = false;
+    worker.anomalous = false;
+    worker.anomalous_samples = 0;
+    worker.holding = false;
+}
+
+void HashrateWatchdog::resetWorker(uint32_t worker) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (worker < kMaxWorkers) {
+        workers_[worker] = Worker();
+    }
+}
+
+void HashrateWatchdog::reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    workers_.fill(Worker());
+    worker_count_ = 0;
+}
+
+void HashrateWatchdog::shutdown() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    stopped_ = true;
+    capture_done_.wait(lock, [this] { return !capturing_; });
+}
+
+void HashrateWatchdog::observe(const LiveMetricsSnapshot& snapshot) {
+    std::vector<Anomaly> found;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopped_) {
+            return;
+        }
+        ++samples_;
+
+        // A changed thread count means a new configuration, not an anomaly
+        uint32_t count = std::min(snapshot.thread_count, kMaxWorkers);
+        if (count != worker_count_) {
+            workers_.fill(Worker());
+            worker_count_ = count;
+        }
+
+        for (uint32_t i = 0; i < count; ++i) {
+            observeWorker(i, snapshot.thread_hashrate[i], snapshot.timestamp_ms, found);
+        }
+
+        // Drops are held for kStallSamples: if every worker turns anomalous
+        // meanwhile it is throttling or a cap, and one capture covers all
+        bool all_anomalous = count > 1 && std::all_of(workers_.begin(), workers_.begin() + count,
+                                                      [](const Worker& w) { return w.anomalous; });
+        bool any_held = std::any_of(workers_.begin(), workers_.begin() + count,
+                                    [](const Worker& w) { return w.holding; });
+        if (all_anomalous && any_held) {
+            Anomaly device;
+            device.kind = Kind::DROP;
+            device.worker = kAllWorkers;
+            device.timestamp_ms = snapshot.timestamp_ms;
+            device.p_value = 0.0;
+            for (uint32_t i = 0; i < count; ++i) {
+                Worker& worker = workers_[i];
+                device.baseline_hps += median(std::vector<double>(worker.baseline.begin(), worker.baseline.end()));
+                device.recent_hps += mean(worker.recent);
+                if (worker.holding) {
+                    device.p_value = std::max(device.p_value, worker.held.p_value);
+                    worker.holding = false;
+                }
+            }
+            device.relative_change = device.baseline_hps > 0.0
+                ? device.recent_hps / device.baseline_hps - 1.0 : 0.0;
+            found.push_back(device);
+        } else {
+            for (uint32_t i = 0; i < count; ++i) {
+                Worker& worker = workers_[i];
+                if (worker.holding && ++worker.held_samples >= kStallSamples) {
+                    worker.holding = false;
+                    if (worker.anomalous) {
+                        found.push_back(worker.held);
+                    }
+                }
+            }
+        }
+    }
+
+    for (const Anomaly& anomaly : found) {
+        TA_LOGW("Hashrate watchdog: %s on worker %d, %.1f H/s against a %.1f H/s baseline (p=%.4f)",
+                kindName(anomaly.kind), anomaly.worker == kAllWorkers ? -1 : static_cast<int>(anomaly.worker),
+                anomaly.recent_hps, anomaly.baseline_hps, anomaly.p_value);
+        startCapture(anomaly);
+    }
+}
+
+void HashrateWatchdog::observeWorker(uint32_t index, double hashrate, double now_ms, std::vector<Anomaly>& found) {
+    Worker& worker = workers_[index];
+    if (worker.warmup < kWarmupSamples) {
+        ++worker.warmup;
+        return;
+    }
+
+    worker.seen_hashing = worker.seen_hashing || hashrate > 0.0;
+    worker.recent.push_back(hashrate);
+    if (worker.recent.size() > kWindowSamples) {
+        double aged = worker.recent.front();
+        worker.recent.pop_front();
+        if (!worker.anomalous) {
+            worker.baseline.push_back(aged);
+            if (worker.baseline.size() > kBaselineSamples) {
+                worker.baseline.pop_front();
+            }
+        }
+    }
+
+    bool have_baseline = worker.baseline.size() >= kMinBaselineSamples;
+    double baseline = have_baseline
+        ? median(std::vector<double>(worker.baseline.begin(), worker.baseline.end())) : 0.0;
+    double recent = mean(worker.recent);
+
+    Anomaly anomaly;
+    anomaly.worker = index;
+    anomaly.timestamp_ms = now_ms;
+    anomaly.baseline_hps = baseline;
+
+    bool stalled = worker.seen_hashing && hashrate <= (have_baseline ? kStallFraction * baseline : 0.0);
+    worker.stall_run = stalled ? worker.stall_run + 1 : 0;
+
+    if (worker.anomalous) {
+        bool window_full = worker.recent.size() == kWindowSamples;
+        bool recovered = worker.stall_run == 0 &&
+            (have_baseline ? window_full && recent >= kRecoveryFraction * baseline : hashrate > 0.0);
+        if (recovered) {
+            worker.anomalous = false;
+            worker.anomalous_samples = 0;
+        } else if (++worker.anomalous_samples >= kBaselineSamples) {
+            // Persistent for long enough to be the device's new normal
+            worker.baseline.assign(worker.recent.begin(), worker.recent.end());
+            worker.anomalous = false;
+            worker.anomalous_samples = 0;
+        }
+        return;
+    }
+
+    if (worker.stall_run >= kStallSamples) {
+        anomaly.kind = Kind::STALL;
+        anomaly.recent_hps = hashrate;
+        anomaly.relative_change = have_baseline && baseline > 0.0 ? hashrate / baseline - 1.0 : -1.0;
+        worker.anomalous = true;
+        ++stalls_;
+        found.push_back(anomaly);
+        return;
+    }
+
+    if (!have_baseline || worker.recent.size() < kWindowSamples) {
+        return;
+    }
+    BenchStats::WelchResult welch = BenchStats::welchTest(
+        std::vector<double>(worker.baseline.begin(), worker.baseline.end()),
+        std::vector<double>(worker.recent.begin(), worker.recent.end()));
+    if (welch.p_value < kSignificance && welch.relative_difference <= -kDropFraction) {
+        anomaly.kind = Kind::DROP;
+        anomaly.recent_hps = recent;
+        anomaly.relative_change = welch.relative_difference;
+        anomaly.p_value = welch.p_value;
+        worker.anomalous = true;
+        worker.held = anomaly;
+        worker.holding = true;
+        worker.held_samples = 0;
+        ++drops_;
+    }
+}
+
+void HashrateWatchdog::startCapture(const Anomaly& anomaly) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        double& last = anomaly.worker == kAllWorkers
+            ? device_last_capture_ms_ : workers_[anomaly.worker].last_capture_ms;
+        if (stopped_ || pending_.size() >= kMaxBundles || anomaly.timestamp_ms - last < kCaptureCooldownMs) {
+            return;
+        }
+        last = anomaly.timestamp_ms;
+        pending_.push_back(anomaly);
+        if (capturing_) {
+            return;     // the running capture loop picks it up
+        }
+        capturing_ = true;
+    }
+
+    if (!NativeExecutor::engine().submit([this] { captureLoop(); })) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_.clear();
+        capturing_ = false;
+        capture_done_.notify_all();
+    }
+}
+
+/**
+ * Professional capture worker - one bundle at a time on the engine executor
+ */
+void HashrateWatchdog::captureLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!pending_.empty() && !stopped_) {
+        Anomaly anomaly = pending_.front();
+        pending_.pop_front();
+        std::function<int32_t(uint32_t)> worker_tid = remediation_.worker_tid;
+        lock.unlock();
+
+        int32_t tid = worker_tid && anomaly.worker != kAllWorkers ? worker_tid(anomaly.worker) : 0;
+        Bundle bundle = capture(anomaly, tid);
+        recommend(bundle, tid);
+
+        lock.lock();
+        ++captures_;
+        if (auto_remediate_ && !stopped_ && bundle.recommended != Action::NONE &&
+            anomaly.worker < worker_count_ &&
+            anomaly.timestamp_ms - workers_[anomaly.worker].last_remediation_ms >= kRemediationCooldownMs) {
+            bundle.remediated = applyLocked(lock, anomaly.worker, bundle.recommended,
+                                            static_cast<uint32_t>(std::max(0, bundle.repin_cpu)),
+                                            anomaly.timestamp_ms);
+        }
+        TA_LOGI("Hashrate watchdog: captured %s bundle in %.0f ms, recommends %s (%s)%s",
+                kindName(anomaly.kind), bundle.capture_ms, actionName(bundle.recommended),
+                bundle.reason.c_str(), bundle.remediated ? ", applied" : "");
+
+        bundles_.push_back(std::move(bundle));
+        if (bundles_.size() > kMaxBundles) {
+            bundles_.pop_front();
+        }
+    }
+    pending_.clear();
+    capturing_ = false;
+    lock.unlock();
+    capture_done_.notify_all();
+}
+
+HashrateWatchdog::Bundle HashrateWatchdog::capture(const Anomaly& anomaly, int32_t tid) const {
+    auto started = std::chrono::steady_clock::now();
+
+    Bundle bundle;
+    bundle.anomaly = anomaly;
+    bundle.perf = capturePerfCounters(tid > 0 ? std::vector<int32_t>{tid} : processTasks(),
+                                      kProfileWindowMs, &bundle.threads);
+    bundle.thermal = captureThermal();
+    bundle.frequencies = captureFrequencies();
+    bundle.stages = StageProfiler::Collector::instance().snapshot();
+
+    bundle.capture_ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - started).count();
+    return bundle;
+}
+
+/**
+ * Enhanced remediation choice
+ *
+ * A stalled worker is restarted. A dropped worker is moved when the CPU
+ * it last ran on went offline or another online CPU now clocks at least
+ * kRepinSpeedup higher; otherwise the bundle explains and nothing is
+ * changed, since a restart would not beat throttling.
+ */
+void HashrateWatchdog::recommend(Bundle& bundle, int32_t tid) const {
+    const Anomaly& anomaly = bundle.anomaly;
+    if (anomaly.worker == kAllWorkers) {
+        size_t capped = std::count_if(bundle.frequencies.begin(), bundle.frequencies.end(),
+            [](const CpuFrequency& f) { return f.online && f.scaling_max_khz > 0 && f.scaling_max_khz < f.max_khz; });
+        bundle.reason = capped > 0
+            ? "all workers dropped; " + std::to_string(capped) + " CPUs under a frequency cap"
+            : "all workers dropped together";
+        return;
+    }
+    if (anomaly.kind == Kind::STALL) {
+        bundle.recommended = Action::RESTART_WORKER;
+        bundle.reason = "no hashes for " + std::to_string(kStallSamples) + " samples";
+        return;
+    }
+
+    auto thread = std::find_if(bundle.threads.begin(), bundle.threads.end(),
+                               [tid](const ThreadProfile& t) { return t.tid == tid; });
+    if (tid <= 0 || thread == bundle.threads.end() || thread->last_cpu < 0) {
+        bundle.reason = "worker thread unknown";
+        return;
+    }
+
+    const CpuFrequency* current = nullptr;
+    const CpuFrequency* best = nullptr;
+    for (const CpuFrequency& cpu : bundle.frequencies) {
+        if (static_cast<int32_t>(cpu.cpu) == thread->last_cpu) {
+            current = &cpu;
+        } else if (cpu.online && (!best || cpu.current_khz > best->current_khz)) {
+            best = &cpu;
+        }
+    }
+
+    if (best && (!current || !current->online)) {
+        bundle.recommended = Action::REPIN_WORKER;
+        bundle.repin_cpu = static_cast<int32_t>(best->cpu);
+        bundle.reason = "cpu " + std::to_string(thread->last_cpu) + " went offline";
+    } else if (best && current && best->current_khz >= kRepinSpeedup * current->current_khz) {
+        bundle.recommended = Action::REPIN_WORKER;
+        bundle.repin_cpu = static_cast<int32_t>(best->cpu);
+        bundle.reason = "cpu " + std::to_string(current->cpu) + " at " +
+            std::to_string(current->current_khz / 1000) + " MHz, cpu " + std::to_string(best->cpu) +
+            " at " + std::to_string(best->current_khz / 1000) + " MHz";
+    } else {
+        bundle.reason = "no faster CPU; see thermal and counters";
+    }
+}
+
+bool HashrateWatchdog::remediate(uint32_t worker, Action action, uint32_t cpu) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (worker >= worker_count_ || action == Action::NONE) {
+        return false;
+    }
+    return applyLocked(lock, worker, action, cpu, wallClockMs());
+}
+
+/**
+ * Professional hook call with the lock dropped - a restart joins the
+ * publishing thread, which may be waiting in observe()
+ */
+bool HashrateWatchdog::applyLocked(std::unique_lock<std::mutex>& lock, uint32_t worker, Action action,
+                                   uint32_t cpu, double now_ms) {
+    std::function<bool(uint32_t)> restart = remediation_.restart_worker;
+    std::function<bool(uint32_t, uint32_t)> repin = remediation_.repin_worker;
+
+    lock.unlock();
+    bool applied = false;
+    if (action == Action::RESTART_WORKER && restart) {
+        applied = restart(worker);
+    } else if (action == Action::REPIN_WORKER && repin) {
+        applied = repin(worker, cpu);
+    }
+    lock.lock();
+
+    if (applied) {
+        ++remediations_;
+        workers_[worker].last_remediation_ms = now_ms;
+        restartWindows(workers_[worker]);
+    }
+    TA_LOGI("Hashrate watchdog: %s worker %u%s", actionName(action), worker, applied ? "" : " failed");
+    return applied;
+}
+
+HashrateWatchdog::Report HashrateWatchdog::report() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Report report;
+    report.samples = samples_;
+    report.stalls = stalls_;
+    report.drops = drops_;
+    report.captures = captures_;
+    report.remediations = remediations_;
+    report.auto_remediate = auto_remediate_;
+    report.bundles.assign(bundles_.begin(), bundles_.end());
+
+    for (uint32_t i = 0; i < worker_count_; ++i) {
+        const Worker& worker = workers_[i];
+        WorkerStatus status;
+        status.baseline_samples = worker.baseline.size();
+        status.baseline_hps = median(std::vector<double>(worker.baseline.begin(), worker.baseline.end()));
+        status.recent_hps = mean(worker.recent);
+        status.anomalous = worker.anomalous;
+        report.device_baseline_hps += status.baseline_hps;
+        report.workers.push_back(status);
+    }
+    return report;
+}
+
+const char* HashrateWatchdog::kindName(Kind kind) {
+    return kKindNames[static_cast<size_t>(kind)];
+}
+
+const char* HashrateWatchdog::actionName(Action action) {
+    return kActionNames[static_cast<size_t>(action)];
+}
+
+/**
+ * Professional counter window
+ *
+ * Opens every counter on every tid, runs them for window_ms and sums
+ * per counter. A counter the kernel refuses on every tid is reported
+ * unavailable rather than zero. The thread profile covers the whole
+ * process over the same window.
+ */
+std::vector<HashrateWatchdog::PerfCounter> HashrateWatchdog::capturePerfCounters(
+    const std::vector<int32_t>& tids, uint32_t window_ms, std::vector<ThreadProfile>* threads) {
+    std::vector<std::vector<int>> fds(std::size(kCounters));
+    for (size_t c = 0; c < std::size(kCounters); ++c) {
+        for (int32_t tid : tids) {
+            int fd = openCounter(kCounters[c], tid);
+            if (fd >= 0) {
+                fds[c].push_back(fd);
+            }
+        }
+    }
+
+    std::map<int32_t, TaskSample> before;
+    if (threads) {
+        for (int32_t tid : processTasks()) {
+            TaskSample sample;
+            if (readTask(tid, sample)) {
+                before[tid] = sample;
+            }
+        }
+    }
+
+    for (const std::vector<int>& counter : fds) {
+        for (int fd : counter) {
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(window_ms));
+
+    std::vector<PerfCounter> counters;
+    for (size_t c = 0; c < std::size(kCounters); ++c) {
+        PerfCounter counter;
+        counter.name = kCounters[c].name;
+        for (int fd : fds[c]) {
+            uint64_t value = 0;
+            ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+            if (read(fd, &value, sizeof(value)) == static_cast<ssize_t>(sizeof(value))) {
+                counter.available = true;
+                counter.value += value;
+            }
+            close(fd);
+        }
+        counters.push_back(counter);
+    }
+
+    if (threads) {
+        const double ticks_per_sec = static_cast<double>(sysconf(_SC_CLK_TCK));
+        for (const auto& [tid, first] : before) {
+            TaskSample last;
+            if (!readTask(tid, last)) {
+                continue;       // exited during the window
+            }
+            ThreadProfile profile;
+            profile.tid = tid;
+            profile.name = last.name;
+            profile.cpu_percent = (last.cpu_ticks - first.cpu_ticks) / ticks_per_sec * 1000.0 / window_ms * 100.0;
+            profile.last_cpu = last.last_cpu;
+            profile.involuntary_switches = last.involuntary_switches - first.involuntary_switches;
+            threads->push_back(profile);
+        }
+        std::sort(threads->begin(), threads->end(),
+                  [](const ThreadProfile& a, const ThreadProfile& b) { return a.cpu_percent > b.cpu_percent; });
+    }
+    return counters;
+}
+
+std::vector<HashrateWatchdog::ThermalZone> HashrateWatchdog::captureThermal() {
+    std::vector<ThermalZone> zones;
+    for (int zone = 0; zone < kMaxThermalZones; ++zone) {
+        char path[64];
+        std::snprintf(path, sizeof(path), "/sys/class/thermal/thermal_zone%d/temp", zone);
+        std::string line;
+        if (!readFirstLine(path, line)) {
+            break;
+        }
+
+        ThermalZone entry;
+        long millidegrees = std::strtol(line.c_str(), nullptr, 10);
+        // Some vendors report whole degrees instead of millidegrees
+        entry.celsius = std::labs(millidegrees) >= 1000 ? millidegrees / 1000.0 : millidegrees;
+        std::snprintf(path, sizeof(path), "/sys/class/thermal/thermal_zone%d/type", zone);
+        if (!readFirstLine(path, entry.type)) {
+            entry.type = "zone" + std::to_string(zone);
+        }
+        zones.push_back(entry);
+    }
+    return zones;
+}
+
+std::vector<HashrateWatchdog::CpuFrequency> HashrateWatchdog::captureFrequencies() {
+    std::vector<CpuFrequency> cpus;
+    long configured = sysconf(_SC_NPROCESSORS_CONF);
+    for (long cpu = 0; cpu < configured; ++cpu) {
+        char path[96];
+        CpuFrequency entry;
+        entry.cpu = static_cast<uint32_t>(cpu);
+
+        // cpu0 often has no online file because it cannot be unplugged
+        std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%ld/online", cpu);
+        std::string online;
+        entry.online = !readFirstLine(path, online) || online == "1";
+
+        std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%ld/cpufreq/scaling_cur_freq", cpu);
+        entry.current_khz = readUnsigned(path);
+        std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%ld/cpufreq/cpuinfo_max_freq", cpu);
+        entry.max_khz = readUnsigned(path);
+        std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%ld/cpufreq/scaling_max_freq", cpu);
+        entry.scaling_max_khz = readUnsigned(path);
+        cpus.push_back(entry);
+    }
+    return cpus;
+}
+
+} // namespace TradingAnarchy
@@ -0,0 +1,78 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * AES Round - Hardware and Table-Based AES Rounds with Measured Selection
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#pragma once
+
+#include "kernel_dispatch.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace TradingAnarchy {
+namespace AesRound {
+
+constexpr size_t kBlockBytes = 16;
+constexpr size_t kLanes = 8;        // blocks in flight, as in CryptoNight's scratchpad explode
+constexpr size_t kRounds = 10;
+
+/**
+ * Professional round-kernel signature
+ *
+ * Runs `iterations` passes of kRounds full AES encryption rounds over
+ * kLanes independent 16-byte blocks in place. A round is SubBytes,
+ * ShiftRows, MixColumns and AddRoundKey with keys[r * 16], which is
+ * x86 AESENC and ARMv8 AESE with a zero key followed by AESMC and EOR.
+ * There is no key schedule and no final round: this is the primitive
+ * CryptoNight-family PoW repeats, not AES-128 encryption.
+ */
+using RoundsFn = void (*)(uint8_t blocks[kLanes * kBlockBytes], const uint8_t keys[kRounds * kBlockBytes],
+                          size_t iterations);
+
+/**
+ * Enhanced outcome of the one-time speed measurement
+ *
+ * Some low-end cores implement the AES instructions with a slow, shared
+ * crypto unit, so the feature flag alone does not say hardware AES wins.
+ */
+struct Selection {
+    std::string variant;                    // bound after measurement
+    bool hardware_supported = false;        // CPU advertises AES instructions
+    bool hardware_preferred = false;        // a hardware variant measured faster than soft AES
+    double hardware_ns_per_round = 0.0;     // fastest hardware variant; 0 when unsupported
+    double soft_ns_per_round = 0.0;
+};
+
+/**
+ * Professional dispatched rounds through the currently bound variant
+ */
+void encryptRounds(uint8_t blocks[kLanes * kBlockBytes], const uint8_t keys[kRounds * kBlockBytes],
+                   size_t iterations);
+
+/**
+ * Enhanced measured selection
+ *
+ * The first call times every supported variant on this core (a few
+ * milliseconds), binds the fastest and caches the result; later calls
+ * return the cached result. Thread-safe.
+ */
+const Selection& selection();
+
+/**
+ * Enhanced non-blocking view - nullptr until some caller has run selection()
+ */
+const Selection* cachedSelection();
+
+/**
+ * Professional dispatcher for the round kernel, exposed for diagnostics and benches
+ */
+KernelDispatch<RoundsFn>& roundsKernel();
+
+} // namespace AesRound
+} // namespace TradingAnarchy
@@ -0,0 +1,84 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Bench Stats - Summary Statistics and Significance Tests for Benchmarks
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace TradingAnarchy {
+namespace BenchStats {
+
+constexpr double kDefaultConfidence = 0.95;
+
+/**
+ * Professional sample summary with a Student-t confidence interval on the mean
+ */
+struct Summary {
+    size_t count = 0;
+    double mean = 0.0;
+    double median = 0.0;
+    double stddev = 0.0;            // sample (n - 1) standard deviation
+    double min = 0.0;
+    double max = 0.0;
+    double ci_low = 0.0;
+    double ci_high = 0.0;
+};
+
+Summary summarize(const std::vector<double>& samples, double confidence = kDefaultConfidence);
+
+/**
+ * Enhanced Welch two-sample t-test - no equal-variance assumption
+ *
+ * difference is mean(b) - mean(a), with its confidence interval;
+ * relative_difference is that difference over mean(a).
+ */
+struct WelchResult {
+    double t = 0.0;
+    double degrees_of_freedom = 0.0;
+    double p_value = 1.0;           // two-sided
+    double difference = 0.0;
+    double relative_difference = 0.0;
+    double ci_low = 0.0;
+    double ci_high = 0.0;
+};
+
+WelchResult welchTest(const std::vector<double>& a, const std::vector<double>& b,
+                      double confidence = kDefaultConfidence);
+
+/**
+ * Enhanced Mann-Whitney U test - ranks only, no normality assumption
+ *
+ * u counts the (a, b) pairs with b above a, ties counting half. The
+ * two-sided p-value is exact for small tie-free samples, else from the
+ * normal approximation with tie and continuity corrections. Effect
+ * sizes: rank_biserial is 2u / (n_a n_b) - 1, from -1 (every b below
+ * every a) to 1; shift is the Hodges-Lehmann estimate of b - a (the
+ * median pairwise difference) and relative_shift that over median(a).
+ */
+struct MannWhitneyResult {
+    double u = 0.0;
+    double z = 0.0;
+    double p_value = 1.0;           // two-sided
+    bool exact = false;
+    double rank_biserial = 0.0;
+    double shift = 0.0;
+    double relative_shift = 0.0;
+};
+
+MannWhitneyResult mannWhitneyTest(const std::vector<double>& a, const std::vector<double>& b);
+
+/**
+ * Professional Student-t distribution helpers
+ */
+double studentTCdf(double t, double degrees_of_freedom);
+double studentTQuantile(double p, double degrees_of_freedom);
+
+} // namespace BenchStats
+} // namespace TradingAnarchy
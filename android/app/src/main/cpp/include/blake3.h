@@ -0,0 +1,55 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * BLAKE3 - SIMD Compression and Multi-Threaded Tree Hashing
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#pragma once
+
+#include "kernel_dispatch.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace TradingAnarchy {
+namespace Blake3 {
+
+constexpr size_t kBlockBytes = 64;
+constexpr size_t kChunkBytes = 1024;
+constexpr size_t kDigestBytes = 32;
+
+// Inputs from this size up hash their chunks on the compute pool
+constexpr size_t kParallelThreshold = 256 * 1024;
+
+/**
+ * Professional many-input compression - the BLAKE3 reference hash_many shape
+ *
+ * Hashes num_inputs inputs of `blocks` 64-byte blocks each with the same
+ * key, writing one 32-byte chaining value per input. Input i uses counter
+ * + i when increment_counter is set; flags_start and flags_end are added
+ * to the first and last block.
+ */
+using HashManyFn = void (*)(const uint8_t* const* inputs, size_t num_inputs, size_t blocks,
+                            const uint32_t key[8], uint64_t counter, bool increment_counter,
+                            uint8_t flags, uint8_t flags_start, uint8_t flags_end, uint8_t* out);
+
+/**
+ * Enhanced default-mode hash - multi-threaded above kParallelThreshold
+ */
+void hash(const uint8_t* data, size_t length, uint8_t out[kDigestBytes]);
+
+/**
+ * Professional single-threaded hash, used by the bench and below the threshold
+ */
+void hashSerial(const uint8_t* data, size_t length, uint8_t out[kDigestBytes]);
+
+/**
+ * Professional dispatcher for the SIMD lanes, exposed for diagnostics and benches
+ */
+KernelDispatch<HashManyFn>& hashManyKernel();
+
+} // namespace Blake3
+} // namespace TradingAnarchy
@@ -0,0 +1,121 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Callback Dispatcher - Rate-Limited, Coalescing JS Event Delivery
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#pragma once
+
+#include "trading_anarchy_jni.h"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace TradingAnarchy {
+
+class NativeExecutor;
+
+/**
+ * Professional JS callback delivery policy
+ *
+ * Performance metrics are coalesced: only the latest sample is kept and it
+ * is delivered at most once per interval, where the interval is rounded up
+ * to whole UI frames. Only one metrics delivery is in flight to the JS
+ * thread at a time. Status and error events are lossless and handed to
+ * the deliver function on the publishing thread, so they never queue
+ * behind work on the executor. Create with std::make_shared: executor
+ * tasks hold a reference until they run.
+ */
+class CallbackDispatcher : public std::enable_shared_from_this<CallbackDispatcher> {
+public:
+    struct Event {
+        enum class Kind { STATUS, ERROR };
+        Kind kind;
+        ComputeEngineStatus status = ComputeEngineStatus::STOPPED;
+        std::string error;
+        std::string message;
+    };
+    
+    struct Batch {
+        std::optional<PerformanceMetrics> metrics;
+        std::vector<Event> events;
+        
+        bool empty() const { return !metrics && events.empty(); }
+    };
+    
+    struct Stats {
+        double max_rate_hz;
+        uint64_t delivered_metrics;
+        uint64_t dropped_metrics;
+        uint64_t delivered_events;
+    };
+    
+    /**
+     * The deliver function hands a batch to the JS thread; the JS side must
+     * call acknowledge() once the batch has been processed, even when it
+     * drops the batch.
+     */
+    using Deliver = std::function<void(Batch)>;
+    
+    static constexpr double kFrameIntervalMs = 1000.0 / 60.0;
+    static constexpr double kDefaultMaxRateHz = 10.0;
+    
+    CallbackDispatcher(NativeExecutor& executor, Deliver deliver);
+    
+    void publishMetrics(const PerformanceMetrics& metrics);
+    void publishStatus(ComputeEngineStatus status);
+    void publishError(const std::string& error, const std::string& message);
+    
+    void acknowledge(bool carried_metrics);
+    
+    /**
+     * Professional shutdown - once this returns, deliver is never called again
+     */
+    void close();
+    
+    /**
+     * Enhanced rate configuration - rounded to the UI frame cadence
+     */
+    void setMaxRate(double hz);
+    
+    Stats stats() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+    
+    void flush(bool from_timer);
+    void flushEvents();
+    void scheduleLocked(Clock::time_point now);
+    
+    NativeExecutor& executor_;
+    Deliver deliver_;
+    
+    // Held across deliver_ so batches leave in order and close() can fence them
+    std::mutex deliver_mutex_;
+    std::atomic<bool> closed_{false};
+    
+    mutable std::mutex mutex_;
+    std::optional<PerformanceMetrics> pending_metrics_;
+    std::vector<Event> pending_events_;
+    Clock::duration interval_;
+    double max_rate_hz_;
+    Clock::time_point next_metrics_due_{};
+    bool metrics_in_flight_ = false;
+    bool timer_armed_ = false;
+    bool immediate_armed_ = false;
+    
+    std::atomic<uint64_t> delivered_metrics_{0};
+    std::atomic<uint64_t> dropped_metrics_{0};
+    std::atomic<uint64_t> delivered_events_{0};
+};
+
+} // namespace TradingAnarchy
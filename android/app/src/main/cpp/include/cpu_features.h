@@ -0,0 +1,61 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * CPU Features - Runtime ISA Extension Detection
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace TradingAnarchy {
+
+/**
+ * Professional ISA feature bits - one namespace for ARM and x86 so kernel
+ * variants can state their requirements as a single mask
+ */
+enum CpuFeature : uint64_t {
+    CPU_NEON        = 1ull << 0,
+    CPU_AES         = 1ull << 1,    // ARMv8 AES / x86 AES-NI
+    CPU_PMULL       = 1ull << 2,    // ARMv8 PMULL / x86 PCLMULQDQ
+    CPU_SHA1        = 1ull << 3,
+    CPU_SHA2        = 1ull << 4,    // ARMv8 SHA256 / x86 SHA-NI
+    CPU_SHA3        = 1ull << 5,    // ARMv8.2 EOR3, RAX1, XAR, BCAX
+    CPU_SHA512      = 1ull << 6,
+    CPU_DOTPROD     = 1ull << 7,    // ARMv8.2 SDOT/UDOT
+    CPU_SVE         = 1ull << 8,
+    CPU_FP16        = 1ull << 9,    // ARMv8.2 half-precision scalar and SIMD
+    CPU_RCPC        = 1ull << 10,   // ARMv8.3 LDAPR, shipped by ARMv8.2 Cortex cores
+    CPU_SSSE3       = 1ull << 16,
+    CPU_SSE41       = 1ull << 17,
+    CPU_AVX         = 1ull << 18,
+    CPU_AVX2        = 1ull << 19,
+    CPU_BMI2        = 1ull << 20,
+    CPU_AVX512F     = 1ull << 21,
+    CPU_AVX512VL    = 1ull << 22,
+};
+
+/**
+ * Enhanced detected feature set - detected once, immutable afterwards
+ */
+struct CpuFeatures {
+    uint64_t mask = 0;
+
+    bool has(uint64_t required) const { return (mask & required) == required; }
+
+    /**
+     * Space-separated feature names for logs and getSystemInfo
+     */
+    std::string describe() const;
+};
+
+/**
+ * Professional process-wide feature set (getauxval on ARM, cpuid on x86)
+ */
+const CpuFeatures& cpuFeatures();
+
+} // namespace TradingAnarchy
@@ -0,0 +1,69 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Diagnostics - Native Self-Test and Microbenchmark Battery
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace TradingAnarchy {
+namespace Diagnostics {
+
+/**
+ * Bump whenever a probe or reference value changes so fleet scores are
+ * only compared between runs of the same battery.
+ */
+constexpr uint32_t kBatteryVersion = 1;
+
+/**
+ * Professional known-answer test outcome
+ */
+struct KnownAnswerResult {
+    std::string kernel;
+    bool passed = false;
+    double duration_us = 0.0;
+};
+
+/**
+ * Enhanced diagnostics report - every probe reports in base units
+ */
+struct DiagnosticsReport {
+    uint32_t battery_version = kBatteryVersion;
+
+    std::vector<KnownAnswerResult> known_answer_tests;
+    bool self_test_passed = false;
+
+    // SHA-256 over 64-byte messages
+    double single_core_hashes_per_sec = 0.0;
+    double all_core_hashes_per_sec = 0.0;
+    uint32_t hash_threads = 0;
+
+    double memory_read_bytes_per_sec = 0.0;
+    double memory_copy_bytes_per_sec = 0.0;
+    double memory_latency_ns = 0.0;
+
+    double timer_resolution_ns = 0.0;
+
+    uint32_t thermal_zones = 0;
+    double thermal_read_us = 0.0;
+    double max_temperature_c = 0.0;
+
+    // Zero when any known-answer test fails
+    double device_score = 0.0;
+    double duration_ms = 0.0;
+};
+
+/**
+ * Professional battery entry point - blocking, run it off the JS thread
+ */
+DiagnosticsReport runBattery();
+
+} // namespace Diagnostics
+} // namespace TradingAnarchy
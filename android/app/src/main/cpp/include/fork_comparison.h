@@ -0,0 +1,86 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Fork Comparison - A/B Harness for the Upstream and MoneroOcean Miners
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#pragma once
+
+#include "bench_stats.h"
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace TradingAnarchy {
+namespace ForkComparison {
+
+constexpr char kUpstreamBinary[] = "libxmrig";
+constexpr char kMoneroOceanBinary[] = "libxmrig-mo";
+
+/**
+ * Professional comparison request - both forks run with identical settings
+ *
+ * Each repetition benches both binaries in ABBA order so slow drift
+ * (thermal, battery) is spread evenly over the two.
+ */
+struct ComparisonOptions {
+    std::string native_lib_dir;
+    std::string algorithm = "rx/0";
+    std::string size = "1M";
+    uint32_t threads = 0;
+    int64_t affinity = -1;
+    uint32_t repetitions = 5;
+    std::chrono::seconds cooldown{30};      // idle time between runs
+    double alpha = 0.05;                    // significance level
+};
+
+struct ForkSamples {
+    std::string binary_base;
+    std::string file_name;
+    std::string variant;
+    std::vector<double> hashrates;
+    BenchStats::Summary summary;
+    std::string hash_sum;
+    uint32_t failures = 0;
+    std::string last_error;
+};
+
+/**
+ * Enhanced comparison outcome
+ *
+ * test compares moneroocean against upstream, so a positive difference
+ * means the MoneroOcean build is faster. winner stays empty unless the
+ * difference is significant and both forks produced the same hash sum.
+ */
+struct ComparisonResult {
+    bool success = false;
+    std::string error;
+
+    ForkSamples upstream;
+    ForkSamples moneroocean;
+    BenchStats::WelchResult test;
+    bool significant = false;
+    bool hashes_agree = false;
+    std::string winner;
+    double duration_seconds = 0.0;
+};
+
+/**
+ * Professional blocking comparison - hours for 1M on phones, call from a worker thread
+ */
+ComparisonResult compare(const ComparisonOptions& options);
+
+/**
+ * Enhanced per-device winner persistence, one line per algorithm in
+ * <directory>/xmrig-fork-ab.tsv
+ */
+bool saveWinner(const std::string& directory, const std::string& algorithm, const ComparisonResult& result);
+std::string preferredFork(const std::string& directory, const std::string& algorithm);
+
+} // namespace ForkComparison
+} // namespace TradingAnarchy
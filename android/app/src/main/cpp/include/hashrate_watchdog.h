@@ -0,0 +1,246 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Hashrate Watchdog - Per-Worker Anomaly Detection and Diagnostics Capture
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#pragma once
+
+#include "live_metrics.h"
+#include "stage_profiler.h"
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace TradingAnarchy {
+
+/**
+ * Professional watchdog over the per-worker hashrate windows
+ *
+ * Fed one LiveMetricsSnapshot per publish (about 1 Hz). Each worker
+ * keeps a recent window and a baseline built from the samples that age
+ * out of it while the worker is healthy, so a slow slide cannot drag
+ * the baseline down with it. Two anomalies are reported:
+ *   - STALL: kStallSamples consecutive samples below kStallFraction of
+ *     the baseline median (or at zero before a baseline exists),
+ *   - DROP: the recent window is below the baseline by at least
+ *     kDropFraction with a Welch p-value under kSignificance.
+ * Drops are held for kStallSamples; if every worker turns anomalous in
+ * that time they become one device-wide anomaly (kAllWorkers), which is
+ * throttling or a power cap and is not remediated. A worker that stays
+ * anomalous for kBaselineSamples adopts its recent window as the new
+ * baseline. Each anomaly captures a diagnostics bundle
+ * on the engine executor and recommends restarting the worker or
+ * re-pinning it to a better CPU.
+ */
+class HashrateWatchdog {
+public:
+    static constexpr uint32_t kMaxWorkers = LiveMetricsLayout::kMaxThreads;
+    static constexpr uint32_t kAllWorkers = UINT32_MAX;
+
+    static constexpr size_t kWarmupSamples = 10;        // ramp-up after start or restart
+    static constexpr size_t kWindowSamples = 30;
+    static constexpr size_t kBaselineSamples = 120;
+    static constexpr size_t kMinBaselineSamples = 30;
+    static constexpr uint32_t kStallSamples = 5;
+    static constexpr double kStallFraction = 0.05;
+    static constexpr double kDropFraction = 0.15;
+    static constexpr double kSignificance = 0.01;
+
+    static constexpr uint32_t kProfileWindowMs = 250;
+    static constexpr uint32_t kCaptureCooldownMs = 5 * 60 * 1000;
+    static constexpr uint32_t kRemediationCooldownMs = 10 * 60 * 1000;
+    static constexpr size_t kMaxBundles = 4;
+
+    enum class Kind : uint8_t { STALL = 0, DROP };
+    enum class Action : uint8_t { NONE = 0, RESTART_WORKER, REPIN_WORKER };
+
+    struct Anomaly {
+        Kind kind = Kind::STALL;
+        uint32_t worker = 0;                // kAllWorkers when every worker dropped together
+        double timestamp_ms = 0.0;
+        double baseline_hps = 0.0;          // baseline median
+        double recent_hps = 0.0;            // recent window mean
+        double relative_change = 0.0;
+        double p_value = 1.0;               // 1 for stalls
+    };
+
+    struct PerfCounter {
+        std::string name;
+        bool available = false;             // perf_event_paranoid or a missing PMU
+        uint64_t value = 0;
+    };
+
+    struct ThermalZone {
+        std::string type;
+        double celsius = 0.0;
+    };
+
+    struct CpuFrequency {
+        uint32_t cpu = 0;
+        bool online = false;
+        uint64_t current_khz = 0;
+        uint64_t max_khz = 0;               // cpuinfo_max_freq, before any thermal cap
+        uint64_t scaling_max_khz = 0;       // current policy cap
+    };
+
+    /**
+     * Enhanced per-thread sample over the profile window, from /proc/self/task
+     */
+    struct ThreadProfile {
+        int32_t tid = 0;
+        std::string name;
+        double cpu_percent = 0.0;
+        int32_t last_cpu = -1;
+        uint64_t involuntary_switches = 0;  // during the window
+    };
+
+    /**
+     * Professional diagnostics bundle captured for one anomaly
+     *
+     * Perf counters cover the worker's thread when the host reports its
+     * tid, else every thread of the process, over kProfileWindowMs.
+     */
+    struct Bundle {
+        Anomaly anomaly;
+        double capture_ms = 0.0;
+        std::vector<PerfCounter> perf;
+        std::vector<ThermalZone> thermal;
+        std::vector<CpuFrequency> frequencies;
+        std::vector<ThreadProfile> threads;
+        StageProfiler::ProfileSnapshot stages;
+        Action recommended = Action::NONE;
+        int32_t repin_cpu = -1;
+        std::string reason;
+        bool remediated = false;
+    };
+
+    /**
+     * Enhanced host hooks - any may be empty
+     */
+    struct Remediation {
+        std::function<int32_t(uint32_t worker)> worker_tid;
+        std::function<bool(uint32_t worker)> restart_worker;
+        std::function<bool(uint32_t worker, uint32_t cpu)> repin_worker;
+    };
+
+    struct WorkerStatus {
+        double baseline_hps = 0.0;
+        double recent_hps = 0.0;
+        size_t baseline_samples = 0;
+        bool anomalous = false;
+    };
+
+    struct Report {
+        uint64_t samples = 0;
+        std::vector<WorkerStatus> workers;
+        double device_baseline_hps = 0.0;   // sum of worker baselines
+        uint64_t stalls = 0;
+        uint64_t drops = 0;
+        uint64_t captures = 0;
+        uint64_t remediations = 0;
+        bool auto_remediate = true;
+        std::vector<Bundle> bundles;        // newest last
+    };
+
+    HashrateWatchdog();
+    ~HashrateWatchdog();
+
+    HashrateWatchdog(const HashrateWatchdog&) = delete;
+    HashrateWatchdog& operator=(const HashrateWatchdog&) = delete;
+
+    void setRemediation(Remediation remediation);
+
+    /**
+     * Professional policy switch - off leaves the recommendation in the bundle
+     */
+    void setAutoRemediate(bool enabled);
+
+    /**
+     * Enhanced ingestion from the metrics publisher - cheap, never blocks on capture
+     */
+    void observe(const LiveMetricsSnapshot& snapshot);
+
+    /**
+     * Professional manual remediation - cpu is only used by REPIN_WORKER
+     */
+    bool remediate(uint32_t worker, Action action, uint32_t cpu = 0);
+
+    /**
+     * Enhanced restart of one worker's windows, e.g. after a config change
+     */
+    void resetWorker(uint32_t worker);
+    void reset();
+
+    /**
+     * Professional wait for an in-flight capture, after which none start
+     */
+    void shutdown();
+
+    Report report() const;
+
+    static const char* kindName(Kind kind);
+    static const char* actionName(Action action);
+
+    /**
+     * Enhanced capture pieces, also used standalone by the engine bench
+     */
+    static std::vector<PerfCounter> capturePerfCounters(const std::vector<int32_t>& tids, uint32_t window_ms,
+                                                         std::vector<ThreadProfile>* threads = nullptr);
+    static std::vector<ThermalZone> captureThermal();
+    static std::vector<CpuFrequency> captureFrequencies();
+
+private:
+    struct Worker {
+        std::deque<double> recent;
+        std::deque<double> baseline;
+        size_t warmup = 0;
+        uint32_t stall_run = 0;
+        bool seen_hashing = false;
+        bool anomalous = false;
+        size_t anomalous_samples = 0;
+        Anomaly held;                       // a drop waiting to see if it is device-wide
+        bool holding = false;
+        uint32_t held_samples = 0;
+        double last_capture_ms = -1e18;
+        double last_remediation_ms = -1e18;
+    };
+
+    static void restartWindows(Worker& worker);
+    void observeWorker(uint32_t index, double hashrate, double now_ms, std::vector<Anomaly>& found);
+    void startCapture(const Anomaly& anomaly);
+    void captureLoop();
+    Bundle capture(const Anomaly& anomaly, int32_t tid) const;
+    void recommend(Bundle& bundle, int32_t tid) const;
+    bool applyLocked(std::unique_lock<std::mutex>& lock, uint32_t worker, Action action, uint32_t cpu, double now_ms);
+
+    mutable std::mutex mutex_;
+    std::condition_variable capture_done_;
+    std::array<Worker, kMaxWorkers> workers_;
+    uint32_t worker_count_ = 0;
+    Remediation remediation_;
+    bool auto_remediate_ = true;
+    bool capturing_ = false;
+    bool stopped_ = false;
+    double device_last_capture_ms_ = -1e18;
+
+    uint64_t samples_ = 0;
+    uint64_t stalls_ = 0;
+    uint64_t drops_ = 0;
+    uint64_t captures_ = 0;
+    uint64_t remediations_ = 0;
+    std::deque<Anomaly> pending_;
+    std::deque<Bundle> bundles_;
+};
+
+} // namespace TradingAnarchy
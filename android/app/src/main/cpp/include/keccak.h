@@ -0,0 +1,65 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Keccak - Multiversioned Keccak-f[1600] Permutation and Sponge Hashes
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#pragma once
+
+#include "kernel_dispatch.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace TradingAnarchy {
+namespace Keccak {
+
+constexpr size_t kStateLanes = 25;
+constexpr size_t kDigestBytes = 32;
+
+// States per batched permutation; lane i of state j lives at states[i * kBatchWays + j]
+constexpr size_t kBatchWays = 4;
+
+using PermutationFn = void (*)(uint64_t* state);
+using BatchPermutationFn = void (*)(uint64_t* states);
+
+/**
+ * Professional Keccak-f[1600] permutation - 24 rounds on 25 little-endian lanes
+ */
+inline void permute(uint64_t state[kStateLanes]);
+
+/**
+ * Enhanced sponge hashes built on the dispatched permutation
+ *
+ * sha3_256 uses the FIPS 202 domain byte (0x06); keccak_256 uses the
+ * original Keccak padding (0x01) as deployed by Ethereum-style chains.
+ */
+void sha3_256(const uint8_t* data, size_t length, uint8_t out[kDigestBytes]);
+void keccak_256(const uint8_t* data, size_t length, uint8_t out[kDigestBytes]);
+
+/**
+ * Professional batch hashes - message i is inputs[i] (lengths[i] bytes) and
+ * its digest is written to out + i * kDigestBytes
+ *
+ * Messages go kBatchWays at a time through the interleaved permutation.
+ * A group runs for as many blocks as its longest message, so batches of
+ * similar lengths waste the least work.
+ */
+void sha3_256Many(const uint8_t* const* inputs, const size_t* lengths, size_t count, uint8_t* out);
+void keccak_256Many(const uint8_t* const* inputs, const size_t* lengths, size_t count, uint8_t* out);
+
+/**
+ * Professional dispatchers for the permutations, exposed for diagnostics and benches
+ */
+KernelDispatch<PermutationFn>& permutationKernel();
+KernelDispatch<BatchPermutationFn>& batchPermutationKernel();
+
+inline void permute(uint64_t state[kStateLanes]) {
+    permutationKernel().get()(state);
+}
+
+} // namespace Keccak
+} // namespace TradingAnarchy
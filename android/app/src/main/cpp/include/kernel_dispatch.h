@@ -0,0 +1,141 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Kernel Dispatch - Load-Time Selection of Per-Microarchitecture Kernel Variants
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#pragma once
+
+#include "cpu_features.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace TradingAnarchy {
+
+/**
+ * Professional type-erased view of a dispatched kernel
+ *
+ * Lets diagnostics and the engine bench enumerate every kernel, force
+ * each supported variant in turn and check what load-time selection chose.
+ */
+class KernelDispatchBase {
+public:
+    struct VariantInfo {
+        const char* name;
+        uint64_t required_features;
+        bool supported;
+    };
+
+    // Runs the kernel `iterations` times through the dispatcher; returns a checksum
+    using Workload = std::function<uint64_t(size_t iterations)>;
+
+    virtual ~KernelDispatchBase() = default;
+
+    virtual const char* kernelName() const = 0;
+    virtual const char* selectedVariant() const = 0;
+    virtual const char* preferredVariant() const = 0;
+    virtual std::vector<VariantInfo> variants() const = 0;
+
+    /**
+     * Enhanced override for benchmarking - false if the CPU lacks the variant
+     */
+    virtual bool force(const char* variant) = 0;
+    virtual void reset() = 0;
+
+    void setWorkload(Workload workload) { workload_ = std::move(workload); }
+    const Workload& workload() const { return workload_; }
+
+private:
+    Workload workload_;
+};
+
+/**
+ * Enhanced registry of every dispatched kernel in the engine
+ */
+inline std::vector<KernelDispatchBase*>& kernelRegistry() {
+    static std::vector<KernelDispatchBase*> registry;
+    return registry;
+}
+
+/**
+ * Professional variant table for one kernel signature
+ *
+ * Variants are listed best-first; the first one whose required features
+ * are all present is bound at static-initialization time. Calls go through
+ * a single relaxed atomic load of the bound function pointer.
+ */
+template <typename Fn>
+class KernelDispatch final : public KernelDispatchBase {
+public:
+    struct Variant {
+        const char* name;
+        uint64_t required_features;
+        Fn fn;
+    };
+
+    KernelDispatch(const char* kernel, std::initializer_list<Variant> variants)
+        : kernel_(kernel), variants_(variants) {
+        reset();
+        kernelRegistry().push_back(this);
+    }
+
+    Fn get() const { return bound_.load(std::memory_order_relaxed); }
+
+    const char* kernelName() const override { return kernel_; }
+    const char* selectedVariant() const override { return variants_[selected_.load(std::memory_order_relaxed)].name; }
+    const char* preferredVariant() const override { return variants_[preferredIndex()].name; }
+
+    std::vector<VariantInfo> variants() const override {
+        std::vector<VariantInfo> info;
+        for (const Variant& variant : variants_) {
+            info.push_back({variant.name, variant.required_features,
+                            cpuFeatures().has(variant.required_features)});
+        }
+        return info;
+    }
+
+    bool force(const char* name) override {
+        for (size_t i = 0; i < variants_.size(); ++i) {
+            if (std::strcmp(variants_[i].name, name) == 0 &&
+                cpuFeatures().has(variants_[i].required_features)) {
+                bind(i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void reset() override { bind(preferredIndex()); }
+
+private:
+    // The last variant must be the portable baseline with no requirements
+    size_t preferredIndex() const {
+        for (size_t i = 0; i < variants_.size(); ++i) {
+            if (cpuFeatures().has(variants_[i].required_features)) {
+                return i;
+            }
+        }
+        return variants_.size() - 1;
+    }
+
+    void bind(size_t index) {
+        selected_.store(index, std::memory_order_relaxed);
+        bound_.store(variants_[index].fn, std::memory_order_relaxed);
+    }
+
+    const char* kernel_;
+    std::vector<Variant> variants_;
+    std::atomic<size_t> selected_{0};
+    std::atomic<Fn> bound_{nullptr};
+};
+
+} // namespace TradingAnarchy
@@ -0,0 +1,62 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Large Pages - Huge-Page Backed Buffers for Memory-Hard Kernels
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace TradingAnarchy {
+
+/**
+ * Professional page-backed buffer for scratchpads and datasets
+ *
+ * Allocation tries explicit huge pages (MAP_HUGETLB) first, then a 2 MiB
+ * aligned anonymous mapping advised for transparent huge pages, then plain
+ * 4 KiB pages. Most Android kernels reserve no hugetlb pages, so the THP
+ * path is the usual win: a 2 MiB scratchpad then needs one TLB entry
+ * instead of 512. The mode records which path succeeded.
+ */
+class LargePageBuffer {
+public:
+    enum class Mode : uint8_t {
+        NONE = 0,       // empty or failed allocation
+        HUGETLB,        // explicit huge pages
+        TRANSPARENT,    // aligned and advised for THP; the kernel may still split it
+        REGULAR,        // base pages only
+    };
+
+    static constexpr size_t kHugePageSize = 2u << 20;
+
+    LargePageBuffer() = default;
+    explicit LargePageBuffer(size_t bytes);
+    ~LargePageBuffer();
+
+    LargePageBuffer(LargePageBuffer&& other) noexcept;
+    LargePageBuffer& operator=(LargePageBuffer&& other) noexcept;
+    LargePageBuffer(const LargePageBuffer&) = delete;
+    LargePageBuffer& operator=(const LargePageBuffer&) = delete;
+
+    uint8_t* data() const { return data_; }
+    size_t size() const { return size_; }
+    Mode mode() const { return mode_; }
+    explicit operator bool() const { return data_ != nullptr; }
+
+    static const char* modeName(Mode mode);
+
+private:
+    void release();
+
+    uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+    size_t mapping_size_ = 0;       // size rounded up to whole pages
+    Mode mode_ = Mode::NONE;
+};
+
+} // namespace TradingAnarchy
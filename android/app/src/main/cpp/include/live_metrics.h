@@ -0,0 +1,96 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Live Metrics - Seqlock-Protected Shared Metrics Block
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace TradingAnarchy {
+
+/**
+ * Professional shared metrics layout
+ *
+ * The block is an array of doubles so JS can map it directly with a
+ * Float64Array. Slot SEQUENCE is odd while the writer is mid-update;
+ * readers copy the fields and retry if the sequence changed or was odd.
+ * Bump kLayoutVersion whenever a slot moves.
+ */
+namespace LiveMetricsLayout {
+    constexpr uint32_t kLayoutVersion = 1;
+    constexpr uint32_t kMaxThreads = 32;
+    
+    enum Slot : uint32_t {
+        LAYOUT_VERSION = 0,
+        SEQUENCE,
+        TIMESTAMP_MS,
+        HASHRATE,
+        ACCEPTED_SHARES,
+        REJECTED_SHARES,
+        TEMPERATURE,
+        CPU_USAGE,
+        UPTIME_SECONDS,
+        THREAD_COUNT,
+        THREAD_HASHRATE_BASE,
+        SLOT_COUNT = THREAD_HASHRATE_BASE + kMaxThreads
+    };
+}
+
+/**
+ * Enhanced metrics snapshot exchanged with the writer and native readers
+ */
+struct LiveMetricsSnapshot {
+    double timestamp_ms = 0.0;
+    double hashrate = 0.0;
+    double accepted_shares = 0.0;
+    double rejected_shares = 0.0;
+    double temperature = 0.0;
+    double cpu_usage = 0.0;
+    double uptime_seconds = 0.0;
+    uint32_t thread_count = 0;
+    double thread_hashrate[LiveMetricsLayout::kMaxThreads] = {};
+};
+
+/**
+ * Professional single-writer, multi-reader metrics block
+ */
+class LiveMetrics {
+public:
+    static LiveMetrics& instance();
+    
+    /**
+     * Enhanced publication - must only be called from one writer thread at a time
+     */
+    void publish(const LiveMetricsSnapshot& snapshot);
+    
+    /**
+     * Professional consistent read for native consumers
+     */
+    LiveMetricsSnapshot read() const;
+    
+    uint64_t sequence() const;
+    
+    /**
+     * Raw block for zero-copy exposure to JS
+     */
+    uint8_t* data() { return reinterpret_cast<uint8_t*>(slots_); }
+    static constexpr size_t sizeBytes() { return sizeof(double) * LiveMetricsLayout::SLOT_COUNT; }
+
+private:
+    LiveMetrics();
+    
+    void store(uint32_t slot, double value);
+    double load(uint32_t slot) const;
+    
+    alignas(64) double slots_[LiveMetricsLayout::SLOT_COUNT] = {};
+    uint64_t write_sequence_ = 0;
+};
+
+} // namespace TradingAnarchy
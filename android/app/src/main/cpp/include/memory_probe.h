@@ -0,0 +1,86 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Memory Probe - Cache Hierarchy Latency and Multi-Thread Bandwidth Characterization
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace TradingAnarchy {
+namespace MemoryProbe {
+
+/**
+ * Professional dependent-load latency at one working-set size
+ */
+struct LatencyPoint {
+    size_t bytes = 0;
+    double ns_per_load = 0.0;
+};
+
+/**
+ * Enhanced STREAM triad bandwidth at one thread count (24 bytes per element)
+ */
+struct BandwidthPoint {
+    uint32_t threads = 0;
+    double bytes_per_sec = 0.0;
+};
+
+/**
+ * Professional measured memory hierarchy
+ *
+ * Cache sizes are effective capacities: the last working set of each
+ * latency plateau. Phones often hide L3 behind a system-level cache or
+ * have none, so any level can be 0 when no plateau was found.
+ */
+struct Hierarchy {
+    std::vector<LatencyPoint> latency;      // doubling sizes, kMinProbeBytes to kMaxProbeBytes
+    std::vector<BandwidthPoint> bandwidth;  // 1 to hardware_concurrency threads
+
+    uint64_t l1_cache = 0;
+    uint64_t l2_cache = 0;
+    uint64_t l3_cache = 0;
+    double memory_latency_ns = 0.0;         // at the largest working set
+
+    double peak_bytes_per_sec = 0.0;
+    uint32_t saturation_threads = 0;        // fewest threads within kSaturationFraction of peak
+    double duration_ms = 0.0;
+};
+
+constexpr size_t kMinProbeBytes = 2u << 10;
+constexpr size_t kMaxProbeBytes = 64u << 20;
+constexpr double kSaturationFraction = 0.9;
+
+/**
+ * Enhanced blocking probe - about half a second; run it off the JS thread
+ */
+Hierarchy probe();
+
+/**
+ * Professional cached probe - the first call measures, later calls return the result
+ */
+const Hierarchy& hierarchy();
+
+/**
+ * Enhanced non-blocking view - nullptr until some caller has run hierarchy()
+ */
+const Hierarchy* cachedHierarchy();
+
+/**
+ * Professional automatic thread count for a per-thread working set
+ *
+ * Working sets that fit the private L2 scale with cores. Larger ones
+ * stream from shared cache and DRAM, where threads past the bandwidth
+ * saturation point only queue on the memory controller, so the count is
+ * capped there. Blocks on the first call like hierarchy().
+ */
+uint32_t planThreads(size_t per_thread_bytes);
+
+} // namespace MemoryProbe
+} // namespace TradingAnarchy
@@ -0,0 +1,211 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Method Metrics - Lock-Free Per-Method Latency Histograms
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace TradingAnarchy {
+
+/**
+ * Professional JS-facing method identifiers - one metrics slot each
+ */
+enum class ModuleMethod : uint8_t {
+    GET_ENGINE_STATUS = 0,
+    GET_PERFORMANCE_METRICS,
+    GET_SYSTEM_INFO,
+    GET_METRICS_BUFFER,
+    GET_CURRENT_CONFIG,
+    SET_STATUS_CALLBACK,
+    SET_PERFORMANCE_CALLBACK,
+    SET_ERROR_CALLBACK,
+    SET_CALLBACK_RATE,
+    START_SIMULATION,
+    STOP_SIMULATION,
+    INITIALIZE_ENGINE,
+    START_ENGINE,
+    STOP_ENGINE,
+    PAUSE_ENGINE,
+    RESUME_ENGINE,
+    UPDATE_ENGINE_CONFIG,
+    GET_OPTIMAL_CONFIGURATION,
+    GENERATE_SECURE_KEY,
+    DERIVE_KEY,
+    COMPUTE_HASH,
+    RUN_DIAGNOSTICS,
+    EXPORT_LOGS,
+    CLEAR_CACHE,
+    COUNT
+};
+
+constexpr size_t kModuleMethodCount = static_cast<size_t>(ModuleMethod::COUNT);
+
+constexpr const char* kModuleMethodNames[kModuleMethodCount] = {
+    "getEngineStatus",
+    "getPerformanceMetrics",
+    "getSystemInfo",
+    "getMetricsBuffer",
+    "getCurrentConfig",
+    "setStatusCallback",
+    "setPerformanceCallback",
+    "setErrorCallback",
+    "setCallbackRate",
+    "startSimulation",
+    "stopSimulation",
+    "initializeEngine",
+    "startEngine",
+    "stopEngine",
+    "pauseEngine",
+    "resumeEngine",
+    "updateEngineConfig",
+    "getOptimalConfiguration",
+    "generateSecureKey",
+    "deriveKey",
+    "computeHash",
+    "runDiagnostics",
+    "exportLogs",
+    "clearCache",
+};
+
+constexpr const char* methodName(ModuleMethod method) {
+    return kModuleMethodNames[static_cast<size_t>(method)];
+}
+
+/**
+ * Enhanced log2 latency histogram
+ *
+ * Bucket 0 holds samples under 1us; bucket i holds [2^(i-1), 2^i) us.
+ * Every field is an independent relaxed atomic, so a snapshot taken
+ * while samples are recorded may be off by the in-flight samples.
+ */
+class LatencyHistogram {
+public:
+    static constexpr size_t kBuckets = 28;   // top bucket starts at ~67s
+
+    struct Snapshot {
+        uint64_t count = 0;
+        double mean_us = 0.0;
+        double max_us = 0.0;
+        double p50_us = 0.0;
+        double p90_us = 0.0;
+        double p99_us = 0.0;
+        std::array<uint64_t, kBuckets> buckets{};
+    };
+
+    void record(std::chrono::steady_clock::duration elapsed) {
+        auto us = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+        uint64_t value = us > 0 ? static_cast<uint64_t>(us) : 0;
+
+        size_t bucket = value == 0 ? 0 : 64 - __builtin_clzll(value);
+        buckets_[std::min(bucket, kBuckets - 1)].fetch_add(1, std::memory_order_relaxed);
+        sum_us_.fetch_add(value, std::memory_order_relaxed);
+
+        uint64_t seen = max_us_.load(std::memory_order_relaxed);
+        while (value > seen &&
+               !max_us_.compare_exchange_weak(seen, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    Snapshot snapshot() const {
+        Snapshot snap;
+        for (size_t i = 0; i < kBuckets; ++i) {
+            snap.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+            snap.count += snap.buckets[i];
+        }
+        if (snap.count == 0) {
+            return snap;
+        }
+
+        snap.mean_us = static_cast<double>(sum_us_.load(std::memory_order_relaxed)) / snap.count;
+        snap.max_us = static_cast<double>(max_us_.load(std::memory_order_relaxed));
+        snap.p50_us = percentile(snap, 0.50);
+        snap.p90_us = percentile(snap, 0.90);
+        snap.p99_us = percentile(snap, 0.99);
+        return snap;
+    }
+
+    // Exclusive upper edge of a bucket in microseconds
+    static constexpr double bucketUpperBoundUs(size_t bucket) {
+        return static_cast<double>(uint64_t{1} << bucket);
+    }
+
+private:
+    static double percentile(const Snapshot& snap, double fraction) {
+        uint64_t rank = static_cast<uint64_t>(fraction * (snap.count - 1)) + 1;
+        uint64_t seen = 0;
+        for (size_t i = 0; i < kBuckets; ++i) {
+            seen += snap.buckets[i];
+            if (seen >= rank) {
+                return std::min(bucketUpperBoundUs(i), snap.max_us);
+            }
+        }
+        return snap.max_us;
+    }
+
+    std::array<std::atomic<uint64_t>, kBuckets> buckets_{};
+    std::atomic<uint64_t> sum_us_{0};
+    std::atomic<uint64_t> max_us_{0};
+};
+
+/**
+ * Professional per-method slot
+ *
+ * queue_wait covers the time between the JS call and the start of the
+ * work on the thread that performs it (only recorded for methods that
+ * hop to the engine executor); execution covers the work itself.
+ */
+struct alignas(64) MethodSlot {
+    std::atomic<uint64_t> calls{0};
+    std::atomic<uint64_t> successes{0};
+    std::atomic<uint64_t> failures{0};
+    LatencyHistogram queue_wait;
+    LatencyHistogram execution;
+};
+
+/**
+ * Enhanced fixed table of method slots - recording never allocates or locks
+ */
+class MethodMetrics {
+public:
+    void recordCall(ModuleMethod method) {
+        mutableSlot(method).calls.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void recordOutcome(ModuleMethod method, bool success) {
+        MethodSlot& target = mutableSlot(method);
+        auto& counter = success ? target.successes : target.failures;
+        counter.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void recordQueueWait(ModuleMethod method, std::chrono::steady_clock::duration elapsed) {
+        mutableSlot(method).queue_wait.record(elapsed);
+    }
+
+    void recordExecution(ModuleMethod method, std::chrono::steady_clock::duration elapsed) {
+        mutableSlot(method).execution.record(elapsed);
+    }
+
+    const MethodSlot& slot(ModuleMethod method) const {
+        return slots_[static_cast<size_t>(method)];
+    }
+
+private:
+    MethodSlot& mutableSlot(ModuleMethod method) {
+        return slots_[static_cast<size_t>(method)];
+    }
+
+    std::array<MethodSlot, kModuleMethodCount> slots_{};
+};
+
+} // namespace TradingAnarchy
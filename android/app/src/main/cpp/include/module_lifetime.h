@@ -0,0 +1,88 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Module Lifetime - Owner Guard for Work That Outlives a JS Call
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+
+namespace TradingAnarchy {
+
+/**
+ * Professional guard between a module's destructor and its background tasks
+ *
+ * Tasks hold the guard by shared_ptr and enter() before every access to
+ * the module; a failed enter() means the module is gone. shutdown() turns
+ * away new entries and waits for the scopes already open, so the module
+ * is never freed while a task is inside it. Long work (PBKDF2, the
+ * diagnostics battery, topology loads) runs between scopes, so the
+ * destructor only waits for the short sections around it. Never call
+ * shutdown() from inside a scope.
+ */
+class ModuleLifetime {
+public:
+    class Scope {
+    public:
+        Scope() = default;
+        Scope(Scope&& other) noexcept : owner_(other.owner_) { other.owner_ = nullptr; }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        Scope& operator=(Scope&&) = delete;
+        ~Scope() {
+            if (owner_) {
+                owner_->leave();
+            }
+        }
+
+        explicit operator bool() const { return owner_ != nullptr; }
+
+    private:
+        friend class ModuleLifetime;
+        explicit Scope(ModuleLifetime* owner) : owner_(owner) {}
+
+        ModuleLifetime* owner_ = nullptr;
+    };
+
+    /**
+     * Enhanced entry - an empty scope once shutdown() has begun
+     */
+    Scope enter() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!alive_) {
+            return Scope();
+        }
+        ++active_;
+        return Scope(this);
+    }
+
+    /**
+     * Professional teardown - refuses new scopes and waits for open ones
+     */
+    void shutdown() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        alive_ = false;
+        idle_.wait(lock, [this] { return active_ == 0; });
+    }
+
+private:
+    void leave() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (--active_ == 0) {
+            idle_.notify_all();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable idle_;
+    size_t active_ = 0;
+    bool alive_ = true;
+};
+
+} // namespace TradingAnarchy
@@ -0,0 +1,129 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Native Executor - Background Worker Pool for Engine Operations
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace TradingAnarchy {
+
+/**
+ * Professional fixed-size worker pool
+ *
+ * Runs blocking engine operations away from the JS thread. Tasks are
+ * executed in FIFO order; callers hop back to JS through CallInvoker
+ * only to settle promises.
+ */
+class NativeExecutor {
+public:
+    using Task = std::function<void()>;
+    
+    explicit NativeExecutor(size_t worker_count = 2, const char* name = "ta-executor");
+    ~NativeExecutor();
+    
+    NativeExecutor(const NativeExecutor&) = delete;
+    NativeExecutor& operator=(const NativeExecutor&) = delete;
+    
+    /**
+     * Enhanced task submission - returns false once shutdown has begun
+     */
+    bool submit(Task task);
+    
+    /**
+     * Professional delayed submission - the task is queued once the delay elapses
+     */
+    bool submitAfter(std::chrono::milliseconds delay, Task task);
+    
+    /**
+     * Enhanced fork-join loop - runs body(0 .. count-1) on the pool and the caller
+     *
+     * The caller claims indices too and returns once every index has finished,
+     * so it never waits on helpers that are still queued behind other work.
+     * If body throws, the other indices still run and the first exception
+     * is rethrown once every index has finished. Safe to call from a worker
+     * of the same pool.
+     */
+    void parallelFor(size_t count, const std::function<void(size_t)>& body);
+    
+    /**
+     * Professional lifecycle management - drains queued tasks then joins
+     */
+    void shutdown();
+    
+    size_t workerCount() const { return workers_.size(); }
+    size_t pendingTasks() const;
+    uint64_t completedTasks() const { return completed_tasks_.load(std::memory_order_relaxed); }
+    
+    /**
+     * Shared engine executor used by the Turbo Module
+     */
+    static NativeExecutor& engine();
+    
+    /**
+     * Professional serial queue for engine lifecycle transitions
+     *
+     * A single worker keeps initialize/start/stop in submission order, and
+     * nothing else runs here, so they never wait behind diagnostics,
+     * watchdog captures or PBKDF2 on the engine pool.
+     */
+    static NativeExecutor& lifecycle();
+    
+    /**
+     * Enhanced serial queue for JS callback flushes
+     *
+     * Metrics flushes and their frame-aligned timers run here alone, so the
+     * delivery cadence never stretches behind seconds-long engine tasks.
+     */
+    static NativeExecutor& callbacks();
+    
+    /**
+     * Enhanced CPU-bound pool, one worker per core beyond the caller's, for
+     * short data-parallel kernels that must not queue behind engine tasks
+     */
+    static NativeExecutor& compute();
+
+private:
+    void workerLoop(size_t index);
+    void timerLoop();
+    
+    struct TimedTask {
+        std::chrono::steady_clock::time_point due;
+        uint64_t sequence;
+        Task task;
+        
+        bool operator>(const TimedTask& other) const {
+            return due != other.due ? due > other.due : sequence > other.sequence;
+        }
+    };
+    
+    std::vector<std::thread> workers_;
+    std::deque<Task> queue_;
+    mutable std::mutex queue_mutex_;
+    std::condition_variable queue_cv_;
+    bool stopping_ = false;
+    
+    std::thread timer_thread_;
+    std::priority_queue<TimedTask, std::vector<TimedTask>, std::greater<TimedTask>> timers_;
+    std::condition_variable timer_cv_;
+    uint64_t timer_sequence_ = 0;
+    
+    std::atomic<uint64_t> completed_tasks_{0};
+    const char* name_;
+};
+
+} // namespace TradingAnarchy
@@ -0,0 +1,212 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Promise Slab - Lock-Free Pending Promise Storage
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <optional>
+#include <utility>
+
+namespace TradingAnarchy {
+
+/**
+ * Professional fixed-capacity slab keyed by generation-tagged handles
+ *
+ * A handle packs the slot generation into the high 32 bits and the slot
+ * index + 1 into the low 32 bits, so 0 is never a valid handle and a
+ * stale handle from a recycled slot never matches. Insert pops a free
+ * slot from a tagged Treiber stack; take/reap claim a slot with a single
+ * CAS, so each entry is settled exactly once without locks or heap
+ * allocation by the slab itself.
+ */
+template <typename T, uint32_t Capacity>
+class PromiseSlab {
+    static_assert(Capacity > 0 && Capacity < 0xFFFFFFFFu, "invalid slab capacity");
+
+public:
+    using Handle = uint64_t;
+    using Clock = std::chrono::steady_clock;
+    static constexpr Handle kInvalidHandle = 0;
+
+    PromiseSlab() {
+        for (uint32_t i = 0; i < Capacity; ++i) {
+            slots_[i].next.store(i + 1 < Capacity ? i + 1 : kEndOfList, std::memory_order_relaxed);
+        }
+        free_head_.store(packHead(0, 0), std::memory_order_relaxed);
+    }
+
+    ~PromiseSlab() {
+        drain([](T&&) {});
+    }
+
+    PromiseSlab(const PromiseSlab&) = delete;
+    PromiseSlab& operator=(const PromiseSlab&) = delete;
+
+    /**
+     * Enhanced insertion - returns kInvalidHandle when the slab is full
+     */
+    Handle insert(T value, Clock::time_point deadline) {
+        uint32_t index = popFree();
+        if (index == kEndOfList) {
+            return kInvalidHandle;
+        }
+
+        Slot& slot = slots_[index];
+        uint64_t state = slot.state.load(std::memory_order_relaxed);
+        uint64_t generation = state >> kPhaseBits;
+
+        new (slot.storage()) T(std::move(value));
+        slot.deadline_ns.store(deadline.time_since_epoch().count(), std::memory_order_relaxed);
+        slot.state.store(pack(generation, kPending), std::memory_order_release);
+
+        in_flight_.fetch_add(1, std::memory_order_relaxed);
+        return (generation << 32) | static_cast<uint64_t>(index + 1);
+    }
+
+    /**
+     * Professional single-shot claim - moves the value out if the handle is live
+     */
+    std::optional<T> take(Handle handle) {
+        uint32_t index = static_cast<uint32_t>(handle & 0xFFFFFFFFu);
+        if (index == 0 || index > Capacity) {
+            return std::nullopt;
+        }
+        index -= 1;
+
+        uint64_t generation = handle >> 32;
+        uint64_t expected = pack(generation, kPending);
+        if (!slots_[index].state.compare_exchange_strong(
+                expected, pack(generation, kSettling),
+                std::memory_order_acq_rel, std::memory_order_relaxed)) {
+            return std::nullopt;
+        }
+
+        std::optional<T> value(std::move(*slots_[index].storage()));
+        release(index, generation);
+        return value;
+    }
+
+    /**
+     * Enhanced timeout sweep - hands every expired entry to onExpired
+     */
+    template <typename OnExpired>
+    size_t reapExpired(Clock::time_point now, OnExpired&& onExpired) {
+        const int64_t now_ns = now.time_since_epoch().count();
+        size_t reaped = 0;
+
+        for (uint32_t index = 0; index < Capacity; ++index) {
+            Slot& slot = slots_[index];
+            uint64_t state = slot.state.load(std::memory_order_acquire);
+            if ((state & kPhaseMask) != kPending ||
+                slot.deadline_ns.load(std::memory_order_relaxed) > now_ns) {
+                continue;
+            }
+
+            uint64_t generation = state >> kPhaseBits;
+            if (!slot.state.compare_exchange_strong(
+                    state, pack(generation, kSettling),
+                    std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                continue;  // settled concurrently
+            }
+
+            T value(std::move(*slot.storage()));
+            release(index, generation);
+            onExpired(std::move(value));
+            ++reaped;
+        }
+
+        return reaped;
+    }
+
+    /**
+     * Professional cleanup - settles every pending entry through onPending
+     */
+    template <typename OnPending>
+    void drain(OnPending&& onPending) {
+        reapExpired(Clock::time_point::max(), std::forward<OnPending>(onPending));
+    }
+
+    size_t inFlight() const { return in_flight_.load(std::memory_order_relaxed); }
+    static constexpr uint32_t capacity() { return Capacity; }
+
+private:
+    static constexpr uint32_t kEndOfList = 0xFFFFFFFFu;
+    static constexpr uint64_t kPhaseBits = 2;
+    static constexpr uint64_t kPhaseMask = (1u << kPhaseBits) - 1;
+    static constexpr uint64_t kFree = 0;
+    static constexpr uint64_t kPending = 1;
+    static constexpr uint64_t kSettling = 2;
+    static constexpr uint64_t kGenerationMask = (uint64_t{1} << 30) - 1;
+
+    struct Slot {
+        std::atomic<uint64_t> state{0};
+        std::atomic<int64_t> deadline_ns{0};
+        std::atomic<uint32_t> next{0};
+        alignas(T) unsigned char bytes[sizeof(T)];
+
+        T* storage() { return std::launder(reinterpret_cast<T*>(bytes)); }
+    };
+
+    static uint64_t pack(uint64_t generation, uint64_t phase) {
+        return (generation << kPhaseBits) | phase;
+    }
+
+    static uint64_t packHead(uint32_t tag, uint32_t index) {
+        return (static_cast<uint64_t>(tag) << 32) | index;
+    }
+
+    void release(uint32_t index, uint64_t generation) {
+        Slot& slot = slots_[index];
+        slot.storage()->~T();
+
+        slot.state.store(pack((generation + 1) & kGenerationMask, kFree), std::memory_order_release);
+        in_flight_.fetch_sub(1, std::memory_order_relaxed);
+        pushFree(index);
+    }
+
+    uint32_t popFree() {
+        uint64_t head = free_head_.load(std::memory_order_acquire);
+        for (;;) {
+            uint32_t index = static_cast<uint32_t>(head);
+            if (index == kEndOfList) {
+                return kEndOfList;
+            }
+            uint32_t next = slots_[index].next.load(std::memory_order_relaxed);
+            uint64_t replacement = packHead(static_cast<uint32_t>(head >> 32) + 1, next);
+            if (free_head_.compare_exchange_weak(head, replacement,
+                                                 std::memory_order_acq_rel,
+                                                 std::memory_order_acquire)) {
+                return index;
+            }
+        }
+    }
+
+    void pushFree(uint32_t index) {
+        uint64_t head = free_head_.load(std::memory_order_relaxed);
+        for (;;) {
+            slots_[index].next.store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+            uint64_t replacement = packHead(static_cast<uint32_t>(head >> 32) + 1, index);
+            if (free_head_.compare_exchange_weak(head, replacement,
+                                                 std::memory_order_release,
+                                                 std::memory_order_relaxed)) {
+                return;
+            }
+        }
+    }
+
+    Slot slots_[Capacity];
+    std::atomic<uint64_t> free_head_{0};
+    std::atomic<size_t> in_flight_{0};
+};
+
+} // namespace TradingAnarchy
@@ -0,0 +1,95 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Regression Bench - Reproducible Benchmark Runs Against a Stored Baseline
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#pragma once
+
+#include "bench_stats.h"
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace TradingAnarchy {
+namespace RegressionBench {
+
+constexpr uint64_t kDefaultSeed = 0x5441'2025'0100'0001ull;
+
+/**
+ * Professional run request
+ *
+ * Every repetition hashes the same seeded inputs on the same pinned
+ * CPUs and waits for the device to cool to cooldown_celsius first, so
+ * two runs differ only by the device's state and the build under test.
+ */
+struct Options {
+    std::string directory;                  // baseline store, normally the app's filesDir
+    std::string algorithm = "rx/0";         // scratchpad size and thread plan
+    uint64_t seed = kDefaultSeed;
+    uint32_t threads = 0;                   // 0 takes the thread planner's count
+    uint32_t repetitions = 10;
+    uint32_t hashes_per_thread = 32;        // fixed work per repetition
+    double cooldown_celsius = 45.0;         // hottest thermal zone, before each repetition
+    std::chrono::seconds cooldown_timeout{600};
+    double alpha = 0.05;
+    double min_regression = 0.03;           // smaller significant slowdowns still pass
+    bool update_baseline = false;           // replace the stored baseline with this run
+};
+
+/**
+ * Enhanced verdict
+ *
+ * REGRESS needs a Mann-Whitney p-value under alpha and a Hodges-Lehmann
+ * slowdown of at least min_regression. NO_BASELINE stores the run as
+ * the baseline. ERROR covers failed runs and a checksum that differs
+ * from the baseline's, meaning the two builds did not do the same work.
+ */
+enum class Verdict : uint8_t { PASS = 0, REGRESS, NO_BASELINE, ERROR };
+
+struct Result {
+    bool success = false;
+    std::string error;
+
+    std::string key;                        // baseline entry: algorithm, threads, work and seed
+    size_t scratchpad_bytes = 0;
+    uint32_t threads = 0;
+    std::vector<uint32_t> cpus;
+    bool pinned = false;                    // every thread got its CPU
+
+    bool thermal_available = false;         // false skips the cool-down gate
+    std::vector<double> start_celsius;      // per repetition, after cool-down
+    double cooldown_seconds = 0.0;          // total wait
+
+    std::vector<double> hashrates;          // H/s per repetition
+    BenchStats::Summary summary;
+    std::string checksum;                   // over every digest of one repetition
+
+    bool have_baseline = false;
+    std::vector<double> baseline;
+    long long baseline_time = 0;            // unix seconds
+    BenchStats::MannWhitneyResult test;     // current against baseline
+    Verdict verdict = Verdict::ERROR;
+    bool baseline_updated = false;
+    double duration_seconds = 0.0;
+};
+
+/**
+ * Professional blocking run - minutes on phones, call from a worker thread
+ */
+Result run(const Options& options);
+
+const char* verdictName(Verdict verdict);
+
+/**
+ * Enhanced hottest thermal zone in Celsius, NaN when none is readable
+ */
+double hottestZoneCelsius();
+
+} // namespace RegressionBench
+} // namespace TradingAnarchy
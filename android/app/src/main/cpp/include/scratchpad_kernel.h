@@ -0,0 +1,99 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Scratchpad Kernel - CryptoNight-Style Memory-Hard Hashing and Cache Sweeps
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#pragma once
+
+#include "kernel_dispatch.h"
+#include "large_pages.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace TradingAnarchy {
+namespace Scratchpad {
+
+constexpr size_t kMinBytes = 256 * 1024;
+constexpr size_t kMaxBytes = 2 * 1024 * 1024;
+constexpr size_t kDigestBytes = 32;
+
+/**
+ * Professional main-loop signature
+ *
+ * Runs `iterations` CryptoNight-shaped rounds over a power-of-two
+ * scratchpad: each round reads a 16-byte slot chosen by the running
+ * state, mixes and writes it back, then does a dependent
+ * multiply-accumulate read-modify-write at an address taken from the
+ * mixed value. state holds the two 128-bit registers (a, b) and is
+ * updated in place.
+ */
+using MainLoopFn = void (*)(uint8_t* scratchpad, size_t bytes, size_t iterations, uint64_t state[4]);
+
+/**
+ * Enhanced scratchpad size for an xmrig algorithm name
+ *
+ * cn-pico uses 256 KiB, cn-lite 1 MiB and the other cn variants 2 MiB.
+ * cn-heavy's 4 MiB is clamped to kMaxBytes.
+ */
+size_t scratchpadBytesFor(const std::string& algorithm);
+
+/**
+ * Professional bytes clamped to [kMinBytes, kMaxBytes] and rounded down to a power of two
+ */
+size_t normalizeBytes(size_t bytes);
+
+/**
+ * Enhanced round count - bytes / 4, CryptoNight's iterations-to-memory ratio
+ */
+size_t iterationsFor(size_t bytes);
+
+/**
+ * Professional one-shot hash
+ *
+ * A Keccak-seeded fill of the scratchpad, the dispatched main loop over it
+ * and a Keccak finalization over every scratchpad word. `bytes` must be a
+ * normalized size and the scratchpad at least that large.
+ */
+void hash(const uint8_t* input, size_t length, uint8_t* scratchpad, size_t bytes, uint8_t out[kDigestBytes]);
+
+/**
+ * Enhanced benchmark outcome
+ */
+struct BenchResult {
+    size_t scratchpad_bytes = 0;
+    uint32_t threads = 0;
+    uint64_t hashes = 0;
+    double seconds = 0.0;
+    double hashes_per_sec = 0.0;            // summed over threads
+    double ns_per_iteration = 0.0;          // main loop only, averaged over threads
+    LargePageBuffer::Mode page_mode = LargePageBuffer::Mode::NONE;
+};
+
+/**
+ * Professional blocking benchmark - one scratchpad per thread from the
+ * large-page allocator; threads = 0 uses every core
+ */
+BenchResult benchmark(size_t bytes, uint32_t threads, double seconds);
+
+/**
+ * Enhanced single-thread sweep from kMinBytes to kMaxBytes, doubling
+ *
+ * ns_per_iteration steps up where the scratchpad outgrows L2 and again
+ * where it outgrows L3 (or the system cache).
+ */
+std::vector<BenchResult> sweep(double seconds_per_size);
+
+/**
+ * Professional dispatcher for the main loop, exposed for diagnostics and benches
+ */
+KernelDispatch<MainLoopFn>& mainLoopKernel();
+
+} // namespace Scratchpad
+} // namespace TradingAnarchy
@@ -0,0 +1,117 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Security Manager - Parallel Memory-Mapped Integrity Verification
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#pragma once
+
+#include "keccak.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace TradingAnarchy {
+
+/**
+ * Professional per-file integrity result
+ */
+struct FileIntegrity {
+    std::string path;
+    std::string digest;             // hex tree hash, empty when unreadable
+    uint64_t size = 0;
+    bool cached = false;            // stat matched the cache, file not read
+    bool modified = false;          // digest differs from this install's baseline
+};
+
+struct IntegrityReport {
+    bool valid = false;
+    std::string fingerprint;        // hash over every file name and digest
+    std::vector<FileIntegrity> files;
+    std::vector<std::string> missing;
+    std::vector<std::string> modified;
+    uint32_t files_hashed = 0;
+    uint64_t bytes_hashed = 0;
+    double duration_ms = 0.0;
+};
+
+/**
+ * Enhanced integrity checker for the native libraries and the APK (assets)
+ *
+ * Files are mmap'd and hashed as a binary tree of SHA3-256 nodes over
+ * fixed-size chunks, with leaves hashed in parallel (batched through the
+ * interleaved Keccak permutation on large files). Digests are cached
+ * by (device, inode, size, mtime), so once a file has been hashed a
+ * check costs one stat() until the file changes.
+ *
+ * A file's baseline is the first digest seen for it under the current
+ * install time, so an app update re-baselines instead of reporting every
+ * updated file as modified. Cache entries for paths no longer verified
+ * are dropped.
+ */
+class SecurityManager {
+public:
+    static constexpr size_t kChunkSize = 1u << 20;
+
+    static SecurityManager& instance();
+
+    /**
+     * Professional persistent cache location, normally the app's filesDir;
+     * without one results are only cached for the life of the process
+     */
+    void setCacheDirectory(const std::string& directory);
+
+    /**
+     * Enhanced check of paths against their baselines; install_time_ns
+     * identifies the install, see installTime()
+     */
+    IntegrityReport verify(const std::vector<std::string>& paths, int64_t install_time_ns);
+
+    /**
+     * Enhanced default targets - every .so in the native library directory
+     * plus the installed APKs that hold the assets
+     */
+    static std::vector<std::string> defaultTargets(const std::string& native_lib_dir);
+
+    /**
+     * Professional fallback install time - mtime (ns) of the app's install
+     * directory, which the package manager recreates on every install or
+     * update; 0 outside an installed app. Prefer PackageInfo.lastUpdateTime.
+     */
+    static int64_t installTime(const std::string& native_lib_dir);
+
+    /**
+     * Professional tree hash of a file - hex digest, empty on I/O error
+     */
+    static std::string hashFile(const std::string& path, uint64_t* size = nullptr);
+
+private:
+    struct CacheEntry {
+        uint64_t device = 0;
+        uint64_t inode = 0;
+        uint64_t size = 0;
+        int64_t mtime_ns = 0;
+        std::string digest;
+        std::string baseline;       // first digest seen at this path under install_time_ns
+        int64_t install_time_ns = 0;
+    };
+
+    SecurityManager() = default;
+
+    void loadCache();
+    bool saveCache() const;
+
+    std::mutex mutex_;
+    std::string cache_path_;
+    bool cache_loaded_ = false;
+    std::map<std::string, CacheEntry> cache_;
+};
+
+} // namespace TradingAnarchy
@@ -0,0 +1,165 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Share Verifier - Batched Local Pre-Verification of Candidate Shares
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#pragma once
+
+#include "large_pages.h"
+#include "scratchpad_kernel.h"
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace TradingAnarchy {
+
+/**
+ * Professional pre-submission check for candidate shares
+ *
+ * Hashing threads hand every candidate to enqueue(), which only copies it
+ * into a queue. A dedicated verifier thread drains the queue in batches,
+ * reusing one scratchpad across the batch, and passes a candidate to the
+ * submit callback only when:
+ *   - its job ID is the current job's (else STALE),
+ *   - its nonce has not been seen for this job (else DUPLICATE_NONCE),
+ *   - the recomputed hash equals the hash the worker reported (else
+ *     HASH_MISMATCH, which points at a kernel bug; the nonce is only
+ *     recorded as seen once its hash matched),
+ *   - the hash meets the job target (else LOW_DIFFICULTY).
+ * Local rejects are counted by reason and never reach the pool.
+ */
+class ShareVerifier {
+public:
+    enum class Reason : uint8_t {
+        STALE = 0,
+        LOW_DIFFICULTY,
+        DUPLICATE_NONCE,
+        HASH_MISMATCH,
+        COUNT
+    };
+
+    static constexpr size_t kReasonCount = static_cast<size_t>(Reason::COUNT);
+    static constexpr size_t kMaxBatch = 64;
+    static constexpr size_t kQueueCapacity = 4096;
+    static constexpr size_t kDefaultNonceOffset = 39;     // Monero hashing blob
+
+    /**
+     * Enhanced job as received from the pool
+     *
+     * target is the 64-bit share target: a hash passes when its last eight
+     * bytes, read little-endian, are below it (see targetFromHex()).
+     */
+    struct Job {
+        std::string job_id;
+        std::vector<uint8_t> blob;
+        size_t nonce_offset = kDefaultNonceOffset;
+        uint64_t target = 0;
+        size_t scratchpad_bytes = Scratchpad::kMaxBytes;
+    };
+
+    /**
+     * Professional result reported by a hashing thread
+     */
+    struct Candidate {
+        std::string job_id;
+        uint32_t nonce = 0;
+        std::array<uint8_t, Scratchpad::kDigestBytes> hash{};
+        uint32_t worker = 0;
+    };
+
+    struct Stats {
+        uint64_t enqueued = 0;
+        uint64_t dropped = 0;           // queue full or job unhashable; never submitted
+        uint64_t verified = 0;
+        uint64_t submitted = 0;
+        std::array<uint64_t, kReasonCount> rejected{};
+        uint64_t batches = 0;
+        double mean_batch_size = 0.0;
+        double hash_us = 0.0;           // mean recomputation time per hashed candidate
+    };
+
+    using SubmitFn = std::function<void(const Candidate&)>;
+
+    explicit ShareVerifier(SubmitFn submit);
+    ~ShareVerifier();
+
+    ShareVerifier(const ShareVerifier&) = delete;
+    ShareVerifier& operator=(const ShareVerifier&) = delete;
+
+    /**
+     * Professional job switch - queued candidates for the old job become stale
+     */
+    void setJob(Job job);
+
+    /**
+     * Enhanced hand-off from a hashing thread - false when the queue is full
+     */
+    bool enqueue(const Candidate& candidate);
+
+    /**
+     * Professional wait until every queued candidate has been verified
+     */
+    void drain();
+
+    Stats stats() const;
+
+    static const char* reasonName(Reason reason);
+
+    /**
+     * Enhanced stratum target parsing
+     *
+     * Pools send 8 hex digits (a 32-bit little-endian compact target,
+     * expanded as xmrig does) or 16 (the 64-bit target itself).
+     * Returns 0 for anything else.
+     */
+    static uint64_t targetFromHex(const std::string& hex);
+
+    static bool meetsTarget(const uint8_t hash[Scratchpad::kDigestBytes], uint64_t target);
+
+private:
+    void workerLoop();
+    void verifyBatch(const std::vector<Candidate>& batch, const std::shared_ptr<const Job>& job);
+    void reject(Reason reason);
+
+    SubmitFn submit_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable idle_;
+    std::vector<Candidate> queue_;
+    std::shared_ptr<const Job> job_;
+    bool busy_ = false;
+    bool stopping_ = false;
+
+    // Owned by the verifier thread
+    std::string seen_job_;
+    std::unordered_set<uint32_t> seen_nonces_;
+    LargePageBuffer scratchpad_;
+
+    std::atomic<uint64_t> enqueued_{0};
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<uint64_t> verified_{0};
+    std::atomic<uint64_t> submitted_{0};
+    std::array<std::atomic<uint64_t>, kReasonCount> rejected_{};
+    std::atomic<uint64_t> batches_{0};
+    std::atomic<uint64_t> hashed_{0};
+    std::atomic<uint64_t> hash_ns_{0};
+
+    std::thread worker_;
+};
+
+} // namespace TradingAnarchy
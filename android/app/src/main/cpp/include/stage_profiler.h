@@ -0,0 +1,107 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Stage Profiler - RandomX Stage Timings from Profiling Miner Builds
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace TradingAnarchy {
+namespace StageProfiler {
+
+/**
+ * Professional RandomX stage buckets for xmrig PROFILE_SCOPE names
+ */
+enum class Stage : uint8_t {
+    PROGRAM_GENERATION = 0,     // program generation and JIT compile
+    EXECUTION,                  // VM / JIT program execution
+    HASHING,                    // Blake2b, AES fill and the hash wrapper
+    OTHER,
+    COUNT
+};
+
+constexpr size_t kStageCount = static_cast<size_t>(Stage::COUNT);
+
+const char* stageName(Stage stage);
+Stage classifyScope(const std::string& scope);
+
+/**
+ * Enhanced timing of one profile scope as last reported by xmrig
+ *
+ * Scopes nest (the hash scope contains the others), so stage totals
+ * are sums of per-call means, not a partition of wall time.
+ */
+struct ScopeTiming {
+    std::string scope;
+    Stage stage = Stage::OTHER;
+    double mean_ns = 0.0;               // per call, averaged over threads
+    double share_percent = 0.0;         // of the thread's outermost scope
+    uint32_t threads = 0;               // lines in the latest report
+    uint64_t reports = 0;
+    double last_update_ms = 0.0;
+};
+
+struct ProfileSnapshot {
+    std::vector<ScopeTiming> scopes;
+    double stage_ns[kStageCount] = {};
+    uint64_t reports = 0;
+    double last_update_ms = 0.0;
+};
+
+/**
+ * Professional collector fed with xmrig output lines
+ *
+ * Both the mining process (via MiningService) and the bench runner feed
+ * lines in; non-profiler lines are ignored cheaply.
+ */
+class Collector {
+public:
+    static constexpr size_t kMaxTraceSamples = 4096;
+
+    static Collector& instance();
+
+    /**
+     * Enhanced line ingestion - returns true if the line carried profile data
+     */
+    bool ingestLine(const std::string& line);
+
+    ProfileSnapshot snapshot() const;
+
+    /**
+     * Professional Chrome trace-event JSON (chrome://tracing, Perfetto)
+     *
+     * One counter track per stage and per scope, one sample per xmrig report.
+     */
+    std::string exportTrace() const;
+
+    void reset();
+
+private:
+    struct TraceSample {
+        double timestamp_ms;
+        std::string scope;
+        double mean_ns;
+    };
+
+    Collector() = default;
+
+    mutable std::mutex mutex_;
+    std::map<std::string, ScopeTiming> scopes_;
+    std::deque<TraceSample> trace_;
+    uint64_t reports_ = 0;
+    double last_update_ms_ = 0.0;
+};
+
+} // namespace StageProfiler
+} // namespace TradingAnarchy
@@ -0,0 +1,235 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Telemetry Simulator - Seeded Synthetic Mining Events for Pipeline Load Testing
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#pragma once
+
+#include "live_metrics.h"
+#include "share_verifier.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace TradingAnarchy {
+
+/**
+ * Professional synthetic mining telemetry
+ *
+ * One thread per simulated worker plus one device thread, each with its
+ * own PRNG seeded from Config::seed and the thread's index, so a seed
+ * reproduces every thread's event stream whatever the scheduling.
+ * Events arrive as Poisson processes at the configured rates in
+ * simulated time, which runs rate_multiplier times faster than the wall
+ * clock - 100 replays a realistic session at 100x its event rates.
+ *
+ * Worker threads own their hashrate and find shares: real candidates
+ * hashed with the scratchpad kernel against the current job, mixed with
+ * stale, duplicate, low-difficulty and corrupted ones at the configured
+ * fractions. The device thread owns the hashrate ticks, temperature,
+ * pool disconnects and job switches. Sinks run on the emitting thread
+ * and are timed, so a slow pipeline shows up as sink time and lag.
+ */
+class TelemetrySimulator {
+public:
+    static constexpr uint32_t kMaxWorkers = LiveMetricsLayout::kMaxThreads;
+
+    struct Config {
+        uint64_t seed = 1;
+        uint32_t workers = 4;
+        double rate_multiplier = 1.0;           // simulated seconds per wall second
+
+        double base_hashrate = 250.0;           // per worker, H/s
+        double hashrate_tick_hz = 1.0;
+        double shares_per_minute = 2.0;         // whole device
+        double temperature_hz = 0.2;
+        double disconnects_per_hour = 1.0;
+        double disconnect_seconds = 8.0;
+        double job_interval_seconds = 120.0;
+
+        // Fractions of found shares; the rest are valid
+        double stale_fraction = 0.02;
+        double duplicate_fraction = 0.01;
+        double low_difficulty_fraction = 0.02;
+        double hash_mismatch_fraction = 0.0;
+        double pool_reject_fraction = 0.01;     // of verified shares, applied by the host
+    };
+
+    /**
+     * Enhanced device-wide sample, one per hashrate tick
+     */
+    struct Tick {
+        double timestamp_ms = 0.0;              // start time plus simulated time
+        double uptime_seconds = 0.0;            // simulated
+        uint32_t workers = 0;
+        double worker_hashrate[kMaxWorkers] = {};
+        double hashrate = 0.0;
+        double total_hashes = 0.0;
+        double temperature = 0.0;
+        bool connected = true;
+    };
+
+    /**
+     * Professional share found by a worker
+     *
+     * expected is the verifier's verdict by construction, COUNT when the
+     * share is valid.
+     */
+    struct Share {
+        ShareVerifier::Candidate candidate;
+        ShareVerifier::Reason expected = ShareVerifier::Reason::COUNT;
+    };
+
+    /**
+     * Enhanced event sinks - any may be empty
+     *
+     * tick, job and connection come from the device thread only; share
+     * comes from the worker threads concurrently.
+     */
+    struct Sink {
+        std::function<void(const Tick&)> tick;
+        std::function<void(const Share&)> share;
+        std::function<void(const ShareVerifier::Job&)> job;
+        std::function<void(bool connected)> connection;
+    };
+
+    enum class EventType : uint8_t {
+        TICK = 0,
+        SHARE,
+        TEMPERATURE,
+        CONNECTION,
+        JOB,
+        COUNT
+    };
+
+    static constexpr size_t kEventTypeCount = static_cast<size_t>(EventType::COUNT);
+
+    struct Stats {
+        bool running = false;
+        uint64_t seed = 0;
+        double rate_multiplier = 0.0;
+        double wall_seconds = 0.0;
+        double simulated_seconds = 0.0;
+        std::array<uint64_t, kEventTypeCount> events{};
+        std::array<double, kEventTypeCount> sink_mean_us{};
+        std::array<double, kEventTypeCount> sink_max_us{};
+        double max_lag_ms = 0.0;                // wall time a thread woke after its event was due
+        uint64_t lost_shares = 0;               // found while disconnected
+        uint64_t worker_restarts = 0;
+    };
+
+    explicit TelemetrySimulator(Sink sink);
+    ~TelemetrySimulator();
+
+    TelemetrySimulator(const TelemetrySimulator&) = delete;
+    TelemetrySimulator& operator=(const TelemetrySimulator&) = delete;
+
+    /**
+     * Professional start - false when already running or the config is unusable
+     */
+    bool start(const Config& config);
+    void stop();
+    bool running() const { return running_.load(std::memory_order_acquire); }
+
+    /**
+     * Enhanced single-worker restart - the worker rejoins with a fresh stream
+     */
+    bool restartWorker(uint32_t worker);
+
+    /**
+     * Professional kernel tid of a worker thread, 0 when not running
+     */
+    int32_t workerTid(uint32_t worker) const;
+
+    Config config() const;
+    Stats stats() const;
+
+    static const char* eventName(EventType type);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    // Lives from start() to stop(); a restart only replaces the thread
+    struct WorkerState {
+        std::thread thread;
+        std::atomic<bool> stop{false};
+        std::atomic<double> hashrate{0.0};
+        std::atomic<int32_t> tid{0};
+        uint32_t generation = 0;
+    };
+
+    // A worker thread's share-finding state
+    struct ShareSource {
+        uint32_t index = 0;
+        uint32_t generation = 0;
+        uint32_t counter = 0;
+        std::mt19937_64 rng;
+        LargePageBuffer scratchpad;
+        std::vector<uint8_t> blob;
+        Share last;
+        bool have_last = false;
+    };
+
+    struct Timing {
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> total_ns{0};
+        std::atomic<uint64_t> max_ns{0};
+    };
+
+    void deviceLoop();
+    void workerLoop(uint32_t index, uint32_t generation);
+    void spawnWorker(WorkerState& worker, uint32_t index);
+    void findShare(ShareSource& source);
+
+    /**
+     * Sleeps until simulated time reaches due_sim_seconds - false once stopping
+     */
+    bool waitUntil(double due_sim_seconds, const std::atomic<bool>& worker_stop);
+    double simulatedNow() const;
+    void noteLag(double due_sim_seconds);
+
+    template <typename Fn>
+    void emit(EventType type, Fn&& call);
+
+    Sink sink_;
+    Config config_;
+
+    mutable std::mutex control_mutex_;          // start, stop and restarts
+    mutable std::mutex mutex_;                  // jobs and the wake condition
+    std::condition_variable wake_;
+    std::atomic<bool> running_{false};
+    std::atomic<bool> stopping_{false};
+
+    Clock::time_point started_{};
+    Clock::time_point stopped_at_{};
+    double started_epoch_ms_ = 0.0;
+
+    std::thread device_;
+    std::array<std::unique_ptr<WorkerState>, kMaxWorkers> workers_;
+
+    std::shared_ptr<const ShareVerifier::Job> job_;
+    std::shared_ptr<const ShareVerifier::Job> previous_job_;
+    std::atomic<double> temperature_{0.0};
+    std::atomic<bool> connected_{true};
+
+    std::array<Timing, kEventTypeCount> timings_;
+    std::atomic<uint64_t> max_lag_ns_{0};
+    std::atomic<uint64_t> lost_shares_{0};
+    std::atomic<uint64_t> worker_restarts_{0};
+};
+
+} // namespace TradingAnarchy
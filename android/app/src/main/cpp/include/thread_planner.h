@@ -0,0 +1,134 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Thread Planner - Cache-Aware Thread Count and Core Set per Algorithm
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace TradingAnarchy {
+namespace ThreadPlanner {
+
+constexpr uint32_t kNoCache = UINT32_MAX;
+
+/**
+ * Professional cache instance shared by one or more CPUs
+ */
+struct Cache {
+    uint32_t level = 0;
+    uint64_t bytes = 0;
+    uint32_t sharers = 0;               // CPUs below this cache
+};
+
+/**
+ * Enhanced per-CPU view of the topology
+ *
+ * Weight is the CPU kind's relative single-thread speed, 1.0 for the
+ * fastest kind: the kernel's cpu_capacity when hwloc reports it, else
+ * an estimate from the kind's efficiency rank.
+ */
+struct Cpu {
+    uint32_t os_index = 0;
+    uint32_t smt_rank = 0;              // 0 for the first hardware thread of its core
+    double weight = 1.0;
+    uint32_t l2 = kNoCache;             // index into Topology::caches
+    uint32_t llc = kNoCache;            // outermost cache; may equal l2 when there is no L3
+};
+
+/**
+ * Professional planner input
+ *
+ * Android kernels often leave the sysfs cache directories empty, in which
+ * case hwloc has no cache objects and plan() takes the sizes from the
+ * memory probe when it has run, else from conservative phone defaults.
+ * `source` says where the cache sizes came from.
+ */
+struct Topology {
+    std::vector<Cpu> cpus;
+    std::vector<Cache> caches;
+    std::string source;                 // "hwloc", "probe", "default", or "" before plan() resolves it
+    double miss_penalty = 0.0;          // DRAM over last-level cache latency
+    uint32_t saturation_threads = 0;    // from the memory probe once it has run
+
+    bool from_cache = false;            // loaded from the cached XML rather than sysfs
+    double load_ms = 0.0;               // this process
+    double discovery_ms = 0.0;          // the sysfs discovery that produced the hwloc view
+};
+
+/**
+ * Enhanced recommendation for one algorithm
+ *
+ * Throughputs are relative to one thread on the fastest core with its
+ * scratchpad in cache, so 3.2 means about 3.2 such threads' worth.
+ * `predicted` has one entry per thread count, 1 to every CPU, with the
+ * CPUs added in `cpus` order.
+ */
+struct Plan {
+    std::string algorithm;
+    bool known_algorithm = false;       // false falls back to a 2 MiB working set
+    size_t scratchpad_bytes = 0;
+
+    uint32_t threads = 0;
+    std::vector<uint32_t> cpus;         // OS indexes to pin to, fastest first
+    double relative_throughput = 0.0;
+    double all_cores_relative_throughput = 0.0;
+    std::vector<double> predicted;
+    std::string limited_by;             // "cores", "cache" or "bandwidth"
+    std::string topology_source;
+};
+
+/**
+ * Professional per-thread working set of a mining algorithm
+ *
+ * The scratchpad each hashing thread keeps hot: 2 MiB for RandomX and
+ * CryptoNight, with the light and heavy variants at their own sizes.
+ */
+size_t scratchpadBytesFor(const std::string& algorithm, bool* known = nullptr);
+
+/**
+ * Professional persistent topology cache, normally the app's filesDir
+ *
+ * hwloc's sysfs discovery takes tens of milliseconds on phones, so the
+ * discovered topology is exported to XML there and later processes load
+ * that instead. The file is keyed on the kernel build, the possible and
+ * online CPU lists and the process CPU affinity, and is rediscovered and
+ * rewritten when any of them changes. Only takes effect before the first
+ * topology() call.
+ */
+void setCacheDirectory(const std::string& directory);
+
+/**
+ * Enhanced cached hwloc view - the first call loads it, later calls return it
+ *
+ * Cache sizes are only what hwloc found; plan() fills in the gaps.
+ */
+const Topology& topology();
+
+/**
+ * Professional non-blocking view - nullptr until some caller has run topology()
+ */
+const Topology* cachedTopology();
+
+/**
+ * Professional recommendation from the topology alone, no benchmark
+ *
+ * Threads are added fastest CPU first, spread across last-level caches,
+ * and each count is scored with a hit-rate model: a thread whose
+ * scratchpad fits its L2 runs at its core's speed; the rest share their
+ * last-level cache, and once the scratchpads outgrow it every sharer
+ * pays the DRAM penalty on the missing fraction, more so past the
+ * bandwidth saturation point. The smallest count within 1% of the best
+ * score wins, since extra threads only add heat.
+ */
+Plan plan(const std::string& algorithm);
+
+} // namespace ThreadPlanner
+} // namespace TradingAnarchy
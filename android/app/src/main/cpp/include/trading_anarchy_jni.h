@@ -13,6 +13,7 @@
 #include <jni.h>
 #include <android/log.h>
 #include <string>
+#include <vector>
 #include <memory>
 #include <atomic>
 #include <mutex>
@@ -87,6 +88,18 @@ struct ComputeConfig {
     SecurityConfig security;
 };
 
+/**
+ * Professional engine tuning snapshot
+ *
+ * Plain value type - copied between the JS thread, the configuration
+ * mutex and engine worker lambdas, so it must stay free of atomics.
+ */
+struct EngineConfig {
+    uint32_t max_threads = 0;  // 0 = auto-detect
+    int thread_priority = 1;
+    bool enable_huge_pages = false;
+};
+
 /**
  * Professional JNI Bridge Class with 2025 Architecture
  */
@@ -133,6 +146,19 @@ public:
      */
     bool initialize(JNIEnv* env, jobject callback_object);
     
+    /**
+     * Professional Turbo Module entry points - in-process, no JNIEnv
+     */
+    bool initialize();
+    bool isInitialized() const;
+    bool initializeEngine(const EngineConfig& config);
+    bool startEngine();
+    bool stopEngine();
+    bool pauseEngine();
+    bool resumeEngine();
+    bool updateConfiguration(const EngineConfig& config);
+    PerformanceMetrics getPerformanceMetrics() const;
+    
     /**
      * Enhanced compute engine lifecycle management
      */
@@ -164,6 +190,8 @@ public:
      */
     bool validateSecurityConfiguration(const SecurityConfig& config) const;
     bool enableSecureMode(bool enabled);
+    bool verifyIntegrity() const;
+    std::string getSecurityFingerprint() const;
     
     /**
      * Professional error handling
@@ -229,6 +257,29 @@ private:
     bool validateCredentials(const std::string& username, const std::string& password) const;
 };
 
+/**
+ * Compute bridge entry points shared with the Turbo Module
+ */
+std::string computeBridgeHash(const std::string& input, const std::string& algorithm);
+std::vector<std::string> computeBridgeHashBatch(const std::vector<std::string>& inputs, const std::string& algorithm);
+
+namespace Crypto {
+std::vector<uint8_t> generateSecureRandom(size_t length);
+std::vector<uint8_t> deriveKeyPBKDF2(
+    const std::string& password,
+    const std::vector<uint8_t>& salt,
+    int iterations,
+    int keyLength);
+std::vector<uint8_t> encryptAES256GCM(
+    const std::vector<uint8_t>& plaintext,
+    const std::vector<uint8_t>& key,
+    const std::vector<uint8_t>& iv,
+    std::vector<uint8_t>& tag);
+std::vector<uint8_t> computeHMAC_SHA256(
+    const std::vector<uint8_t>& data,
+    const std::vector<uint8_t>& key);
+} // namespace Crypto
+
 } // namespace TradingAnarchy
 
 // Professional C-style JNI function declarations for Android runtime
@@ -308,6 +359,36 @@ JNIEXPORT void JNICALL
 Java_com_tradinganarchy_computeengine_ComputeEngine_nativeCleanup(
     JNIEnv* env, jobject thiz);
 
+/**
+ * Enhanced miner launch - best installed libxmrig variant for this CPU
+ */
+JNIEXPORT jstring JNICALL
+Java_com_xmrigforandroid_MiningService_nativeSelectXmrigBinary(
+    JNIEnv* env, jclass clazz, jstring native_lib_dir, jstring base_name);
+
+/**
+ * Professional miner output tap - true when the line carried stage timings
+ */
+JNIEXPORT jboolean JNICALL
+Java_com_xmrigforandroid_MiningService_nativeIngestMinerOutput(
+    JNIEnv* env, jclass clazz, jstring line);
+
+/**
+ * Enhanced xmrig "hw-aes" hint - 1 when hardware AES measured faster than soft AES,
+ * 0 when it did not, -1 while the measurement is still running
+ */
+JNIEXPORT jint JNICALL
+Java_com_xmrigforandroid_MiningService_nativeHardwareAesPreference(
+    JNIEnv* env, jclass clazz);
+
+/**
+ * Professional topology cache location - the app's filesDir; also warms the thread
+ * planner and times the AES round variants
+ */
+JNIEXPORT void JNICALL
+Java_com_xmrigforandroid_MiningService_nativeSetTopologyCacheDirectory(
+    JNIEnv* env, jclass clazz, jstring files_dir);
+
 } // extern "C"
 
 #endif // TRADING_ANARCHY_JNI_H
\ No newline at end of file
@@ -12,6 +12,8 @@
 // Mock React Native headers for development IntelliSense
 // These will be replaced with actual React Native headers during build
 #include <jni.h>
+#include <chrono>
+#include <functional>
 #include <memory>
 #include <string>
 
@@ -34,6 +36,13 @@ public:
 } // namespace facebook
 
 #include "trading_anarchy_jni.h"
+#include "promise_slab.h"
+#include "module_lifetime.h"
+#include "callback_dispatcher.h"
+#include "diagnostics.h"
+#include "method_metrics.h"
+#include "thread_planner.h"
+#include "telemetry_simulator.h"
 
 namespace TradingAnarchy {
 namespace NativeModule {
@@ -48,14 +57,27 @@ private:
     static std::mutex module_mutex_;
     
     // Enhanced callback management
-    std::unordered_map<std::string, facebook::react::Promise> pending_promises_;
-    std::mutex promises_mutex_;
+    static constexpr uint32_t kMaxPendingPromises = 256;
+    static constexpr std::chrono::seconds kPromiseTimeout{30};
+    static constexpr std::chrono::milliseconds kPromiseReapInterval{1000};
+    
+    // The originating method travels with the promise so settlement and
+    // timeouts are attributed to the right metrics slot
+    struct PendingCall {
+        facebook::react::Promise promise;
+        ModuleMethod method;
+    };
+    
+    using PendingPromises = PromiseSlab<PendingCall, kMaxPendingPromises>;
+    using PromiseHandle = PendingPromises::Handle;
+    
+    PendingPromises pending_promises_;
+    // Executor tasks capture this instead of a bare this; see module_lifetime.h
+    std::shared_ptr<ModuleLifetime> lifetime_ = std::make_shared<ModuleLifetime>();
     
     // Performance monitoring
     struct ModuleMetrics {
-        std::atomic<uint64_t> method_calls{0};
-        std::atomic<uint64_t> successful_operations{0};
-        std::atomic<uint64_t> failed_operations{0};
+        MethodMetrics methods;
         std::chrono::steady_clock::time_point start_time;
         
         ModuleMetrics() : start_time(std::chrono::steady_clock::now()) {}
@@ -107,6 +129,11 @@ public:
     
     facebook::react::jsi::Value getSystemInfo(facebook::react::jsi::Runtime& rt);
     
+    /**
+     * Zero-copy view of the live metrics block (see live_metrics.h for layout)
+     */
+    facebook::react::jsi::Value getMetricsBuffer(facebook::react::jsi::Runtime& rt);
+    
     /**
      * Enhanced configuration management
      */
@@ -117,6 +144,11 @@ public:
     
     facebook::react::jsi::Value getCurrentConfig(facebook::react::jsi::Runtime& rt);
     
+    void getOptimalConfiguration(
+        facebook::react::jsi::Runtime& rt,
+        const facebook::react::jsi::Value& algorithm,
+        facebook::react::Promise promise);
+    
     /**
      * Professional callback registration
      */
@@ -132,6 +164,22 @@ public:
         facebook::react::jsi::Runtime& rt,
         const facebook::react::jsi::Value& callback);
     
+    /**
+     * Maximum performance callback rate in Hz, rounded to whole UI frames
+     */
+    void setCallbackRate(
+        facebook::react::jsi::Runtime& rt,
+        const facebook::react::jsi::Value& hz);
+    
+    /**
+     * Synthetic engine events through the callback pipeline for load testing
+     */
+    facebook::react::jsi::Value startSimulation(
+        facebook::react::jsi::Runtime& rt,
+        const facebook::react::jsi::Value& options);
+    
+    facebook::react::jsi::Value stopSimulation(facebook::react::jsi::Runtime& rt);
+    
     /**
      * Enhanced security operations
      */
@@ -177,6 +225,13 @@ public:
     
     static void cleanup();
     
+    /**
+     * Direct JSI installation of the full method table
+     */
+    static void installJSIBindings(
+        facebook::react::jsi::Runtime& rt,
+        std::shared_ptr<TradingAnarchyComputeEngineModule> module);
+    
     // Turbo Module interface
     static facebook::react::jsi::Value get(
         facebook::react::jsi::Runtime& rt,
@@ -194,16 +249,36 @@ private:
         facebook::react::jsi::Runtime& rt,
         const ComputeEngineStatus& status) const;
     
+    facebook::react::jsi::Value convertToJSI(
+        facebook::react::jsi::Runtime& rt,
+        const Diagnostics::DiagnosticsReport& report) const;
+    
+    facebook::react::jsi::Value convertToJSI(
+        facebook::react::jsi::Runtime& rt,
+        const ThreadPlanner::Plan& plan) const;
+    
     void resolvePromise(
-        const std::string& promiseId,
+        PromiseHandle promiseId,
         const facebook::react::jsi::Value& result);
     
     void rejectPromise(
-        const std::string& promiseId,
+        PromiseHandle promiseId,
         const std::string& error,
         const std::string& message);
     
-    std::string generatePromiseId() const;
+    PromiseHandle registerPromise(facebook::react::Promise promise, ModuleMethod method);
+    void schedulePromiseReaper();
+    
+    /**
+     * Enhanced background execution of blocking engine operations
+     */
+    void dispatchEngineOperation(
+        ModuleMethod method,
+        PromiseHandle promiseId,
+        std::function<bool()> operation,
+        const std::string& errorPrefix,
+        const std::string& failureMessage,
+        const std::string& resultStatus);
     
     /**
      * Enhanced callback invocation
@@ -211,6 +286,16 @@ private:
     void invokeStatusCallback(const ComputeEngineStatus& status);
     void invokePerformanceCallback(const PerformanceMetrics& metrics);
     void invokeErrorCallback(const std::string& error, const std::string& message);
+    void deliverCallbackBatch(CallbackDispatcher::Batch batch);
+    
+    std::shared_ptr<CallbackDispatcher> callback_dispatcher_;
+    
+    // Simulated load; declared after the dispatcher it feeds so it stops first
+    TelemetrySimulator::Sink simulatorSink();
+    std::unique_ptr<TelemetrySimulator> simulator_;
+    std::mutex simulator_mutex_;
+    std::atomic<uint64_t> simulated_accepted_{0};
+    std::atomic<uint64_t> simulated_rejected_{0};
     
     // Professional callback storage
     facebook::react::jsi::Function status_callback_;
@@ -220,11 +305,21 @@ private:
     std::mutex callbacks_mutex_;
     std::shared_ptr<facebook::react::CallInvoker> js_invoker_;
     
+    // Professional configuration snapshot
+    EngineConfig engine_config_;
+    mutable std::mutex engine_config_mutex_;
+    
+    EngineConfig parseEngineConfig(
+        facebook::react::jsi::Runtime& rt,
+        const facebook::react::jsi::Object& config) const;
+    
     // Enhanced validation
     bool validateConfig(const facebook::react::jsi::Value& config) const;
     bool isInitialized() const;
     
-    void updateMetrics(bool success);
+    void updateMetrics(ModuleMethod method, bool success);
+    
+    facebook::react::jsi::Value methodMetricsToJSI(facebook::react::jsi::Runtime& rt) const;
 };
 
 } // namespace NativeModule
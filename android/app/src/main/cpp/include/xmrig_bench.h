@@ -0,0 +1,87 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * XMRig Bench - Verified RandomX Benchmark via the Bundled Miner
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace TradingAnarchy {
+namespace XmrigBench {
+
+/**
+ * Professional benchmark request
+ *
+ * Runs `<binary> --bench=<size> --algo=<algorithm>` offline; no pool or
+ * wallet is involved. threads = 0 and affinity = -1 leave the choice to
+ * xmrig's own autoconfiguration.
+ */
+struct BenchOptions {
+    std::string binary_path;
+    std::string algorithm = "rx/0";
+    std::string size = "1M";                // xmrig accepts 1M..10M
+    uint32_t threads = 0;
+    int64_t affinity = -1;                  // --cpu-affinity bit mask
+    std::string expected_hash;              // optional cross-check, hex
+    std::chrono::seconds timeout{45 * 60};
+};
+
+/**
+ * Enhanced verdict on the hash sum
+ *
+ * xmrig prints the hash sum green when it matches its built-in reference
+ * for the bench size and red when it does not; sizes without a reference
+ * are printed uncoloured.
+ */
+enum class Verification : uint8_t {
+    UNKNOWN = 0,
+    VERIFIED,
+    MISMATCH,
+};
+
+const char* verificationName(Verification verification);
+
+struct BenchResult {
+    bool success = false;
+    std::string error;
+
+    double hashrate = 0.0;                  // H/s as reported by xmrig
+    double duration_seconds = 0.0;          // hashing only, excludes dataset init
+    double wall_seconds = 0.0;              // process start to exit
+    uint32_t threads = 0;                   // from xmrig's "use profile" line
+    std::string hash_sum;                   // 16 uppercase hex digits
+    Verification verification = Verification::UNKNOWN;
+    int exit_code = -1;
+};
+
+/**
+ * Professional blocking run of one benchmark - call from a worker thread
+ *
+ * One benchmark runs at a time; a second call fails fast with "busy".
+ */
+BenchResult run(const BenchOptions& options);
+
+/**
+ * Enhanced cancellation of the running benchmark, if any
+ */
+bool cancel();
+
+/**
+ * Parses one line of xmrig output into result; exposed for the A/B harness
+ */
+void parseLine(const std::string& line, BenchResult& result);
+
+/**
+ * Directory holding this library - the app's nativeLibraryDir on device
+ */
+std::string nativeLibraryDir();
+
+} // namespace XmrigBench
+} // namespace TradingAnarchy
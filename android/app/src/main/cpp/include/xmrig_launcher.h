@@ -0,0 +1,85 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * XMRig Launcher - Per-Microarchitecture Miner Binary Selection
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#pragma once
+
+#include "cpu_features.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace TradingAnarchy {
+namespace Launcher {
+
+/**
+ * Professional libxmrig build variant
+ *
+ * Mirrors the ARM64_VARIANTS table in xmrig/lib-builder/script/xmrig-build.sh;
+ * a variant named "v82-a76" ships as libxmrig-v82-a76.so next to the
+ * baseline libxmrig.so.
+ */
+struct BinaryVariant {
+    const char* name;
+    const char* suffix;             // appended to the base library name
+    uint64_t required_features;
+    bool prefers_big_cores;         // tuned for out-of-order big cores
+};
+
+/**
+ * Enhanced core inventory from MIDR_EL1 - little means in-order A53/A55 class
+ */
+struct CoreInventory {
+    uint32_t big_cores = 0;
+    uint32_t little_cores = 0;
+    uint32_t unknown_cores = 0;
+
+    // Unidentified cores count as big; tuning is a preference, never a requirement
+    bool hasBigCores() const { return big_cores + unknown_cores > 0 || little_cores == 0; }
+};
+
+/**
+ * Professional launch decision for one miner fork
+ */
+struct Selection {
+    const BinaryVariant* variant = nullptr;
+    std::string file_name;          // e.g. "libxmrig-v82-a76.so"
+    std::string path;
+};
+
+/**
+ * Variants for this ABI, best-first; the last entry is the portable baseline
+ */
+const std::vector<BinaryVariant>& binaryVariants();
+
+CoreInventory detectCores();
+
+/**
+ * Enhanced best variant for this CPU, whether or not its binary is installed
+ */
+const BinaryVariant& preferredVariant();
+
+/**
+ * Professional selection of the best installed binary
+ *
+ * base_name is the fork's library stem ("libxmrig" or "libxmrig-mo"). Falls
+ * back variant by variant to the baseline when a tuned build is missing.
+ */
+Selection selectBinary(const std::string& native_lib_dir, const std::string& base_name);
+
+/**
+ * Enhanced profiling switch - while on, selectBinary prefers the
+ * WITH_PROFILING build (<base>-profile.so) whenever it is installed
+ */
+void setProfilingEnabled(bool enabled);
+bool profilingEnabled();
+const BinaryVariant& profilingVariant();
+
+} // namespace Launcher
+} // namespace TradingAnarchy
@@ -0,0 +1,470 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Keccak - Multiversioned Keccak-f[1600] Permutation and Sponge Hashes
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#include "keccak.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace TradingAnarchy {
+namespace Keccak {
+
+namespace {
+
+constexpr size_t kRate256 = 136;   // (1600 - 2 * 256) / 8
+constexpr uint8_t kSha3Domain = 0x06;
+constexpr uint8_t kKeccakDomain = 0x01;
+
+constexpr uint64_t kRoundConstants[24] = {
+    0x0000000000000001ull, 0x0000000000008082ull, 0x800000000000808aull, 0x8000000080008000ull,
+    0x000000000000808bull, 0x0000000080000001ull, 0x8000000080008081ull, 0x8000000000008009ull,
+    0x000000000000008aull, 0x0000000000000088ull, 0x0000000080008009ull, 0x000000008000000aull,
+    0x000000008000808bull, 0x800000000000008bull, 0x8000000000008089ull, 0x8000000000008003ull,
+    0x8000000000008002ull, 0x8000000000000080ull, 0x000000000000800aull, 0x800000008000000aull,
+    0x8000000080008081ull, 0x8000000000008080ull, 0x0000000080000001ull, 0x8000000080008008ull,
+};
+
+/**
+ * Professional lane-generic permutation body
+ *
+ * V is uint64_t for a single state or a GCC/Clang vector of uint64_t, in
+ * which case each element is an independent state. Fully unrolled so the
+ * 25 lanes stay in registers, and always inlined so each target-attributed
+ * wrapper below gets its own code generation for its ISA level.
+ */
+// Vectors are passed by reference only: by-value AVX vectors change the ABI
+template <typename V>
+[[gnu::always_inline]] inline void rotlLane(V& x, int n) {
+    x = (x << n) | (x >> (64 - n));
+}
+
+template <typename V>
+[[gnu::always_inline]] inline void keccakRounds(V* a) {
+    for (int round = 0; round < 24; ++round) {
+        V c0 = a[0] ^ a[5] ^ a[10] ^ a[15] ^ a[20];
+        V c1 = a[1] ^ a[6] ^ a[11] ^ a[16] ^ a[21];
+        V c2 = a[2] ^ a[7] ^ a[12] ^ a[17] ^ a[22];
+        V c3 = a[3] ^ a[8] ^ a[13] ^ a[18] ^ a[23];
+        V c4 = a[4] ^ a[9] ^ a[14] ^ a[19] ^ a[24];
+
+        // d[x] = c[x - 1] ^ rotl(c[x + 1], 1)
+        V d0 = c1; rotlLane(d0, 1); d0 ^= c4;
+        V d1 = c2; rotlLane(d1, 1); d1 ^= c0;
+        V d2 = c3; rotlLane(d2, 1); d2 ^= c1;
+        V d3 = c4; rotlLane(d3, 1); d3 ^= c2;
+        V d4 = c0; rotlLane(d4, 1); d4 ^= c3;
+
+        // rho and pi: b[pi(i)] = rotl(a[i] ^ d[x], rho[i])
+        V b00 = a[ 0] ^ d0;
+        V b01 = a[ 6] ^ d1; rotlLane(b01, 44);
+        V b02 = a[12] ^ d2; rotlLane(b02, 43);
+        V b03 = a[18] ^ d3; rotlLane(b03, 21);
+        V b04 = a[24] ^ d4; rotlLane(b04, 14);
+        V b05 = a[ 3] ^ d3; rotlLane(b05, 28);
+        V b06 = a[ 9] ^ d4; rotlLane(b06, 20);
+        V b07 = a[10] ^ d0; rotlLane(b07, 3);
+        V b08 = a[16] ^ d1; rotlLane(b08, 45);
+        V b09 = a[22] ^ d2; rotlLane(b09, 61);
+        V b10 = a[ 1] ^ d1; rotlLane(b10, 1);
+        V b11 = a[ 7] ^ d2; rotlLane(b11, 6);
+        V b12 = a[13] ^ d3; rotlLane(b12, 25);
+        V b13 = a[19] ^ d4; rotlLane(b13, 8);
+        V b14 = a[20] ^ d0; rotlLane(b14, 18);
+        V b15 = a[ 4] ^ d4; rotlLane(b15, 27);
+        V b16 = a[ 5] ^ d0; rotlLane(b16, 36);
+        V b17 = a[11] ^ d1; rotlLane(b17, 10);
+        V b18 = a[17] ^ d2; rotlLane(b18, 15);
+        V b19 = a[23] ^ d3; rotlLane(b19, 56);
+        V b20 = a[ 2] ^ d2; rotlLane(b20, 62);
+        V b21 = a[ 8] ^ d3; rotlLane(b21, 55);
+        V b22 = a[14] ^ d4; rotlLane(b22, 39);
+        V b23 = a[15] ^ d0; rotlLane(b23, 41);
+        V b24 = a[21] ^ d1; rotlLane(b24, 2);
+
+        // chi
+        a[ 0] = b00 ^ (~b01 & b02);
+        a[ 1] = b01 ^ (~b02 & b03);
+        a[ 2] = b02 ^ (~b03 & b04);
+        a[ 3] = b03 ^ (~b04 & b00);
+        a[ 4] = b04 ^ (~b00 & b01);
+        a[ 5] = b05 ^ (~b06 & b07);
+        a[ 6] = b06 ^ (~b07 & b08);
+        a[ 7] = b07 ^ (~b08 & b09);
+        a[ 8] = b08 ^ (~b09 & b05);
+        a[ 9] = b09 ^ (~b05 & b06);
+        a[10] = b10 ^ (~b11 & b12);
+        a[11] = b11 ^ (~b12 & b13);
+        a[12] = b12 ^ (~b13 & b14);
+        a[13] = b13 ^ (~b14 & b10);
+        a[14] = b14 ^ (~b10 & b11);
+        a[15] = b15 ^ (~b16 & b17);
+        a[16] = b16 ^ (~b17 & b18);
+        a[17] = b17 ^ (~b18 & b19);
+        a[18] = b18 ^ (~b19 & b15);
+        a[19] = b19 ^ (~b15 & b16);
+        a[20] = b20 ^ (~b21 & b22);
+        a[21] = b21 ^ (~b22 & b23);
+        a[22] = b22 ^ (~b23 & b24);
+        a[23] = b23 ^ (~b24 & b20);
+        a[24] = b24 ^ (~b20 & b21);
+
+        a[0] ^= kRoundConstants[round];
+    }
+}
+
+void permuteGeneric(uint64_t* state) {
+    // A local copy lets the compiler keep every lane in a register
+    uint64_t a[kStateLanes];
+    std::memcpy(a, state, sizeof(a));
+    keccakRounds(a);
+    std::memcpy(state, a, sizeof(a));
+}
+
+/**
+ * Enhanced batched permutations - kBatchWays interleaved states with lane i
+ * of state j at states[i * kBatchWays + j]
+ */
+void permuteBatchGeneric(uint64_t* states) {
+    for (size_t way = 0; way < kBatchWays; ++way) {
+        uint64_t a[kStateLanes];
+        for (size_t i = 0; i < kStateLanes; ++i) {
+            a[i] = states[i * kBatchWays + way];
+        }
+        keccakRounds(a);
+        for (size_t i = 0; i < kStateLanes; ++i) {
+            states[i * kBatchWays + way] = a[i];
+        }
+    }
+}
+
+// One vector element per state; narrower vectors take several passes
+template <typename V>
+[[gnu::always_inline]] inline void permuteBatchLanes(uint64_t* states) {
+    constexpr size_t kWays = sizeof(V) / sizeof(uint64_t);
+    for (size_t way = 0; way < kBatchWays; way += kWays) {
+        V a[kStateLanes];
+        for (size_t i = 0; i < kStateLanes; ++i) {
+            std::memcpy(&a[i], states + i * kBatchWays + way, sizeof(V));
+        }
+        keccakRounds(a);
+        for (size_t i = 0; i < kStateLanes; ++i) {
+            std::memcpy(states + i * kBatchWays + way, &a[i], sizeof(V));
+        }
+    }
+}
+
+#if defined(__x86_64__)
+using U64x4 = uint64_t __attribute__((vector_size(32)));
+
+[[gnu::target("avx2")]]
+void permuteBatchAvx2(uint64_t* states) {
+    permuteBatchLanes<U64x4>(states);
+}
+
+// AVX-512VL adds VPROLQ for the rotates and VPTERNLOGQ for theta and chi
+[[gnu::target("avx512f,avx512vl")]]
+void permuteBatchAvx512(uint64_t* states) {
+    permuteBatchLanes<U64x4>(states);
+}
+#endif
+
+#if defined(__aarch64__)
+/**
+ * Professional ARMv8.2-SHA3 permutation
+ *
+ * One lane per vector register (lane 1 carries no state), using EOR3 for
+ * the theta column parity, RAX1 for the theta mix, XAR for the fused
+ * theta-xor plus rho rotate and BCAX for chi.
+ */
+[[gnu::target("arch=armv8.2-a+sha3")]]
+void permuteNeonSha3Rounds(uint64x2_t* a) {
+    for (int round = 0; round < 24; ++round) {
+        uint64x2_t c0 = veor3q_u64(veor3q_u64(a[0], a[5], a[10]), a[15], a[20]);
+        uint64x2_t c1 = veor3q_u64(veor3q_u64(a[1], a[6], a[11]), a[16], a[21]);
+        uint64x2_t c2 = veor3q_u64(veor3q_u64(a[2], a[7], a[12]), a[17], a[22]);
+        uint64x2_t c3 = veor3q_u64(veor3q_u64(a[3], a[8], a[13]), a[18], a[23]);
+        uint64x2_t c4 = veor3q_u64(veor3q_u64(a[4], a[9], a[14]), a[19], a[24]);
+
+        uint64x2_t d0 = vrax1q_u64(c4, c1);
+        uint64x2_t d1 = vrax1q_u64(c0, c2);
+        uint64x2_t d2 = vrax1q_u64(c1, c3);
+        uint64x2_t d3 = vrax1q_u64(c2, c4);
+        uint64x2_t d4 = vrax1q_u64(c3, c0);
+
+        // b[pi(i)] = rotl(a[i] ^ d[x], rho[i]); XAR rotates right, hence 64 - rho
+        uint64x2_t b00 = veorq_u64(a[ 0], d0);
+        uint64x2_t b01 = vxarq_u64(a[ 6], d1, 20);
+        uint64x2_t b02 = vxarq_u64(a[12], d2, 21);
+        uint64x2_t b03 = vxarq_u64(a[18], d3, 43);
+        uint64x2_t b04 = vxarq_u64(a[24], d4, 50);
+        uint64x2_t b05 = vxarq_u64(a[ 3], d3, 36);
+        uint64x2_t b06 = vxarq_u64(a[ 9], d4, 44);
+        uint64x2_t b07 = vxarq_u64(a[10], d0, 61);
+        uint64x2_t b08 = vxarq_u64(a[16], d1, 19);
+        uint64x2_t b09 = vxarq_u64(a[22], d2, 3);
+        uint64x2_t b10 = vxarq_u64(a[ 1], d1, 63);
+        uint64x2_t b11 = vxarq_u64(a[ 7], d2, 58);
+        uint64x2_t b12 = vxarq_u64(a[13], d3, 39);
+        uint64x2_t b13 = vxarq_u64(a[19], d4, 56);
+        uint64x2_t b14 = vxarq_u64(a[20], d0, 46);
+        uint64x2_t b15 = vxarq_u64(a[ 4], d4, 37);
+        uint64x2_t b16 = vxarq_u64(a[ 5], d0, 28);
+        uint64x2_t b17 = vxarq_u64(a[11], d1, 54);
+        uint64x2_t b18 = vxarq_u64(a[17], d2, 49);
+        uint64x2_t b19 = vxarq_u64(a[23], d3, 8);
+        uint64x2_t b20 = vxarq_u64(a[ 2], d2, 2);
+        uint64x2_t b21 = vxarq_u64(a[ 8], d3, 9);
+        uint64x2_t b22 = vxarq_u64(a[14], d4, 25);
+        uint64x2_t b23 = vxarq_u64(a[15], d0, 23);
+        uint64x2_t b24 = vxarq_u64(a[21], d1, 62);
+
+        // a[x] = b[x] ^ (~b[x + 1] & b[x + 2])
+        a[ 0] = vbcaxq_u64(b00, b02, b01);
+        a[ 1] = vbcaxq_u64(b01, b03, b02);
+        a[ 2] = vbcaxq_u64(b02, b04, b03);
+        a[ 3] = vbcaxq_u64(b03, b00, b04);
+        a[ 4] = vbcaxq_u64(b04, b01, b00);
+        a[ 5] = vbcaxq_u64(b05, b07, b06);
+        a[ 6] = vbcaxq_u64(b06, b08, b07);
+        a[ 7] = vbcaxq_u64(b07, b09, b08);
+        a[ 8] = vbcaxq_u64(b08, b05, b09);
+        a[ 9] = vbcaxq_u64(b09, b06, b05);
+        a[10] = vbcaxq_u64(b10, b12, b11);
+        a[11] = vbcaxq_u64(b11, b13, b12);
+        a[12] = vbcaxq_u64(b12, b14, b13);
+        a[13] = vbcaxq_u64(b13, b10, b14);
+        a[14] = vbcaxq_u64(b14, b11, b10);
+        a[15] = vbcaxq_u64(b15, b17, b16);
+        a[16] = vbcaxq_u64(b16, b18, b17);
+        a[17] = vbcaxq_u64(b17, b19, b18);
+        a[18] = vbcaxq_u64(b18, b15, b19);
+        a[19] = vbcaxq_u64(b19, b16, b15);
+        a[20] = vbcaxq_u64(b20, b22, b21);
+        a[21] = vbcaxq_u64(b21, b23, b22);
+        a[22] = vbcaxq_u64(b22, b24, b23);
+        a[23] = vbcaxq_u64(b23, b20, b24);
+        a[24] = vbcaxq_u64(b24, b21, b20);
+
+        a[0] = veorq_u64(a[0], vdupq_n_u64(kRoundConstants[round]));
+    }
+}
+
+[[gnu::target("arch=armv8.2-a+sha3")]]
+void permuteNeonSha3(uint64_t* state) {
+    uint64x2_t lanes[kStateLanes];
+    for (size_t i = 0; i < kStateLanes; ++i) {
+        lanes[i] = vcombine_u64(vcreate_u64(state[i]), vcreate_u64(0));
+    }
+    permuteNeonSha3Rounds(lanes);
+    for (size_t i = 0; i < kStateLanes; ++i) {
+        state[i] = vgetq_lane_u64(lanes[i], 0);
+    }
+}
+
+/**
+ * Enhanced two-way batch passes - both vector lanes carry a state, so
+ * the SHA3 rounds above do twice the work per instruction
+ */
+[[gnu::target("arch=armv8.2-a+sha3")]]
+void permuteBatchNeonSha3(uint64_t* states) {
+    for (size_t way = 0; way < kBatchWays; way += 2) {
+        uint64x2_t lanes[kStateLanes];
+        for (size_t i = 0; i < kStateLanes; ++i) {
+            lanes[i] = vld1q_u64(states + i * kBatchWays + way);
+        }
+        permuteNeonSha3Rounds(lanes);
+        for (size_t i = 0; i < kStateLanes; ++i) {
+            vst1q_u64(states + i * kBatchWays + way, lanes[i]);
+        }
+    }
+}
+
+using U64x2 = uint64_t __attribute__((vector_size(16)));
+
+void permuteBatchNeon(uint64_t* states) {
+    permuteBatchLanes<U64x2>(states);
+}
+#endif
+
+inline void absorbBlock(uint64_t* state, size_t stride, const uint8_t* block) {
+    for (size_t i = 0; i < kRate256 / 8; ++i) {
+        uint64_t lane;
+        std::memcpy(&lane, block + 8 * i, sizeof(lane));
+        state[i * stride] ^= lane;
+    }
+}
+
+// Final block: the message tail, the domain byte and the closing 0x80
+inline void padBlock(uint8_t block[kRate256], const uint8_t* tail, size_t length, uint8_t domain) {
+    std::memset(block, 0, kRate256);
+    std::memcpy(block, tail, length);
+    block[length] ^= domain;
+    block[kRate256 - 1] ^= 0x80;
+}
+
+/**
+ * Enhanced sponge - absorb full-rate blocks, pad the tail, squeeze 32 bytes
+ */
+void sponge256(const uint8_t* data, size_t length, uint8_t domain, uint8_t out[kDigestBytes]) {
+    uint64_t state[kStateLanes] = {};
+    PermutationFn permuteFn = permutationKernel().get();
+
+    while (length >= kRate256) {
+        absorbBlock(state, 1, data);
+        permuteFn(state);
+        data += kRate256;
+        length -= kRate256;
+    }
+
+    uint8_t tail[kRate256];
+    padBlock(tail, data, length, domain);
+    absorbBlock(state, 1, tail);
+    permuteFn(state);
+
+    std::memcpy(out, state, kDigestBytes);
+}
+
+/**
+ * Professional batch sponge - kBatchWays messages per interleaved permutation
+ *
+ * Each message needs length / rate + 1 permutations; the group runs for its
+ * longest member and squeezes every other member right after its last block.
+ */
+void spongeMany256(const uint8_t* const* inputs, const size_t* lengths, size_t count,
+                   uint8_t domain, uint8_t* out) {
+    BatchPermutationFn permuteBatch = batchPermutationKernel().get();
+
+    for (size_t first = 0; first < count; first += kBatchWays) {
+        size_t ways = std::min(kBatchWays, count - first);
+        if (ways == 1) {
+            sponge256(inputs[first], lengths[first], domain, out + first * kDigestBytes);
+            continue;
+        }
+
+        uint64_t states[kStateLanes * kBatchWays] = {};
+        size_t blocks[kBatchWays] = {};
+        size_t steps = 0;
+        for (size_t way = 0; way < ways; ++way) {
+            blocks[way] = lengths[first + way] / kRate256 + 1;
+            steps = std::max(steps, blocks[way]);
+        }
+
+        for (size_t step = 0; step < steps; ++step) {
+            for (size_t way = 0; way < ways; ++way) {
+                if (step >= blocks[way]) {
+                    continue;
+                }
+                const uint8_t* block = inputs[first + way] + step * kRate256;
+                uint8_t tail[kRate256];
+                if (step + 1 == blocks[way]) {
+                    padBlock(tail, block, lengths[first + way] - step * kRate256, domain);
+                    block = tail;
+                }
+                absorbBlock(states + way, kBatchWays, block);
+            }
+
+            permuteBatch(states);
+
+            for (size_t way = 0; way < ways; ++way) {
+                if (step + 1 != blocks[way]) {
+                    continue;
+                }
+                uint8_t* digest = out + (first + way) * kDigestBytes;
+                for (size_t i = 0; i < kDigestBytes / 8; ++i) {
+                    std::memcpy(digest + 8 * i, &states[i * kBatchWays + way], sizeof(uint64_t));
+                }
+            }
+        }
+    }
+}
+
+// Resolve at load time rather than on the first hash
+[[maybe_unused]] const KernelDispatchBase& kLoadTimeResolution = permutationKernel();
+[[maybe_unused]] const KernelDispatchBase& kBatchLoadTimeResolution = batchPermutationKernel();
+
+} // namespace
+
+KernelDispatch<PermutationFn>& permutationKernel() {
+    static KernelDispatch<PermutationFn> dispatch("keccak-f1600", {
+#if defined(__aarch64__)
+        {"armv8.2-sha3", CPU_NEON | CPU_SHA3, permuteNeonSha3},
+#endif
+        {"generic", 0, permuteGeneric},
+    });
+
+    static const bool workload_installed = [] {
+        dispatch.setWorkload([](size_t iterations) {
+            uint64_t state[kStateLanes] = {};
+            for (size_t i = 0; i < iterations; ++i) {
+                permute(state);
+            }
+            return state[0] ^ state[24];
+        });
+        return true;
+    }();
+    (void)workload_installed;
+
+    return dispatch;
+}
+
+KernelDispatch<BatchPermutationFn>& batchPermutationKernel() {
+    static KernelDispatch<BatchPermutationFn> dispatch("keccak-f1600-x4", {
+#if defined(__aarch64__)
+        {"armv8.2-sha3", CPU_NEON | CPU_SHA3, permuteBatchNeonSha3},
+        {"neon", CPU_NEON, permuteBatchNeon},
+#endif
+#if defined(__x86_64__)
+        {"avx512", CPU_AVX512F | CPU_AVX512VL, permuteBatchAvx512},
+        {"avx2", CPU_AVX2, permuteBatchAvx2},
+#endif
+        {"generic", 0, permuteBatchGeneric},
+    });
+
+    static const bool workload_installed = [] {
+        dispatch.setWorkload([](size_t iterations) {
+            uint64_t states[kStateLanes * kBatchWays] = {};
+            for (size_t i = 0; i < iterations; ++i) {
+                states[i % kBatchWays] ^= i;
+                batchPermutationKernel().get()(states);
+            }
+            uint64_t checksum = 0;
+            for (size_t way = 0; way < kBatchWays; ++way) {
+                checksum ^= states[way] ^ states[(kStateLanes - 1) * kBatchWays + way];
+            }
+            return checksum;
+        });
+        return true;
+    }();
+    (void)workload_installed;
+
+    return dispatch;
+}
+
+void sha3_256(const uint8_t* data, size_t length, uint8_t out[kDigestBytes]) {
+    sponge256(data, length, kSha3Domain, out);
+}
+
+void keccak_256(const uint8_t* data, size_t length, uint8_t out[kDigestBytes]) {
+    sponge256(data, length, kKeccakDomain, out);
+}
+
+void sha3_256Many(const uint8_t* const* inputs, const size_t* lengths, size_t count, uint8_t* out) {
+    spongeMany256(inputs, lengths, count, kSha3Domain, out);
+}
+
+void keccak_256Many(const uint8_t* const* inputs, const size_t* lengths, size_t count, uint8_t* out) {
+    spongeMany256(inputs, lengths, count, kKeccakDomain, out);
+}
+
+} // namespace Keccak
+} // namespace TradingAnarchy
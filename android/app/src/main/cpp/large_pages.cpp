@@ -0,0 +1,128 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Large Pages - Huge-Page Backed Buffers for Memory-Hard Kernels
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#include "large_pages.h"
+#include "trading_anarchy_jni.h"
+
+#include <cstdint>
+#include <utility>
+
+#include <sys/mman.h>
+
+namespace TradingAnarchy {
+
+namespace {
+
+size_t roundUp(size_t bytes, size_t granule) {
+    return (bytes + granule - 1) / granule * granule;
+}
+
+void* mapAnonymous(size_t bytes, int extra_flags) {
+    void* mapping = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | extra_flags, -1, 0);
+    return mapping == MAP_FAILED ? nullptr : mapping;
+}
+
+} // namespace
+
+LargePageBuffer::LargePageBuffer(size_t bytes) {
+    if (bytes == 0) {
+        return;
+    }
+
+    // Below half a huge page the rounding waste outweighs the TLB savings
+    if (bytes >= kHugePageSize / 2) {
+        size_t rounded = roundUp(bytes, kHugePageSize);
+
+#if defined(MAP_HUGETLB)
+        if (void* mapping = mapAnonymous(rounded, MAP_HUGETLB)) {
+            data_ = static_cast<uint8_t*>(mapping);
+            size_ = bytes;
+            mapping_size_ = rounded;
+            mode_ = Mode::HUGETLB;
+            return;
+        }
+#endif
+
+#if defined(MADV_HUGEPAGE)
+        // Over-map by one huge page, then trim both ends to a 2 MiB aligned window
+        if (void* mapping = mapAnonymous(rounded + kHugePageSize, 0)) {
+            uintptr_t start = reinterpret_cast<uintptr_t>(mapping);
+            uintptr_t aligned = roundUp(start, kHugePageSize);
+            size_t head = aligned - start;
+            size_t tail = kHugePageSize - head;
+            if (head > 0) {
+                munmap(mapping, head);
+            }
+            if (tail > 0) {
+                munmap(reinterpret_cast<void*>(aligned + rounded), tail);
+            }
+
+            data_ = reinterpret_cast<uint8_t*>(aligned);
+            size_ = bytes;
+            mapping_size_ = rounded;
+            mode_ = madvise(data_, rounded, MADV_HUGEPAGE) == 0 ? Mode::TRANSPARENT : Mode::REGULAR;
+            return;
+        }
+#endif
+    }
+
+    size_t rounded = roundUp(bytes, 4096);
+    if (void* mapping = mapAnonymous(rounded, 0)) {
+        data_ = static_cast<uint8_t*>(mapping);
+        size_ = bytes;
+        mapping_size_ = rounded;
+        mode_ = Mode::REGULAR;
+        return;
+    }
+
+    TA_LOGE("Failed to map %zu bytes for a large-page buffer", bytes);
+}
+
+LargePageBuffer::~LargePageBuffer() {
+    release();
+}
+
+LargePageBuffer::LargePageBuffer(LargePageBuffer&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      mapping_size_(std::exchange(other.mapping_size_, 0)),
+      mode_(std::exchange(other.mode_, Mode::NONE)) {}
+
+LargePageBuffer& LargePageBuffer::operator=(LargePageBuffer&& other) noexcept {
+    if (this != &other) {
+        release();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        mapping_size_ = std::exchange(other.mapping_size_, 0);
+        mode_ = std::exchange(other.mode_, Mode::NONE);
+    }
+    return *this;
+}
+
+void LargePageBuffer::release() {
+    if (data_ != nullptr) {
+        munmap(data_, mapping_size_);
+    }
+    data_ = nullptr;
+    size_ = 0;
+    mapping_size_ = 0;
+    mode_ = Mode::NONE;
+}
+
+const char* LargePageBuffer::modeName(Mode mode) {
+    switch (mode) {
+        case Mode::HUGETLB: return "hugetlb";
+        case Mode::TRANSPARENT: return "transparent";
+        case Mode::REGULAR: return "regular";
+        case Mode::NONE: break;
+    }
+    return "none";
+}
+
+} // namespace TradingAnarchy
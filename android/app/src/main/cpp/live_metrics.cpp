@@ -0,0 +1,91 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Live Metrics Implementation - Seqlock-Protected Shared Metrics Block
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#include "live_metrics.h"
+
+#include <algorithm>
+
+namespace TradingAnarchy {
+
+using namespace LiveMetricsLayout;
+
+LiveMetrics::LiveMetrics() {
+    store(LAYOUT_VERSION, static_cast<double>(kLayoutVersion));
+    store(SEQUENCE, 0.0);
+}
+
+LiveMetrics& LiveMetrics::instance() {
+    static LiveMetrics metrics;
+    return metrics;
+}
+
+void LiveMetrics::store(uint32_t slot, double value) {
+    std::atomic_ref<double>(slots_[slot]).store(value, std::memory_order_relaxed);
+}
+
+double LiveMetrics::load(uint32_t slot) const {
+    return std::atomic_ref<double>(const_cast<double&>(slots_[slot])).load(std::memory_order_relaxed);
+}
+
+void LiveMetrics::publish(const LiveMetricsSnapshot& snapshot) {
+    // Professional seqlock write: odd sequence marks an update in progress
+    store(SEQUENCE, static_cast<double>(++write_sequence_));
+    std::atomic_thread_fence(std::memory_order_release);
+    
+    store(TIMESTAMP_MS, snapshot.timestamp_ms);
+    store(HASHRATE, snapshot.hashrate);
+    store(ACCEPTED_SHARES, snapshot.accepted_shares);
+    store(REJECTED_SHARES, snapshot.rejected_shares);
+    store(TEMPERATURE, snapshot.temperature);
+    store(CPU_USAGE, snapshot.cpu_usage);
+    store(UPTIME_SECONDS, snapshot.uptime_seconds);
+    
+    uint32_t threads = std::min(snapshot.thread_count, kMaxThreads);
+    store(THREAD_COUNT, static_cast<double>(threads));
+    for (uint32_t i = 0; i < kMaxThreads; ++i) {
+        store(THREAD_HASHRATE_BASE + i, i < threads ? snapshot.thread_hashrate[i] : 0.0);
+    }
+    
+    std::atomic_thread_fence(std::memory_order_release);
+    store(SEQUENCE, static_cast<double>(++write_sequence_));
+}
+
+LiveMetricsSnapshot LiveMetrics::read() const {
+    LiveMetricsSnapshot snapshot;
+    
+    for (;;) {
+        double before = load(SEQUENCE);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        
+        snapshot.timestamp_ms = load(TIMESTAMP_MS);
+        snapshot.hashrate = load(HASHRATE);
+        snapshot.accepted_shares = load(ACCEPTED_SHARES);
+        snapshot.rejected_shares = load(REJECTED_SHARES);
+        snapshot.temperature = load(TEMPERATURE);
+        snapshot.cpu_usage = load(CPU_USAGE);
+        snapshot.uptime_seconds = load(UPTIME_SECONDS);
+        snapshot.thread_count = static_cast<uint32_t>(load(THREAD_COUNT));
+        for (uint32_t i = 0; i < kMaxThreads; ++i) {
+            snapshot.thread_hashrate[i] = load(THREAD_HASHRATE_BASE + i);
+        }
+        
+        std::atomic_thread_fence(std::memory_order_acquire);
+        double after = load(SEQUENCE);
+        
+        if (before == after && (static_cast<uint64_t>(before) & 1) == 0) {
+            return snapshot;
+        }
+    }
+}
+
+uint64_t LiveMetrics::sequence() const {
+    return static_cast<uint64_t>(load(SEQUENCE));
+}
+
+} // namespace TradingAnarchy
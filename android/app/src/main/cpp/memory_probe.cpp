@@ -0,0 +1,263 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Memory Probe - Cache Hierarchy Latency and Multi-Thread Bandwidth Characterization
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#include "memory_probe.h"
+#include "large_pages.h"
+#include "trading_anarchy_jni.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <thread>
+
+namespace TradingAnarchy {
+namespace MemoryProbe {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t kLineBytes = 64;
+constexpr size_t kChaseBatch = 4096;
+constexpr auto kChaseWindow = std::chrono::milliseconds(5);
+constexpr int kChaseWindows = 3;    // best window, so a preemption cannot fake a step
+
+// Consecutive sizes within this ratio of a plateau's lowest latency belong to it
+constexpr double kPlateauRatio = 1.5;
+
+// Triad arrays are four times the largest cache found, within these bounds
+constexpr size_t kMinStreamBytes = 8u << 20;
+constexpr size_t kMaxStreamBytes = 32u << 20;
+constexpr int kTriadPasses = 4;
+
+std::atomic<const Hierarchy*> g_cached{nullptr};
+
+double elapsedNs(Clock::time_point start) {
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+/**
+ * Professional dependent-load chase over one working set
+ *
+ * One pointer per cache line, linked by a Sattolo shuffle into a single
+ * random cycle so neither the prefetcher nor a short loop can hide the
+ * latency. The buffer comes from the large-page allocator to keep TLB
+ * misses out of the cache-level steps where possible.
+ */
+double chaseLatency(size_t bytes, std::mt19937_64& rng) {
+    LargePageBuffer buffer(bytes);
+    if (!buffer) {
+        return 0.0;
+    }
+
+    const size_t lines = bytes / kLineBytes;
+    std::vector<uint32_t> order(lines);
+    std::iota(order.begin(), order.end(), 0u);
+    for (size_t i = lines - 1; i > 0; --i) {
+        std::uniform_int_distribution<size_t> pick(0, i - 1);
+        std::swap(order[i], order[pick(rng)]);
+    }
+
+    auto slot = [&buffer](size_t line) {
+        return reinterpret_cast<uintptr_t*>(buffer.data() + line * kLineBytes);
+    };
+    for (size_t i = 0; i < lines; ++i) {
+        *slot(order[i]) = reinterpret_cast<uintptr_t>(slot(order[(i + 1) % lines]));
+    }
+
+    // Pull the working set in; on the large sizes only the first misses matter
+    uintptr_t* cursor = slot(order[0]);
+    for (size_t i = 0; i < std::min<size_t>(lines, 1u << 16); ++i) {
+        cursor = reinterpret_cast<uintptr_t*>(*cursor);
+    }
+
+    double ns = std::numeric_limits<double>::infinity();
+    for (int window = 0; window < kChaseWindows; ++window) {
+        size_t loads = 0;
+        auto start = Clock::now();
+        do {
+            for (size_t i = 0; i < kChaseBatch; ++i) {
+                cursor = reinterpret_cast<uintptr_t*>(*cursor);
+            }
+            loads += kChaseBatch;
+        } while (Clock::now() - start < kChaseWindow);
+        ns = std::min(ns, elapsedNs(start) / loads);
+    }
+
+    // Keeps the chain live so the loop is not discarded
+    volatile uintptr_t sink = reinterpret_cast<uintptr_t>(cursor);
+    (void)sink;
+    return ns;
+}
+
+/**
+ * Enhanced plateau detection
+ *
+ * Each cache level shows as a run of at least two sizes with flat
+ * latency; the ramps between levels are single points and are skipped.
+ * A run that reaches the largest size probed is DRAM, not a cache.
+ */
+void locateBoundaries(Hierarchy& result) {
+    std::vector<uint64_t> levels;
+    const std::vector<LatencyPoint>& points = result.latency;
+
+    size_t first = 0;
+    double floor_ns = points.empty() ? 0.0 : points[0].ns_per_load;
+    for (size_t i = 1; i <= points.size(); ++i) {
+        bool ends = i == points.size() || points[i].ns_per_load > floor_ns * kPlateauRatio;
+        if (!ends) {
+            floor_ns = std::min(floor_ns, points[i].ns_per_load);
+            continue;
+        }
+        if (i - first >= 2 && i < points.size()) {
+            levels.push_back(points[i - 1].bytes);
+        }
+        if (i < points.size()) {
+            first = i;
+            floor_ns = points[i].ns_per_load;
+        }
+    }
+
+    result.l1_cache = levels.size() > 0 ? levels[0] : 0;
+    result.l2_cache = levels.size() > 1 ? levels[1] : 0;
+    result.l3_cache = levels.size() > 2 ? levels[2] : 0;
+    result.memory_latency_ns = points.empty() ? 0.0 : points.back().ns_per_load;
+}
+
+/**
+ * Professional STREAM triad, a[i] = b[i] + s * c[i], on one thread's slice
+ */
+void triad(double* a, const double* b, const double* c, size_t count) {
+    constexpr double kScalar = 3.0;
+    for (size_t i = 0; i < count; ++i) {
+        a[i] = b[i] + kScalar * c[i];
+    }
+}
+
+double triadBandwidth(double* a, double* b, double* c, size_t elements, uint32_t threads) {
+    std::atomic<uint32_t> ready{0};
+    std::atomic<bool> go{false};
+    std::vector<Clock::time_point> finished(threads);
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+
+    for (uint32_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            size_t begin = elements * t / threads;
+            size_t count = elements * (t + 1) / threads - begin;
+
+            // Untimed pass brings each slice to its owner's node and cache state
+            triad(a + begin, b + begin, c + begin, count);
+            ready.fetch_add(1, std::memory_order_acq_rel);
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+
+            for (int pass = 0; pass < kTriadPasses; ++pass) {
+                triad(a + begin, b + begin, c + begin, count);
+            }
+            finished[t] = Clock::now();
+        });
+    }
+
+    while (ready.load(std::memory_order_acquire) < threads) {
+        std::this_thread::yield();
+    }
+    auto start = Clock::now();
+    go.store(true, std::memory_order_release);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    // Wall time from the common start to the last finisher, so threads
+    // that never overlapped on a busy core cannot inflate the total
+    double window = std::chrono::duration<double>(
+        *std::max_element(finished.begin(), finished.end()) - start).count();
+    return window > 0.0 ? 3.0 * sizeof(double) * elements * kTriadPasses / window : 0.0;
+}
+
+void measureBandwidth(Hierarchy& result) {
+    uint64_t largest_cache = std::max({result.l1_cache, result.l2_cache, result.l3_cache});
+    size_t array_bytes = std::clamp<size_t>(4 * largest_cache, kMinStreamBytes, kMaxStreamBytes);
+    size_t elements = array_bytes / sizeof(double);
+
+    LargePageBuffer a(array_bytes), b(array_bytes), c(array_bytes);
+    if (!a || !b || !c) {
+        return;
+    }
+    double* pa = reinterpret_cast<double*>(a.data());
+    double* pb = reinterpret_cast<double*>(b.data());
+    double* pc = reinterpret_cast<double*>(c.data());
+    std::fill(pb, pb + elements, 1.0);
+    std::fill(pc, pc + elements, 2.0);
+
+    uint32_t cores = std::max(1u, std::thread::hardware_concurrency());
+    for (uint32_t threads = 1; threads <= cores; ++threads) {
+        double bytes_per_sec = triadBandwidth(pa, pb, pc, elements, threads);
+        result.bandwidth.push_back({threads, bytes_per_sec});
+        result.peak_bytes_per_sec = std::max(result.peak_bytes_per_sec, bytes_per_sec);
+    }
+
+    for (const BandwidthPoint& point : result.bandwidth) {
+        if (point.bytes_per_sec >= kSaturationFraction * result.peak_bytes_per_sec) {
+            result.saturation_threads = point.threads;
+            break;
+        }
+    }
+}
+
+} // namespace
+
+Hierarchy probe() {
+    Hierarchy result;
+    auto start = Clock::now();
+
+    std::mt19937_64 rng(0x5eed);
+    for (size_t bytes = kMinProbeBytes; bytes <= kMaxProbeBytes; bytes *= 2) {
+        result.latency.push_back({bytes, chaseLatency(bytes, rng)});
+    }
+    locateBoundaries(result);
+    measureBandwidth(result);
+
+    result.duration_ms = elapsedNs(start) / 1e6;
+    TA_LOGI("Memory probe: L1 %llu, L2 %llu, L3 %llu bytes, DRAM %.1f ns, "
+            "peak %.2f GB/s saturating at %u threads (%.0f ms)",
+            static_cast<unsigned long long>(result.l1_cache),
+            static_cast<unsigned long long>(result.l2_cache),
+            static_cast<unsigned long long>(result.l3_cache),
+            result.memory_latency_ns, result.peak_bytes_per_sec / 1e9,
+            result.saturation_threads, result.duration_ms);
+    return result;
+}
+
+const Hierarchy& hierarchy() {
+    static const Hierarchy measured = probe();
+    g_cached.store(&measured, std::memory_order_release);
+    return measured;
+}
+
+const Hierarchy* cachedHierarchy() {
+    return g_cached.load(std::memory_order_acquire);
+}
+
+uint32_t planThreads(size_t per_thread_bytes) {
+    const Hierarchy& memory = hierarchy();
+    uint32_t cores = std::max(1u, std::thread::hardware_concurrency());
+
+    if (per_thread_bytes <= memory.l2_cache || memory.saturation_threads == 0) {
+        return cores;
+    }
+    return std::min(cores, memory.saturation_threads);
+}
+
+} // namespace MemoryProbe
+} // namespace TradingAnarchy
@@ -0,0 +1,236 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Native Executor Implementation - Background Worker Pool
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#include "native_executor.h"
+#include "trading_anarchy_jni.h"
+
+#include <pthread.h>
+#include <algorithm>
+#include <cstdio>
+#include <exception>
+#include <memory>
+
+namespace TradingAnarchy {
+
+NativeExecutor::NativeExecutor(size_t worker_count, const char* name)
+    : name_(name) {
+    
+    if (worker_count == 0) {
+        worker_count = 1;
+    }
+    
+    workers_.reserve(worker_count);
+    for (size_t i = 0; i < worker_count; ++i) {
+        workers_.emplace_back(&NativeExecutor::workerLoop, this, i);
+    }
+    
+    TA_LOGI("NativeExecutor '%s' started with %zu workers", name_, worker_count);
+}
+
+NativeExecutor::~NativeExecutor() {
+    shutdown();
+}
+
+bool NativeExecutor::submitAfter(std::chrono::milliseconds delay, Task task) {
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        if (stopping_) {
+            return false;
+        }
+        if (!timer_thread_.joinable()) {
+            timer_thread_ = std::thread(&NativeExecutor::timerLoop, this);
+        }
+        timers_.push(TimedTask{std::chrono::steady_clock::now() + delay, timer_sequence_++, std::move(task)});
+    }
+    timer_cv_.notify_one();
+    return true;
+}
+
+bool NativeExecutor::submit(Task task) {
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        if (stopping_) {
+            return false;
+        }
+        queue_.push_back(std::move(task));
+    }
+    queue_cv_.notify_one();
+    return true;
+}
+
+void NativeExecutor::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        if (stopping_) {
+            return;
+        }
+        stopping_ = true;
+    }
+    queue_cv_.notify_all();
+    timer_cv_.notify_all();
+    
+    if (timer_thread_.joinable() && timer_thread_.get_id() != std::this_thread::get_id()) {
+        timer_thread_.join();
+    }
+    
+    for (auto& worker : workers_) {
+        if (worker.joinable() && worker.get_id() != std::this_thread::get_id()) {
+            worker.join();
+        }
+    }
+    
+    TA_LOGI("NativeExecutor '%s' stopped after %llu tasks", name_,
+            static_cast<unsigned long long>(completed_tasks_.load()));
+}
+
+void NativeExecutor::parallelFor(size_t count, const std::function<void(size_t)>& body) {
+    if (count == 0) {
+        return;
+    }
+    
+    struct Loop {
+        std::function<void(size_t)> body;
+        size_t count;
+        std::atomic<size_t> next{0};
+        std::atomic<size_t> done{0};
+        std::mutex mutex;
+        std::condition_variable finished;
+        std::exception_ptr error;
+        
+        void run() {
+            for (size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1)) {
+                try {
+                    body(i);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+                // A failed index still counts, or the caller would wait forever
+                if (done.fetch_add(1) + 1 == count) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    finished.notify_all();
+                }
+            }
+        }
+    };
+    
+    auto loop = std::make_shared<Loop>();
+    loop->body = body;
+    loop->count = count;
+    
+    // Late helpers find no index left and exit without touching body's captures
+    size_t helpers = std::min(workers_.size(), count - 1);
+    for (size_t i = 0; i < helpers; ++i) {
+        if (!submit([loop] { loop->run(); })) {
+            break;
+        }
+    }
+    
+    loop->run();
+    
+    std::unique_lock<std::mutex> lock(loop->mutex);
+    loop->finished.wait(lock, [&loop] { return loop->done.load() == loop->count; });
+    
+    // Rethrown only now, once no helper can still be using body's captures
+    if (loop->error) {
+        std::rethrow_exception(loop->error);
+    }
+}
+
+size_t NativeExecutor::pendingTasks() const {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    return queue_.size();
+}
+
+void NativeExecutor::workerLoop(size_t index) {
+    char thread_name[16];
+    snprintf(thread_name, sizeof(thread_name), "%.10s-%zu", name_, index);
+    pthread_setname_np(pthread_self(), thread_name);
+    
+    for (;;) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex_);
+            queue_cv_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+            
+            if (queue_.empty()) {
+                return;  // stopping and fully drained
+            }
+            task = std::move(queue_.front());
+            queue_.pop_front();
+        }
+        
+        try {
+            task();
+        } catch (const std::exception& e) {
+            TA_LOGE("Unhandled exception in executor '%s': %s", name_, e.what());
+        } catch (...) {
+            TA_LOGE("Unhandled unknown exception in executor '%s'", name_);
+        }
+        
+        completed_tasks_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void NativeExecutor::timerLoop() {
+    pthread_setname_np(pthread_self(), "ta-timer");
+    
+    std::unique_lock<std::mutex> lock(queue_mutex_);
+    while (!stopping_) {
+        if (timers_.empty()) {
+            timer_cv_.wait(lock);
+            continue;
+        }
+        
+        auto due = timers_.top().due;
+        if (timer_cv_.wait_until(lock, due) == std::cv_status::no_timeout &&
+            std::chrono::steady_clock::now() < due) {
+            continue;  // woken early by a new timer or shutdown
+        }
+        
+        // Enhanced hand-off of every due timer to the worker queue
+        auto now = std::chrono::steady_clock::now();
+        bool queued = false;
+        while (!timers_.empty() && timers_.top().due <= now) {
+            queue_.push_back(std::move(const_cast<TimedTask&>(timers_.top()).task));
+            timers_.pop();
+            queued = true;
+        }
+        if (queued) {
+            queue_cv_.notify_all();
+        }
+    }
+    
+    // Pending timers are dropped on shutdown
+    timers_ = {};
+}
+
+NativeExecutor& NativeExecutor::engine() {
+    static NativeExecutor executor(2, "ta-engine");
+    return executor;
+}
+
+NativeExecutor& NativeExecutor::lifecycle() {
+    static NativeExecutor executor(1, "ta-lifecycle");
+    return executor;
+}
+
+NativeExecutor& NativeExecutor::callbacks() {
+    static NativeExecutor executor(1, "ta-callbacks");
+    return executor;
+}
+
+NativeExecutor& NativeExecutor::compute() {
+    static NativeExecutor executor(std::max(1u, std::thread::hardware_concurrency()) - 1, "ta-compute");
+    return executor;
+}
+
+} // namespace TradingAnarchy
@@ -0,0 +1,351 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Regression Bench - Reproducible Benchmark Runs Against a Stored Baseline
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#include "regression_bench.h"
+#include "hashrate_watchdog.h"
+#include "large_pages.h"
+#include "scratchpad_kernel.h"
+#include "thread_planner.h"
+#include "trading_anarchy_jni.h"
+
+#include <sched.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <thread>
+
+namespace TradingAnarchy {
+namespace RegressionBench {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using Digest = std::array<uint8_t, Scratchpad::kDigestBytes>;
+
+constexpr char kBaselineFile[] = "/bench-baseline.tsv";
+constexpr size_t kInputBytes = 76;
+constexpr size_t kChecksumBytes = 8;
+constexpr auto kCooldownPoll = std::chrono::seconds(2);
+
+constexpr const char* kVerdictNames[] = {"pass", "regress", "noBaseline", "error"};
+
+uint64_t splitmix64(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+/**
+ * Professional per-thread work - the same inputs for a seed and thread index
+ */
+struct ThreadWork {
+    uint32_t cpu = 0;
+    std::vector<uint8_t> inputs;            // hashes_per_thread blobs of kInputBytes
+    LargePageBuffer scratchpad;
+    Digest fold{};
+    bool pinned = false;
+};
+
+void prepareInputs(ThreadWork& work, uint64_t seed, uint32_t index, uint32_t hashes) {
+    uint64_t state = seed ^ (0xD1B54A32D192ED03ull * (index + 1));
+    work.inputs.resize(static_cast<size_t>(hashes) * kInputBytes);
+    for (size_t i = 0; i < work.inputs.size(); i += sizeof(uint64_t)) {
+        uint64_t word = splitmix64(state);
+        std::memcpy(work.inputs.data() + i, &word, std::min(sizeof(word), work.inputs.size() - i));
+    }
+}
+
+bool pinCurrentThread(uint32_t cpu) {
+    if (cpu >= CPU_SETSIZE) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+}
+
+/**
+ * Enhanced single repetition - threads pin first, then start together
+ */
+double runRepetition(std::vector<ThreadWork>& work, size_t bytes, uint32_t hashes) {
+    std::atomic<uint32_t> ready{0};
+    std::atomic<bool> go{false};
+    std::vector<std::thread> threads;
+    threads.reserve(work.size());
+
+    for (ThreadWork& thread : work) {
+        threads.emplace_back([&thread, &ready, &go, bytes, hashes] {
+            thread.pinned = pinCurrentThread(thread.cpu);
+            thread.fold.fill(0);
+            ready.fetch_add(1, std::memory_order_release);
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+
+            Digest digest;
+            for (uint32_t i = 0; i < hashes; ++i) {
+                Scratchpad::hash(thread.inputs.data() + static_cast<size_t>(i) * kInputBytes, kInputBytes,
+                                 thread.scratchpad.data(), bytes, digest.data());
+                for (size_t b = 0; b < digest.size(); ++b) {
+                    thread.fold[b] ^= digest[b];
+                }
+            }
+        });
+    }
+
+    while (ready.load(std::memory_order_acquire) < work.size()) {
+        std::this_thread::yield();
+    }
+    auto started = Clock::now();
+    go.store(true, std::memory_order_release);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - started).count();
+    return seconds > 0.0 ? static_cast<double>(hashes) * work.size() / seconds : 0.0;
+}
+
+std::string checksumOf(const std::vector<ThreadWork>& work) {
+    uint8_t folded[kChecksumBytes] = {};
+    for (size_t t = 0; t < work.size(); ++t) {
+        for (size_t b = 0; b < Scratchpad::kDigestBytes; ++b) {
+            // Rotate by thread so swapped threads do not cancel out
+            folded[(b + t) % kChecksumBytes] ^= work[t].fold[b];
+        }
+    }
+    char hex[kChecksumBytes * 2 + 1];
+    for (size_t i = 0; i < kChecksumBytes; ++i) {
+        std::snprintf(hex + i * 2, 3, "%02x", folded[i]);
+    }
+    return hex;
+}
+
+/**
+ * Professional cool-down gate - false on timeout
+ */
+bool coolDown(const Options& options, Result& result) {
+    auto started = Clock::now();
+    for (;;) {
+        double celsius = hottestZoneCelsius();
+        if (std::isnan(celsius)) {
+            result.thermal_available = false;
+            return true;
+        }
+        result.thermal_available = true;
+        double waited = std::chrono::duration<double>(Clock::now() - started).count();
+        if (celsius <= options.cooldown_celsius) {
+            result.start_celsius.push_back(celsius);
+            result.cooldown_seconds += waited;
+            return true;
+        }
+        if (waited >= static_cast<double>(options.cooldown_timeout.count())) {
+            char message[128];
+            std::snprintf(message, sizeof(message), "device stayed at %.1f C, above %.1f C for %.0f s",
+                          celsius, options.cooldown_celsius, waited);
+            result.error = message;
+            result.cooldown_seconds += waited;
+            return false;
+        }
+        std::this_thread::sleep_for(kCooldownPoll);
+    }
+}
+
+std::string baselineKey(const Options& options, const Result& result) {
+    std::ostringstream key;
+    key << options.algorithm << ':' << result.scratchpad_bytes << ":t" << result.threads
+        << ":h" << options.hashes_per_thread << ":s" << std::hex << options.seed << std::dec << ":c";
+    for (size_t i = 0; i < result.cpus.size(); ++i) {
+        key << (i ? "," : "") << result.cpus[i];
+    }
+    return key.str();
+}
+
+/**
+ * Enhanced baseline store - one line per key in <directory>/bench-baseline.tsv:
+ * key, checksum, unix time, comma-separated hashrates
+ */
+bool loadBaseline(const std::string& directory, const std::string& key, Result& result, std::string& checksum) {
+    std::ifstream in(directory + kBaselineFile);
+    std::string line;
+    while (std::getline(in, line)) {
+        std::istringstream fields(line);
+        std::string entry_key, entry_checksum, time, samples;
+        if (!std::getline(fields, entry_key, '\t') || entry_key != key ||
+            !std::getline(fields, entry_checksum, '\t') || !std::getline(fields, time, '\t') ||
+            !std::getline(fields, samples, '\t')) {
+            continue;
+        }
+
+        std::vector<double> baseline;
+        std::istringstream values(samples);
+        std::string value;
+        while (std::getline(values, value, ',')) {
+            baseline.push_back(std::atof(value.c_str()));
+        }
+        if (baseline.size() < 2) {
+            continue;
+        }
+        checksum = entry_checksum;
+        result.baseline = std::move(baseline);
+        result.baseline_time = std::atoll(time.c_str());
+        return true;
+    }
+    return false;
+}
+
+bool saveBaseline(const std::string& directory, const std::string& key, const Result& result) {
+    std::string path = directory + kBaselineFile;
+    std::ostringstream kept;
+    {
+        std::ifstream in(path);
+        std::string line;
+        while (std::getline(in, line)) {
+            if (line.compare(0, key.size() + 1, key + "\t") != 0) {
+                kept << line << '\n';
+            }
+        }
+    }
+
+    kept << key << '\t' << result.checksum << '\t' << static_cast<long long>(std::time(nullptr)) << '\t';
+    char value[32];
+    for (size_t i = 0; i < result.hashrates.size(); ++i) {
+        std::snprintf(value, sizeof(value), "%s%.3f", i ? "," : "", result.hashrates[i]);
+        kept << value;
+    }
+    kept << '\n';
+
+    std::string temp = path + ".tmp";
+    {
+        std::ofstream out(temp, std::ios::trunc);
+        out << kept.str();
+        if (!out) {
+            return false;
+        }
+    }
+    return std::rename(temp.c_str(), path.c_str()) == 0;
+}
+
+} // namespace
+
+const char* verdictName(Verdict verdict) {
+    return kVerdictNames[static_cast<size_t>(verdict)];
+}
+
+double hottestZoneCelsius() {
+    double hottest = std::numeric_limits<double>::quiet_NaN();
+    for (const HashrateWatchdog::ThermalZone& zone : HashrateWatchdog::captureThermal()) {
+        // Disconnected sensors read 0 or negative
+        if (zone.celsius > 0.0 && !(zone.celsius <= hottest)) {
+            hottest = zone.celsius;
+        }
+    }
+    return hottest;
+}
+
+/**
+ * Professional reproducible run
+ *
+ * One unrecorded warm-up repetition faults in the scratchpads, then each
+ * recorded repetition waits for the cool-down and times the same fixed
+ * work. Every repetition must produce the same checksum.
+ */
+Result run(const Options& options) {
+    Result result;
+    auto started = Clock::now();
+
+    ThreadPlanner::Plan plan = ThreadPlanner::plan(options.algorithm);
+    if (plan.cpus.empty()) {
+        plan.cpus.push_back(0);
+    }
+    result.scratchpad_bytes = Scratchpad::normalizeBytes(plan.scratchpad_bytes);
+    result.threads = options.threads > 0 ? options.threads : plan.threads;
+    result.threads = std::clamp<uint32_t>(result.threads, 1, static_cast<uint32_t>(plan.cpus.size()));
+    result.cpus.assign(plan.cpus.begin(), plan.cpus.begin() + result.threads);
+    result.key = baselineKey(options, result);
+
+    std::vector<ThreadWork> work(result.threads);
+    for (uint32_t i = 0; i < result.threads; ++i) {
+        work[i].cpu = result.cpus[i];
+        work[i].scratchpad = LargePageBuffer(result.scratchpad_bytes);
+        prepareInputs(work[i], options.seed, i, options.hashes_per_thread);
+        if (!work[i].scratchpad) {
+            result.error = "scratchpad allocation failed";
+            return result;
+        }
+    }
+
+    TA_LOGI("Regression bench %s: %u threads, %u repetitions, cool-down to %.1f C",
+            result.key.c_str(), result.threads, options.repetitions, options.cooldown_celsius);
+
+    runRepetition(work, result.scratchpad_bytes, options.hashes_per_thread);
+    result.checksum = checksumOf(work);
+    result.pinned = std::all_of(work.begin(), work.end(), [](const ThreadWork& w) { return w.pinned; });
+
+    for (uint32_t rep = 0; rep < options.repetitions; ++rep) {
+        if (!coolDown(options, result)) {
+            break;
+        }
+        result.hashrates.push_back(runRepetition(work, result.scratchpad_bytes, options.hashes_per_thread));
+        result.pinned = result.pinned &&
+                        std::all_of(work.begin(), work.end(), [](const ThreadWork& w) { return w.pinned; });
+        if (checksumOf(work) != result.checksum) {
+            result.error = "checksum changed between repetitions";
+            break;
+        }
+    }
+    result.summary = BenchStats::summarize(result.hashrates);
+    result.duration_seconds = std::chrono::duration<double>(Clock::now() - started).count();
+
+    if (result.error.empty() && result.hashrates.size() < 2) {
+        result.error = "fewer than two repetitions";
+    }
+    if (!result.error.empty()) {
+        TA_LOGW("Regression bench %s failed: %s", result.key.c_str(), result.error.c_str());
+        return result;
+    }
+    result.success = true;
+
+    std::string baseline_checksum;
+    result.have_baseline = !options.directory.empty() &&
+                           loadBaseline(options.directory, result.key, result, baseline_checksum);
+    if (!result.have_baseline) {
+        result.verdict = Verdict::NO_BASELINE;
+    } else if (baseline_checksum != result.checksum) {
+        result.verdict = Verdict::ERROR;
+        result.error = "checksum " + result.checksum + " differs from the baseline's " + baseline_checksum;
+    } else {
+        result.test = BenchStats::mannWhitneyTest(result.baseline, result.hashrates);
+        bool regressed = result.test.p_value < options.alpha &&
+                         result.test.relative_shift <= -options.min_regression;
+        result.verdict = regressed ? Verdict::REGRESS : Verdict::PASS;
+    }
+
+    if (!options.directory.empty() && (result.verdict == Verdict::NO_BASELINE || options.update_baseline)) {
+        result.baseline_updated = saveBaseline(options.directory, result.key, result);
+    }
+
+    TA_LOGI("Regression bench %s: %s, median %.1f H/s, shift %+.2f%%, p=%.4f, rank-biserial %.2f",
+            result.key.c_str(), verdictName(result.verdict), result.summary.median,
+            result.test.relative_shift * 100.0, result.test.p_value, result.test.rank_biserial);
+    return result;
+}
+
+} // namespace RegressionBench
+} // namespace TradingAnarchy
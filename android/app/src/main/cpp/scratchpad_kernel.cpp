@@ -0,0 +1,294 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Scratchpad Kernel - CryptoNight-Style Memory-Hard Hashing and Cache Sweeps
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#include "scratchpad_kernel.h"
+#include "keccak.h"
+#include "trading_anarchy_jni.h"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+namespace TradingAnarchy {
+namespace Scratchpad {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Monero hashing blob: 76 bytes with the 32-bit nonce at offset 39
+constexpr size_t kBlobBytes = 76;
+constexpr size_t kNonceOffset = 39;
+
+constexpr uint64_t kGolden = 0x9e3779b97f4a7c15ull;
+constexpr uint64_t kMixMultiplier = 0xbf58476d1ce4e5b9ull;
+
+inline uint64_t load64(const uint8_t* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline void store64(uint8_t* p, uint64_t v) {
+    std::memcpy(p, &v, sizeof(v));
+}
+
+inline uint64_t splitmix(uint64_t z) {
+    z = (z ^ (z >> 30)) * kMixMultiplier;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+/**
+ * Professional main loop
+ *
+ * CryptoNight applies one AES round keyed by `a` where this loop runs a
+ * multiply-xorshift; both put a few cycles of compute between a load and
+ * the next dependent address, so the memory behaviour is the same.
+ */
+void mainLoopGeneric(uint8_t* scratchpad, size_t bytes, size_t iterations, uint64_t state[4]) {
+    const size_t mask = (bytes - 1) & ~size_t{15};
+    uint64_t a0 = state[0], a1 = state[1];
+    uint64_t b0 = state[2], b1 = state[3];
+
+    for (size_t i = 0; i < iterations; ++i) {
+        uint8_t* slot = scratchpad + (a0 & mask);
+        uint64_t c0 = load64(slot) ^ a0;
+        uint64_t c1 = load64(slot + 8) ^ a1;
+        c0 *= kMixMultiplier;
+        c0 ^= c0 >> 29;
+        c1 ^= c0;
+        store64(slot, b0 ^ c0);
+        store64(slot + 8, b1 ^ c1);
+
+        slot = scratchpad + (c0 & mask);
+        uint64_t d0 = load64(slot);
+        uint64_t d1 = load64(slot + 8);
+        unsigned __int128 product = static_cast<unsigned __int128>(c0) * d0;
+        a0 += static_cast<uint64_t>(product >> 64);
+        a1 += static_cast<uint64_t>(product);
+        store64(slot, a0);
+        store64(slot + 8, a1);
+        a0 ^= d0;
+        a1 ^= d1;
+
+        b0 = c0;
+        b1 = c1;
+    }
+
+    state[0] = a0;
+    state[1] = a1;
+    state[2] = b0;
+    state[3] = b1;
+}
+
+/**
+ * Enhanced hash stages - Keccak seed, scratchpad fill and Keccak finalization
+ */
+void initialize(const uint8_t* input, size_t length, uint64_t keccak[Keccak::kStateLanes], uint64_t registers[4]) {
+    std::memset(keccak, 0, Keccak::kStateLanes * sizeof(uint64_t));
+    Keccak::keccak_256(input, length, reinterpret_cast<uint8_t*>(keccak));
+    Keccak::permute(keccak);
+
+    // a = k0 ^ k4, b = k2 ^ k6 as in CryptoNight
+    registers[0] = keccak[0] ^ keccak[4];
+    registers[1] = keccak[1] ^ keccak[5];
+    registers[2] = keccak[2] ^ keccak[6];
+    registers[3] = keccak[3] ^ keccak[7];
+}
+
+void fill(uint8_t* scratchpad, size_t bytes, const uint64_t keccak[Keccak::kStateLanes]) {
+    // Four independent streams per 32 bytes keep the fill store-bound
+    uint64_t streams[4] = {keccak[8], keccak[9], keccak[10], keccak[11]};
+    for (size_t offset = 0; offset < bytes; offset += 32) {
+        for (size_t j = 0; j < 4; ++j) {
+            streams[j] += kGolden;
+            store64(scratchpad + offset + 8 * j, splitmix(streams[j]));
+        }
+    }
+}
+
+void finalize(const uint8_t* scratchpad, size_t bytes, uint64_t keccak[Keccak::kStateLanes],
+              const uint64_t registers[4], uint8_t out[kDigestBytes]) {
+    // Every word feeds the digest, so the whole scratchpad is read once more
+    uint64_t folded[16] = {};
+    for (size_t offset = 0; offset < bytes; offset += sizeof(folded)) {
+        for (size_t j = 0; j < 16; ++j) {
+            folded[j] ^= load64(scratchpad + offset + 8 * j);
+        }
+    }
+
+    for (size_t j = 0; j < 16; ++j) {
+        keccak[j] ^= folded[j];
+    }
+    for (size_t j = 0; j < 4; ++j) {
+        keccak[16 + j] ^= registers[j];
+    }
+    Keccak::permute(keccak);
+    Keccak::keccak_256(reinterpret_cast<const uint8_t*>(keccak), Keccak::kStateLanes * sizeof(uint64_t), out);
+}
+
+/**
+ * Professional per-thread measurement on a private scratchpad
+ */
+struct ThreadSample {
+    uint64_t hashes = 0;
+    double seconds = 0.0;
+    double loop_seconds = 0.0;
+    LargePageBuffer::Mode mode = LargePageBuffer::Mode::NONE;
+};
+
+ThreadSample measureThread(size_t bytes, uint32_t index, double seconds) {
+    ThreadSample sample;
+    LargePageBuffer buffer(bytes);
+    if (!buffer) {
+        return sample;
+    }
+    sample.mode = buffer.mode();
+
+    uint8_t blob[kBlobBytes] = {};
+    blob[0] = static_cast<uint8_t>(index);
+    uint8_t digest[kDigestBytes];
+
+    // One untimed hash faults every page in before the window starts
+    hash(blob, sizeof(blob), buffer.data(), bytes, digest);
+
+    MainLoopFn mainLoop = mainLoopKernel().get();
+    size_t iterations = iterationsFor(bytes);
+    uint64_t keccak[Keccak::kStateLanes];
+    uint64_t registers[4];
+    Clock::duration in_loop{};
+
+    auto start = Clock::now();
+    auto deadline = start + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(seconds));
+    for (uint32_t nonce = 0; Clock::now() < deadline; ++nonce) {
+        std::memcpy(blob + kNonceOffset, &nonce, sizeof(nonce));
+        initialize(blob, sizeof(blob), keccak, registers);
+        fill(buffer.data(), bytes, keccak);
+
+        auto loop_start = Clock::now();
+        mainLoop(buffer.data(), bytes, iterations, registers);
+        in_loop += Clock::now() - loop_start;
+
+        finalize(buffer.data(), bytes, keccak, registers, digest);
+        sample.hashes++;
+    }
+
+    sample.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    sample.loop_seconds = std::chrono::duration<double>(in_loop).count();
+    return sample;
+}
+
+// Resolve at load time rather than on the first hash
+[[maybe_unused]] const KernelDispatchBase& kLoadTimeResolution = mainLoopKernel();
+
+} // namespace
+
+size_t scratchpadBytesFor(const std::string& algorithm) {
+    if (algorithm.rfind("cn-pico", 0) == 0) {
+        return 256 * 1024;
+    }
+    if (algorithm.rfind("cn-lite", 0) == 0) {
+        return 1024 * 1024;
+    }
+    return kMaxBytes;
+}
+
+size_t normalizeBytes(size_t bytes) {
+    return std::bit_floor(std::clamp(bytes, kMinBytes, kMaxBytes));
+}
+
+size_t iterationsFor(size_t bytes) {
+    return bytes / 4;
+}
+
+void hash(const uint8_t* input, size_t length, uint8_t* scratchpad, size_t bytes, uint8_t out[kDigestBytes]) {
+    uint64_t keccak[Keccak::kStateLanes];
+    uint64_t registers[4];
+    initialize(input, length, keccak, registers);
+    fill(scratchpad, bytes, keccak);
+    mainLoopKernel().get()(scratchpad, bytes, iterationsFor(bytes), registers);
+    finalize(scratchpad, bytes, keccak, registers, out);
+}
+
+BenchResult benchmark(size_t bytes, uint32_t threads, double seconds) {
+    BenchResult result;
+    result.scratchpad_bytes = normalizeBytes(bytes);
+    result.threads = threads > 0 ? threads : std::max(1u, std::thread::hardware_concurrency());
+
+    std::vector<ThreadSample> samples(result.threads);
+    std::vector<std::thread> workers;
+    workers.reserve(result.threads - 1);
+    for (uint32_t t = 1; t < result.threads; ++t) {
+        workers.emplace_back([&samples, &result, t, seconds] {
+            samples[t] = measureThread(result.scratchpad_bytes, t, seconds);
+        });
+    }
+    samples[0] = measureThread(result.scratchpad_bytes, 0, seconds);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    double loop_ns = 0.0;
+    uint32_t measured = 0;
+    for (const ThreadSample& sample : samples) {
+        if (sample.hashes == 0) {
+            continue;
+        }
+        result.hashes += sample.hashes;
+        result.seconds = std::max(result.seconds, sample.seconds);
+        result.hashes_per_sec += sample.hashes / sample.seconds;
+        loop_ns += sample.loop_seconds * 1e9 / (sample.hashes * iterationsFor(result.scratchpad_bytes));
+        result.page_mode = sample.mode;
+        measured++;
+    }
+    if (measured > 0) {
+        result.ns_per_iteration = loop_ns / measured;
+    }
+
+    TA_LOGI("Scratchpad bench: %zu bytes x %u threads, %.1f H/s, %.2f ns/iteration, %s pages",
+            result.scratchpad_bytes, result.threads, result.hashes_per_sec, result.ns_per_iteration,
+            LargePageBuffer::modeName(result.page_mode));
+    return result;
+}
+
+std::vector<BenchResult> sweep(double seconds_per_size) {
+    std::vector<BenchResult> results;
+    for (size_t bytes = kMinBytes; bytes <= kMaxBytes; bytes *= 2) {
+        results.push_back(benchmark(bytes, 1, seconds_per_size));
+    }
+    return results;
+}
+
+KernelDispatch<MainLoopFn>& mainLoopKernel() {
+    static KernelDispatch<MainLoopFn> dispatch("cn-scratchpad", {
+        {"generic", 0, mainLoopGeneric},
+    });
+
+    static const bool workload_installed = [] {
+        dispatch.setWorkload([](size_t iterations) {
+            // A fresh, identically filled scratchpad per run so every variant sees the same data
+            std::vector<uint8_t> scratchpad(kMinBytes);
+            uint64_t keccak[Keccak::kStateLanes] = {};
+            fill(scratchpad.data(), scratchpad.size(), keccak);
+            uint64_t registers[4] = {1, 2, 3, 4};
+            mainLoopKernel().get()(scratchpad.data(), scratchpad.size(), iterations, registers);
+            return registers[0] ^ registers[1] ^ registers[2] ^ registers[3];
+        });
+        return true;
+    }();
+    (void)workload_installed;
+
+    return dispatch;
+}
+
+} // namespace Scratchpad
+} // namespace TradingAnarchy
@@ -0,0 +1,392 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Security Manager - Parallel Memory-Mapped Integrity Verification
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#include "security_manager.h"
+#include "native_executor.h"
+#include "xmrig_bench.h"
+#include "trading_anarchy_jni.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace TradingAnarchy {
+
+namespace {
+
+using Digest = std::array<uint8_t, Keccak::kDigestBytes>;
+
+constexpr char kCacheFile[] = "/integrity-cache.tsv";
+
+// Domain bytes keep interior nodes and the root apart from leaf data
+constexpr uint8_t kParentDomain = 0x01;
+constexpr uint8_t kRootDomain = 0x02;
+
+std::string toHex(const uint8_t* bytes, size_t length) {
+    static const char digits[] = "0123456789abcdef";
+    std::string hex;
+    hex.reserve(length * 2);
+    for (size_t i = 0; i < length; ++i) {
+        hex.push_back(digits[bytes[i] >> 4]);
+        hex.push_back(digits[bytes[i] & 0x0f]);
+    }
+    return hex;
+}
+
+bool endsWith(const std::string& text, const char* suffix) {
+    size_t length = std::strlen(suffix);
+    return text.size() >= length && text.compare(text.size() - length, length, suffix) == 0;
+}
+
+void listDirectory(const std::string& directory, const char* suffix, std::vector<std::string>& out) {
+    DIR* dir = opendir(directory.c_str());
+    if (dir == nullptr) {
+        return;
+    }
+    while (dirent* entry = readdir(dir)) {
+        std::string name = entry->d_name;
+        if (endsWith(name, suffix)) {
+            out.push_back(directory + "/" + name);
+        }
+    }
+    closedir(dir);
+}
+
+/**
+ * Professional tree root over leaf digests - parent = H(0x01 || left || right),
+ * an odd node is promoted unchanged to the next level
+ */
+Digest treeRoot(std::vector<Digest> level, uint64_t size) {
+    uint8_t node[1 + 2 * Keccak::kDigestBytes];
+    node[0] = kParentDomain;
+
+    while (level.size() > 1) {
+        size_t parents = (level.size() + 1) / 2;
+        for (size_t i = 0; i < parents; ++i) {
+            if (2 * i + 1 == level.size()) {
+                level[i] = level[2 * i];
+                continue;
+            }
+            std::memcpy(node + 1, level[2 * i].data(), Keccak::kDigestBytes);
+            std::memcpy(node + 1 + Keccak::kDigestBytes, level[2 * i + 1].data(), Keccak::kDigestBytes);
+            Keccak::sha3_256(node, sizeof(node), level[i].data());
+        }
+        level.resize(parents);
+    }
+
+    // The root binds the file length, so files of different sizes never share a tree
+    uint8_t root[1 + sizeof(uint64_t) + Keccak::kDigestBytes] = {kRootDomain};
+    for (size_t i = 0; i < sizeof(uint64_t); ++i) {
+        root[1 + i] = static_cast<uint8_t>(size >> (8 * i));
+    }
+    if (!level.empty()) {
+        std::memcpy(root + 1 + sizeof(uint64_t), level[0].data(), Keccak::kDigestBytes);
+    }
+
+    Digest digest;
+    Keccak::sha3_256(root, sizeof(root), digest.data());
+    return digest;
+}
+
+/**
+ * Enhanced parallel leaf hashing over a mapped file
+ *
+ * Runs on the shared compute pool. Large files hand each index kBatchWays
+ * chunks for the interleaved permutation; small ones keep one chunk per
+ * index so every core still gets work.
+ */
+std::vector<Digest> hashLeaves(const uint8_t* data, uint64_t size) {
+    static_assert(sizeof(Digest) == Keccak::kDigestBytes, "leaf digests must be contiguous");
+
+    size_t chunks = static_cast<size_t>((size + SecurityManager::kChunkSize - 1) / SecurityManager::kChunkSize);
+    std::vector<Digest> leaves(chunks);
+
+    NativeExecutor& pool = NativeExecutor::compute();
+    size_t cores = pool.workerCount() + 1;
+    size_t ways = chunks >= cores * Keccak::kBatchWays ? Keccak::kBatchWays : 1;
+    size_t groups = (chunks + ways - 1) / ways;
+
+    auto hashGroup = [&](size_t group) {
+        const uint8_t* inputs[Keccak::kBatchWays];
+        size_t lengths[Keccak::kBatchWays];
+        size_t first = group * ways;
+        size_t count = std::min(ways, chunks - first);
+        for (size_t i = 0; i < count; ++i) {
+            uint64_t offset = static_cast<uint64_t>(first + i) * SecurityManager::kChunkSize;
+            inputs[i] = data + offset;
+            lengths[i] = static_cast<size_t>(std::min<uint64_t>(SecurityManager::kChunkSize, size - offset));
+        }
+        Keccak::sha3_256Many(inputs, lengths, count, leaves[first].data());
+    };
+
+    pool.parallelFor(groups, hashGroup);
+    return leaves;
+}
+
+} // namespace
+
+SecurityManager& SecurityManager::instance() {
+    static SecurityManager manager;
+    return manager;
+}
+
+void SecurityManager::setCacheDirectory(const std::string& directory) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::string path = directory.empty() ? std::string() : directory + kCacheFile;
+    if (path != cache_path_) {
+        cache_path_ = path;
+        cache_loaded_ = false;
+    }
+}
+
+std::string SecurityManager::hashFile(const std::string& path, uint64_t* size) {
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return {};
+    }
+
+    struct stat st{};
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return {};
+    }
+
+    uint64_t length = static_cast<uint64_t>(st.st_size);
+    std::vector<Digest> leaves;
+    if (length > 0) {
+        void* mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            close(fd);
+            return {};
+        }
+        madvise(mapping, length, MADV_SEQUENTIAL);
+        leaves = hashLeaves(static_cast<const uint8_t*>(mapping), length);
+        munmap(mapping, length);
+    }
+    close(fd);
+
+    if (size != nullptr) {
+        *size = length;
+    }
+    Digest root = treeRoot(std::move(leaves), length);
+    return toHex(root.data(), root.size());
+}
+
+std::vector<std::string> SecurityManager::defaultTargets(const std::string& native_lib_dir) {
+    std::vector<std::string> targets;
+    if (native_lib_dir.empty()) {
+        return targets;
+    }
+
+    // Uncompressed libraries load straight from the APK ("base.apk!/lib/<abi>")
+    size_t in_apk = native_lib_dir.find(".apk!");
+    if (in_apk != std::string::npos) {
+        targets.push_back(native_lib_dir.substr(0, in_apk + 4));
+    } else {
+        listDirectory(native_lib_dir, ".so", targets);
+    }
+
+    // Assets live in the installed APKs two levels above lib/<abi>
+    size_t lib = native_lib_dir.rfind("/lib/");
+    if (lib != std::string::npos && in_apk == std::string::npos) {
+        listDirectory(native_lib_dir.substr(0, lib), ".apk", targets);
+    }
+
+    std::sort(targets.begin(), targets.end());
+    targets.erase(std::unique(targets.begin(), targets.end()), targets.end());
+    return targets;
+}
+
+int64_t SecurityManager::installTime(const std::string& native_lib_dir) {
+    // The install directory, not base.apk: rewriting the APK in place must not re-baseline it
+    size_t end = native_lib_dir.find(".apk!");
+    if (end != std::string::npos) {
+        end = native_lib_dir.rfind('/', end);
+    } else {
+        end = native_lib_dir.rfind("/lib/");
+    }
+    if (end == std::string::npos) {
+        return 0;
+    }
+
+    struct stat st{};
+    if (stat(native_lib_dir.substr(0, end).c_str(), &st) != 0) {
+        return 0;
+    }
+    return static_cast<int64_t>(st.st_mtim.tv_sec) * 1000000000LL + st.st_mtim.tv_nsec;
+}
+
+IntegrityReport SecurityManager::verify(const std::vector<std::string>& paths, int64_t install_time_ns) {
+    auto started = std::chrono::steady_clock::now();
+    IntegrityReport report;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!cache_loaded_) {
+        loadCache();
+    }
+
+    bool cache_dirty = false;
+    for (const std::string& path : paths) {
+        struct stat st{};
+        if (stat(path.c_str(), &st) != 0) {
+            report.missing.push_back(path);
+            continue;
+        }
+
+        CacheEntry& entry = cache_[path];
+        int64_t mtime_ns = static_cast<int64_t>(st.st_mtim.tv_sec) * 1000000000LL + st.st_mtim.tv_nsec;
+
+        FileIntegrity file;
+        file.path = path;
+        file.size = static_cast<uint64_t>(st.st_size);
+        file.cached = !entry.digest.empty() &&
+                      entry.device == static_cast<uint64_t>(st.st_dev) &&
+                      entry.inode == static_cast<uint64_t>(st.st_ino) &&
+                      entry.size == file.size && entry.mtime_ns == mtime_ns;
+
+        if (file.cached) {
+            file.digest = entry.digest;
+        } else {
+            file.digest = hashFile(path, &file.size);
+            if (file.digest.empty()) {
+                report.missing.push_back(path);
+                continue;
+            }
+            report.files_hashed++;
+            report.bytes_hashed += file.size;
+
+            entry.device = static_cast<uint64_t>(st.st_dev);
+            entry.inode = static_cast<uint64_t>(st.st_ino);
+            entry.size = file.size;
+            entry.mtime_ns = mtime_ns;
+            entry.digest = file.digest;
+            cache_dirty = true;
+        }
+
+        // A new install legitimately replaces the files, so it starts a new baseline
+        if (entry.baseline.empty() || entry.install_time_ns != install_time_ns) {
+            entry.baseline = file.digest;
+            entry.install_time_ns = install_time_ns;
+            cache_dirty = true;
+        }
+
+        file.modified = file.digest != entry.baseline;
+        if (file.modified) {
+            report.modified.push_back(path);
+            TA_LOGW("Integrity mismatch for %s", path.c_str());
+        }
+        report.files.push_back(std::move(file));
+    }
+
+    // Drop paths from earlier installs so the cache does not grow with every update
+    for (auto it = cache_.begin(); it != cache_.end();) {
+        if (std::find(paths.begin(), paths.end(), it->first) == paths.end()) {
+            it = cache_.erase(it);
+            cache_dirty = true;
+        } else {
+            ++it;
+        }
+    }
+
+    if (cache_dirty && !cache_path_.empty() && !saveCache()) {
+        TA_LOGW("Failed to persist integrity cache to %s", cache_path_.c_str());
+    }
+
+    // Fingerprint over "name digest" lines in path order
+    std::string manifest;
+    for (const FileIntegrity& file : report.files) {
+        size_t slash = file.path.rfind('/');
+        manifest += file.path.substr(slash == std::string::npos ? 0 : slash + 1);
+        manifest += ' ';
+        manifest += file.digest;
+        manifest += '\n';
+    }
+    Digest fingerprint;
+    Keccak::sha3_256(reinterpret_cast<const uint8_t*>(manifest.data()), manifest.size(), fingerprint.data());
+    report.fingerprint = toHex(fingerprint.data(), fingerprint.size());
+
+    report.valid = !report.files.empty() && report.missing.empty() && report.modified.empty();
+    report.duration_ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - started).count();
+
+    TA_LOGI("Integrity check: %zu files, %u hashed (%llu bytes) in %.1f ms, valid=%d",
+            report.files.size(), report.files_hashed,
+            static_cast<unsigned long long>(report.bytes_hashed), report.duration_ms, report.valid);
+    return report;
+}
+
+void SecurityManager::loadCache() {
+    cache_loaded_ = true;
+    if (cache_path_.empty()) {
+        return;
+    }
+
+    // path, device, inode, size, mtime (ns), digest, baseline, install time (ns)
+    std::ifstream in(cache_path_);
+    std::string line;
+    while (std::getline(in, line)) {
+        std::istringstream fields(line);
+        std::string path;
+        CacheEntry entry;
+        if (std::getline(fields, path, '\t') &&
+            fields >> entry.device >> entry.inode >> entry.size >> entry.mtime_ns >> entry.digest >> entry.baseline) {
+            fields >> entry.install_time_ns;  // absent in older caches, which then re-baseline
+            cache_[path] = std::move(entry);
+        }
+    }
+}
+
+bool SecurityManager::saveCache() const {
+    std::string temp = cache_path_ + ".tmp";
+    {
+        std::ofstream out(temp, std::ios::trunc);
+        for (const auto& item : cache_) {
+            const CacheEntry& entry = item.second;
+            if (entry.digest.empty()) {
+                continue;
+            }
+            out << item.first << '\t' << entry.device << '\t' << entry.inode << '\t' << entry.size << '\t'
+                << entry.mtime_ns << '\t' << entry.digest << '\t' << entry.baseline << '\t'
+                << entry.install_time_ns << '\n';
+        }
+        if (!out) {
+            return false;
+        }
+    }
+    return std::rename(temp.c_str(), cache_path_.c_str()) == 0;
+}
+
+/**
+ * Professional JNIBridge integrity hooks over the shared manager
+ */
+bool JNIBridge::verifyIntegrity() const {
+    SecurityManager& manager = SecurityManager::instance();
+    std::string native_lib_dir = XmrigBench::nativeLibraryDir();
+    return manager.verify(SecurityManager::defaultTargets(native_lib_dir),
+                          SecurityManager::installTime(native_lib_dir)).valid;
+}
+
+std::string JNIBridge::getSecurityFingerprint() const {
+    SecurityManager& manager = SecurityManager::instance();
+    std::string native_lib_dir = XmrigBench::nativeLibraryDir();
+    return manager.verify(SecurityManager::defaultTargets(native_lib_dir),
+                          SecurityManager::installTime(native_lib_dir)).fingerprint;
+}
+
+} // namespace TradingAnarchy
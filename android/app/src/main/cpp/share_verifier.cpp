@@ -0,0 +1,250 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Share Verifier - Batched Local Pre-Verification of Candidate Shares
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#include "share_verifier.h"
+#include "trading_anarchy_jni.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+
+namespace TradingAnarchy {
+
+namespace {
+
+constexpr const char* kReasonNames[ShareVerifier::kReasonCount] = {
+    "stale",
+    "lowDifficulty",
+    "duplicateNonce",
+    "hashMismatch",
+};
+
+bool parseHex(const std::string& hex, uint8_t* out) {
+    for (size_t i = 0; i < hex.size() / 2; ++i) {
+        char byte[3] = {hex[2 * i], hex[2 * i + 1], '\0'};
+        char* end = nullptr;
+        unsigned long value = std::strtoul(byte, &end, 16);
+        if (end != byte + 2) {
+            return false;
+        }
+        out[i] = static_cast<uint8_t>(value);
+    }
+    return true;
+}
+
+} // namespace
+
+ShareVerifier::ShareVerifier(SubmitFn submit)
+    : submit_(std::move(submit)) {
+    queue_.reserve(kMaxBatch);
+    worker_ = std::thread([this] { workerLoop(); });
+}
+
+ShareVerifier::~ShareVerifier() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+void ShareVerifier::setJob(Job job) {
+    auto next = std::make_shared<const Job>(std::move(job));
+    std::lock_guard<std::mutex> lock(mutex_);
+    job_ = std::move(next);
+}
+
+bool ShareVerifier::enqueue(const Candidate& candidate) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopping_ || queue_.size() >= kQueueCapacity) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        queue_.push_back(candidate);
+    }
+    enqueued_.fetch_add(1, std::memory_order_relaxed);
+    wake_.notify_one();
+    return true;
+}
+
+void ShareVerifier::drain() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this] { return queue_.empty() && !busy_; });
+}
+
+ShareVerifier::Stats ShareVerifier::stats() const {
+    Stats stats;
+    stats.enqueued = enqueued_.load(std::memory_order_relaxed);
+    stats.dropped = dropped_.load(std::memory_order_relaxed);
+    stats.verified = verified_.load(std::memory_order_relaxed);
+    stats.submitted = submitted_.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < kReasonCount; ++i) {
+        stats.rejected[i] = rejected_[i].load(std::memory_order_relaxed);
+    }
+    stats.batches = batches_.load(std::memory_order_relaxed);
+    if (stats.batches > 0) {
+        stats.mean_batch_size = static_cast<double>(stats.verified) / stats.batches;
+    }
+    uint64_t hashed = hashed_.load(std::memory_order_relaxed);
+    if (hashed > 0) {
+        stats.hash_us = hash_ns_.load(std::memory_order_relaxed) / 1e3 / hashed;
+    }
+    return stats;
+}
+
+const char* ShareVerifier::reasonName(Reason reason) {
+    return kReasonNames[static_cast<size_t>(reason)];
+}
+
+uint64_t ShareVerifier::targetFromHex(const std::string& hex) {
+    uint8_t bytes[8] = {};
+    if ((hex.size() != 8 && hex.size() != 16) || !parseHex(hex, bytes)) {
+        return 0;
+    }
+
+    uint64_t target = 0;
+    for (size_t i = hex.size() / 2; i-- > 0;) {
+        target = (target << 8) | bytes[i];
+    }
+    if (hex.size() == 8) {
+        // Compact form: difficulty 0xFFFFFFFF / t32 scaled to 64 bits
+        target = target == 0 ? 0 : 0xFFFFFFFFFFFFFFFFull / (0xFFFFFFFFull / target);
+    }
+    return target;
+}
+
+bool ShareVerifier::meetsTarget(const uint8_t hash[Scratchpad::kDigestBytes], uint64_t target) {
+    uint64_t value = 0;
+    for (size_t i = Scratchpad::kDigestBytes; i-- > Scratchpad::kDigestBytes - 8;) {
+        value = (value << 8) | hash[i];
+    }
+    return value < target;
+}
+
+void ShareVerifier::workerLoop() {
+    std::vector<Candidate> batch;
+    batch.reserve(kMaxBatch);
+
+    for (;;) {
+        std::shared_ptr<const Job> job;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+            if (queue_.empty()) {
+                return;     // stopping with nothing left to verify
+            }
+
+            size_t take = std::min(queue_.size(), kMaxBatch);
+            batch.assign(std::make_move_iterator(queue_.begin()),
+                         std::make_move_iterator(queue_.begin() + take));
+            queue_.erase(queue_.begin(), queue_.begin() + take);
+            job = job_;
+            busy_ = true;
+        }
+
+        verifyBatch(batch, job);
+        batches_.fetch_add(1, std::memory_order_relaxed);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            busy_ = false;
+        }
+        idle_.notify_all();
+    }
+}
+
+void ShareVerifier::reject(Reason reason) {
+    rejected_[static_cast<size_t>(reason)].fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * Professional batch verification
+ *
+ * The job is snapshotted once per batch, so a switch that lands while a
+ * batch is being hashed is seen from the next batch on; the candidates
+ * already in hand are treated like shares in flight when the pool switched.
+ */
+void ShareVerifier::verifyBatch(const std::vector<Candidate>& batch, const std::shared_ptr<const Job>& job) {
+    std::vector<uint8_t> blob;
+    size_t bytes = 0;
+    if (job) {
+        blob = job->blob;
+        bytes = Scratchpad::normalizeBytes(job->scratchpad_bytes);
+        if (seen_job_ != job->job_id) {
+            seen_job_ = job->job_id;
+            seen_nonces_.clear();
+        }
+        if (scratchpad_.size() < bytes) {
+            scratchpad_ = LargePageBuffer(bytes);
+        }
+    }
+
+    uint8_t digest[Scratchpad::kDigestBytes];
+    size_t mismatches = 0;
+    const Candidate* first_mismatch = nullptr;
+    for (const Candidate& candidate : batch) {
+        verified_.fetch_add(1, std::memory_order_relaxed);
+
+        if (!job || candidate.job_id != job->job_id) {
+            reject(Reason::STALE);
+            continue;
+        }
+        if (seen_nonces_.count(candidate.nonce) != 0) {
+            reject(Reason::DUPLICATE_NONCE);
+            continue;
+        }
+        if (!scratchpad_ || job->nonce_offset + sizeof(uint32_t) > blob.size()) {
+            TA_LOGE("Share verifier cannot hash job %s; candidate from worker %u dropped",
+                    job->job_id.c_str(), candidate.worker);
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+
+        std::memcpy(blob.data() + job->nonce_offset, &candidate.nonce, sizeof(candidate.nonce));
+        auto started = std::chrono::steady_clock::now();
+        Scratchpad::hash(blob.data(), blob.size(), scratchpad_.data(), bytes, digest);
+        hash_ns_.fetch_add(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                               std::chrono::steady_clock::now() - started).count()),
+                           std::memory_order_relaxed);
+        hashed_.fetch_add(1, std::memory_order_relaxed);
+
+        if (std::memcmp(digest, candidate.hash.data(), sizeof(digest)) != 0) {
+            first_mismatch = first_mismatch ? first_mismatch : &candidate;
+            ++mismatches;
+            reject(Reason::HASH_MISMATCH);
+            continue;
+        }
+
+        // Only a verified hash claims the nonce, so a corrupted candidate can be resubmitted
+        seen_nonces_.insert(candidate.nonce);
+        if (!meetsTarget(digest, job->target)) {
+            reject(Reason::LOW_DIFFICULTY);
+            continue;
+        }
+
+        submitted_.fetch_add(1, std::memory_order_relaxed);
+        if (submit_) {
+            submit_(candidate);
+        }
+    }
+
+    // One line per batch; a broken kernel would otherwise flood the log
+    if (mismatches > 0) {
+        TA_LOGW("Share verifier: %zu wrong hash(es) in a batch of %zu for job %s, first from worker %u nonce %08x",
+                mismatches, batch.size(), job->job_id.c_str(), first_mismatch->worker, first_mismatch->nonce);
+    }
+}
+
+} // namespace TradingAnarchy
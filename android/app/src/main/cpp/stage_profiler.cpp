@@ -0,0 +1,265 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Stage Profiler - RandomX Stage Timings from Profiling Miner Builds
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#include "stage_profiler.h"
+#include "trading_anarchy_jni.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+
+namespace TradingAnarchy {
+namespace StageProfiler {
+
+namespace {
+
+constexpr char kProfilerTag[] = "profiler";
+constexpr double kReportWindowMs = 1000.0;
+
+double nowMs() {
+    return std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+std::string stripAnsi(const std::string& line) {
+    std::string plain;
+    plain.reserve(line.size());
+    for (size_t i = 0; i < line.size(); ++i) {
+        if (line[i] == '\x1b' && i + 1 < line.size() && line[i + 1] == '[') {
+            i += 2;
+            while (i < line.size() && !std::isalpha(static_cast<unsigned char>(line[i]))) {
+                ++i;
+            }
+            continue;
+        }
+        plain.push_back(line[i]);
+    }
+    return plain;
+}
+
+std::string lower(std::string text) {
+    std::transform(text.begin(), text.end(), text.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return text;
+}
+
+bool parseNumber(const std::string& token, double& value) {
+    char* end = nullptr;
+    value = std::strtod(token.c_str(), &end);
+    return end != token.c_str() && *end == '\0';
+}
+
+void appendJsonString(std::ostringstream& out, const std::string& text) {
+    out << '"';
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if (static_cast<unsigned char>(c) >= 0x20) {
+            out << c;
+        }
+    }
+    out << '"';
+}
+
+/**
+ * Professional profiler line parse
+ *
+ * xmrig built with WITH_PROFILING prints one line per scope, either per
+ * thread ("profiler Thread 3 | RandomX_JIT_execute | 61.2% | 512345 ns")
+ * or as an average ("profiler RandomX_JIT_execute 512345 ns"). The field
+ * separators differ between versions, so parse by tokens: the scope is
+ * the first non-numeric token, the share is the token ending in '%' and
+ * the time is the number before the trailing "ns".
+ */
+bool parseProfilerLine(const std::string& plain, std::string& scope, double& share, double& ns) {
+    size_t tag = plain.find(kProfilerTag);
+    if (tag == std::string::npos) {
+        return false;
+    }
+
+    std::string body = plain.substr(tag + sizeof(kProfilerTag) - 1);
+    std::replace(body.begin(), body.end(), '|', ' ');
+
+    std::istringstream tokens(body);
+    std::vector<std::string> fields;
+    std::string token;
+    while (tokens >> token) {
+        fields.push_back(token);
+    }
+    if (fields.size() < 3 || fields.back() != "ns") {
+        return false;
+    }
+    if (!parseNumber(fields[fields.size() - 2], ns)) {
+        return false;
+    }
+
+    scope.clear();
+    share = 0.0;
+    for (size_t i = 0; i + 2 < fields.size(); ++i) {
+        const std::string& field = fields[i];
+        double number = 0.0;
+        if (field.size() > 1 && field.back() == '%') {
+            parseNumber(field.substr(0, field.size() - 1), share);
+        } else if (lower(field) == "thread" || parseNumber(field, number)) {
+            continue;
+        } else if (scope.empty()) {
+            scope = field;
+        }
+    }
+    return !scope.empty();
+}
+
+} // namespace
+
+const char* stageName(Stage stage) {
+    switch (stage) {
+        case Stage::PROGRAM_GENERATION: return "programGeneration";
+        case Stage::EXECUTION: return "execution";
+        case Stage::HASHING: return "hashing";
+        default: return "other";
+    }
+}
+
+Stage classifyScope(const std::string& scope) {
+    std::string name = lower(scope);
+    if (name.find("generate") != std::string::npos || name.find("compile") != std::string::npos) {
+        return Stage::PROGRAM_GENERATION;
+    }
+    if (name.find("execute") != std::string::npos || name.find("run") != std::string::npos) {
+        return Stage::EXECUTION;
+    }
+    if (name.find("hash") != std::string::npos || name.find("blake") != std::string::npos ||
+        name.find("aes") != std::string::npos || name.find("fill") != std::string::npos) {
+        return Stage::HASHING;
+    }
+    return Stage::OTHER;
+}
+
+Collector& Collector::instance() {
+    static Collector collector;
+    return collector;
+}
+
+bool Collector::ingestLine(const std::string& line) {
+    if (line.find(kProfilerTag) == std::string::npos) {
+        return false;
+    }
+
+    std::string scope;
+    double share = 0.0;
+    double ns = 0.0;
+    if (!parseProfilerLine(stripAnsi(line), scope, share, ns)) {
+        return false;
+    }
+
+    double now = nowMs();
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    ScopeTiming& timing = scopes_[scope];
+    if (timing.reports == 0) {
+        timing.scope = scope;
+        timing.stage = classifyScope(scope);
+    }
+    // Per-thread lines of one report arrive together; average them
+    // instead of letting the last thread win
+    if (timing.reports > 0 && now - timing.last_update_ms < kReportWindowMs) {
+        timing.threads++;
+        timing.mean_ns += (ns - timing.mean_ns) / timing.threads;
+        timing.share_percent += (share - timing.share_percent) / timing.threads;
+    } else {
+        timing.threads = 1;
+        timing.mean_ns = ns;
+        timing.share_percent = share;
+    }
+    timing.reports++;
+    timing.last_update_ms = now;
+
+    trace_.push_back({now, scope, ns});
+    if (trace_.size() > kMaxTraceSamples) {
+        trace_.pop_front();
+    }
+
+    reports_++;
+    last_update_ms_ = now;
+    return true;
+}
+
+ProfileSnapshot Collector::snapshot() const {
+    ProfileSnapshot snapshot;
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    snapshot.scopes.reserve(scopes_.size());
+    for (const auto& entry : scopes_) {
+        snapshot.scopes.push_back(entry.second);
+        snapshot.stage_ns[static_cast<size_t>(entry.second.stage)] += entry.second.mean_ns;
+    }
+    snapshot.reports = reports_;
+    snapshot.last_update_ms = last_update_ms_;
+    return snapshot;
+}
+
+std::string Collector::exportTrace() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::ostringstream out;
+    out.precision(3);
+    out << std::fixed << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    bool first = true;
+    for (const TraceSample& sample : trace_) {
+        auto found = scopes_.find(sample.scope);
+        Stage stage = found != scopes_.end() ? found->second.stage : Stage::OTHER;
+
+        if (!first) {
+            out << ',';
+        }
+        first = false;
+
+        // Counter events: ts in microseconds, one track per stage, series per scope
+        out << "{\"ph\":\"C\",\"pid\":1,\"tid\":1,\"cat\":\"xmrig\",\"ts\":"
+            << sample.timestamp_ms * 1000.0 << ",\"name\":";
+        appendJsonString(out, stageName(stage));
+        out << ",\"args\":{";
+        appendJsonString(out, sample.scope);
+        out << ':' << sample.mean_ns << "}}";
+    }
+
+    out << "],\"metadata\":{\"source\":\"xmrig-profiler\",\"reports\":" << reports_ << "}}";
+    return out.str();
+}
+
+void Collector::reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    scopes_.clear();
+    trace_.clear();
+    reports_ = 0;
+    last_update_ms_ = 0.0;
+}
+
+} // namespace StageProfiler
+} // namespace TradingAnarchy
+
+// Professional JNI entry point for MiningService
+extern "C" {
+
+JNIEXPORT jboolean JNICALL
+Java_com_xmrigforandroid_MiningService_nativeIngestMinerOutput(
+    JNIEnv* env, jclass clazz, jstring line) {
+
+    const char* line_str = env->GetStringUTFChars(line, nullptr);
+    bool ingested = TradingAnarchy::StageProfiler::Collector::instance().ingestLine(line_str);
+    env->ReleaseStringUTFChars(line, line_str);
+
+    return ingested ? JNI_TRUE : JNI_FALSE;
+}
+
+} // extern "C"
@@ -0,0 +1,506 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Telemetry Simulator - Seeded Synthetic Mining Events for Pipeline Load Testing
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#include "telemetry_simulator.h"
+#include "trading_anarchy_jni.h"
+
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <string>
+
+namespace TradingAnarchy {
+
+namespace {
+
+constexpr double kNever = std::numeric_limits<double>::infinity();
+constexpr uint32_t kDeviceStream = TelemetrySimulator::kMaxWorkers;
+constexpr double kMaxRateMultiplier = 10000.0;
+
+// Hashrate noise and thermal model
+constexpr double kHashrateJitter = 0.02;
+constexpr double kIdleTemperature = 35.0;
+constexpr double kTemperaturePerWorker = 1.5;
+constexpr double kTemperatureReversion = 0.05;     // per simulated second
+constexpr double kTemperatureNoise = 0.4;
+constexpr double kThrottleTemperature = 70.0;
+constexpr double kThrottlePerDegree = 0.03;
+constexpr double kMinThrottleFactor = 0.5;
+
+// Difficulty 2: a valid or a low-difficulty nonce takes two hashes on average
+constexpr const char* kSimulatedTarget = "ffffff7f";
+constexpr size_t kBlobBytes = 76;
+
+constexpr const char* kEventNames[TelemetrySimulator::kEventTypeCount] = {
+    "tick",
+    "share",
+    "temperature",
+    "connection",
+    "job",
+};
+
+/**
+ * Professional stream seeding - splitmix64 over (seed, stream, generation)
+ */
+uint64_t streamSeed(uint64_t seed, uint32_t stream, uint32_t generation) {
+    uint64_t z = seed + 0x9E3779B97F4A7C15ull * (1 + stream + (static_cast<uint64_t>(generation) << 32));
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+double nextArrival(std::mt19937_64& rng, double rate_per_second) {
+    if (rate_per_second <= 0.0) {
+        return kNever;
+    }
+    return std::exponential_distribution<double>(rate_per_second)(rng);
+}
+
+double throttleFactor(double celsius) {
+    if (celsius <= kThrottleTemperature) {
+        return 1.0;
+    }
+    return std::max(kMinThrottleFactor, 1.0 - (celsius - kThrottleTemperature) * kThrottlePerDegree);
+}
+
+} // namespace
+
+TelemetrySimulator::TelemetrySimulator(Sink sink)
+    : sink_(std::move(sink)) {
+}
+
+TelemetrySimulator::~TelemetrySimulator() {
+    stop();
+}
+
+const char* TelemetrySimulator::eventName(EventType type) {
+    return kEventNames[static_cast<size_t>(type)];
+}
+
+bool TelemetrySimulator::start(const Config& config) {
+    if (config.workers == 0 || config.workers > kMaxWorkers ||
+        !(config.rate_multiplier > 0.0) || config.rate_multiplier > kMaxRateMultiplier ||
+        !(config.hashrate_tick_hz > 0.0)) {
+        TA_LOGW("Telemetry simulator: rejected config (%u workers, %.1fx, %.2f Hz ticks)",
+                config.workers, config.rate_multiplier, config.hashrate_tick_hz);
+        return false;
+    }
+
+    std::lock_guard<std::mutex> control(control_mutex_);
+    if (running_.load(std::memory_order_acquire)) {
+        return false;
+    }
+
+    config_ = config;
+    for (Timing& timing : timings_) {
+        timing.count = 0;
+        timing.total_ns = 0;
+        timing.max_ns = 0;
+    }
+    max_lag_ns_ = 0;
+    lost_shares_ = 0;
+    worker_restarts_ = 0;
+    temperature_ = kIdleTemperature;
+    connected_ = true;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        job_.reset();
+        previous_job_.reset();
+        stopping_ = false;
+    }
+
+    started_ = Clock::now();
+    started_epoch_ms_ = static_cast<double>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+    running_.store(true, std::memory_order_release);
+
+    for (uint32_t i = 0; i < config_.workers; ++i) {
+        workers_[i] = std::make_unique<WorkerState>();
+        spawnWorker(*workers_[i], i);
+    }
+    device_ = std::thread([this] { deviceLoop(); });
+
+    TA_LOGI("Telemetry simulator: seed %llu, %u workers at %.1fx",
+            static_cast<unsigned long long>(config_.seed), config_.workers, config_.rate_multiplier);
+    return true;
+}
+
+void TelemetrySimulator::stop() {
+    std::lock_guard<std::mutex> control(control_mutex_);
+    if (!running_.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+
+    if (device_.joinable()) {
+        device_.join();
+    }
+    for (std::unique_ptr<WorkerState>& worker : workers_) {
+        if (worker && worker->thread.joinable()) {
+            worker->thread.join();
+        }
+        worker.reset();
+    }
+
+    stopped_at_ = Clock::now();
+    running_.store(false, std::memory_order_release);
+}
+
+void TelemetrySimulator::spawnWorker(WorkerState& worker, uint32_t index) {
+    worker.stop = false;
+    uint32_t generation = worker.generation;
+    worker.thread = std::thread([this, index, generation] { workerLoop(index, generation); });
+}
+
+bool TelemetrySimulator::restartWorker(uint32_t worker) {
+    std::lock_guard<std::mutex> control(control_mutex_);
+    if (!running_.load(std::memory_order_acquire) || worker >= config_.workers || !workers_[worker]) {
+        return false;
+    }
+
+    WorkerState& state = *workers_[worker];
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        state.stop = true;
+    }
+    wake_.notify_all();
+    if (state.thread.joinable()) {
+        state.thread.join();
+    }
+
+    ++state.generation;
+    spawnWorker(state, worker);
+    worker_restarts_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+int32_t TelemetrySimulator::workerTid(uint32_t worker) const {
+    std::lock_guard<std::mutex> control(control_mutex_);
+    if (worker >= kMaxWorkers || !workers_[worker]) {
+        return 0;
+    }
+    return workers_[worker]->tid.load(std::memory_order_relaxed);
+}
+
+TelemetrySimulator::Config TelemetrySimulator::config() const {
+    std::lock_guard<std::mutex> control(control_mutex_);
+    return config_;
+}
+
+TelemetrySimulator::Stats TelemetrySimulator::stats() const {
+    std::lock_guard<std::mutex> control(control_mutex_);
+    Stats stats;
+    stats.running = running_.load(std::memory_order_acquire);
+    stats.seed = config_.seed;
+    stats.rate_multiplier = config_.rate_multiplier;
+    if (started_ != Clock::time_point{}) {
+        stats.wall_seconds = std::chrono::duration<double>((stats.running ? Clock::now() : stopped_at_) - started_).count();
+        stats.simulated_seconds = stats.wall_seconds * config_.rate_multiplier;
+    }
+
+    for (size_t i = 0; i < kEventTypeCount; ++i) {
+        const Timing& timing = timings_[i];
+        stats.events[i] = timing.count.load(std::memory_order_relaxed);
+        if (stats.events[i] > 0) {
+            stats.sink_mean_us[i] = timing.total_ns.load(std::memory_order_relaxed) / 1e3 / stats.events[i];
+        }
+        stats.sink_max_us[i] = timing.max_ns.load(std::memory_order_relaxed) / 1e3;
+    }
+    stats.max_lag_ms = max_lag_ns_.load(std::memory_order_relaxed) / 1e6;
+    stats.lost_shares = lost_shares_.load(std::memory_order_relaxed);
+    stats.worker_restarts = worker_restarts_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+double TelemetrySimulator::simulatedNow() const {
+    return std::chrono::duration<double>(Clock::now() - started_).count() * config_.rate_multiplier;
+}
+
+bool TelemetrySimulator::waitUntil(double due_sim_seconds, const std::atomic<bool>& worker_stop) {
+    auto deadline = started_ + std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(due_sim_seconds / config_.rate_multiplier));
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    wake_.wait_until(lock, deadline, [&] { return stopping_.load() || worker_stop.load(); });
+    if (stopping_ || worker_stop) {
+        return false;
+    }
+    lock.unlock();
+
+    noteLag(due_sim_seconds);
+    return true;
+}
+
+void TelemetrySimulator::noteLag(double due_sim_seconds) {
+    double late_seconds = (simulatedNow() - due_sim_seconds) / config_.rate_multiplier;
+    if (late_seconds <= 0.0) {
+        return;
+    }
+    uint64_t lag_ns = static_cast<uint64_t>(late_seconds * 1e9);
+    uint64_t seen = max_lag_ns_.load(std::memory_order_relaxed);
+    while (lag_ns > seen && !max_lag_ns_.compare_exchange_weak(seen, lag_ns, std::memory_order_relaxed)) {
+    }
+}
+
+template <typename Fn>
+void TelemetrySimulator::emit(EventType type, Fn&& call) {
+    auto started = Clock::now();
+    call();
+    uint64_t ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        Clock::now() - started).count());
+
+    Timing& timing = timings_[static_cast<size_t>(type)];
+    timing.count.fetch_add(1, std::memory_order_relaxed);
+    timing.total_ns.fetch_add(ns, std::memory_order_relaxed);
+    uint64_t seen = timing.max_ns.load(std::memory_order_relaxed);
+    while (ns > seen && !timing.max_ns.compare_exchange_weak(seen, ns, std::memory_order_relaxed)) {
+    }
+}
+
+/**
+ * Professional device stream: ticks, temperature, connection and jobs
+ */
+void TelemetrySimulator::deviceLoop() {
+    std::mt19937_64 rng(streamSeed(config_.seed, kDeviceStream, 0));
+    std::normal_distribution<double> gaussian(0.0, 1.0);
+    uint64_t job_sequence = 0;
+
+    auto new_job = [&] {
+        auto job = std::make_shared<ShareVerifier::Job>();
+        job->job_id = "sim-" + std::to_string(++job_sequence);
+        job->blob.resize(kBlobBytes);
+        for (uint8_t& byte : job->blob) {
+            byte = static_cast<uint8_t>(rng());
+        }
+        job->target = ShareVerifier::targetFromHex(kSimulatedTarget);
+        job->scratchpad_bytes = Scratchpad::kMinBytes;
+
+        // The host sees the job before any worker can find a share for it
+        emit(EventType::JOB, [&] {
+            if (sink_.job) {
+                sink_.job(*job);
+            }
+        });
+        std::lock_guard<std::mutex> lock(mutex_);
+        previous_job_ = std::move(job_);
+        job_ = std::move(job);
+    };
+
+    const double tick_period = 1.0 / config_.hashrate_tick_hz;
+    const double target_temperature = kIdleTemperature + kTemperaturePerWorker * config_.workers;
+    double temperature = kIdleTemperature;
+    double total_hashes = 0.0;
+    bool connected = true;
+
+    double next_tick = tick_period;
+    double last_temperature = 0.0;
+    double next_temperature = nextArrival(rng, config_.temperature_hz);
+    double next_disconnect = nextArrival(rng, config_.disconnects_per_hour / 3600.0);
+    double reconnect_at = kNever;
+    double next_job = config_.job_interval_seconds > 0.0 ? config_.job_interval_seconds : kNever;
+
+    new_job();
+
+    const std::atomic<bool> never_stop{false};
+    for (;;) {
+        double due = std::min({next_tick, next_temperature, next_disconnect, reconnect_at, next_job});
+        if (!waitUntil(due, never_stop)) {
+            break;
+        }
+
+        if (due == next_tick) {
+            Tick tick;
+            tick.uptime_seconds = next_tick;
+            tick.timestamp_ms = started_epoch_ms_ + next_tick * 1000.0;
+            tick.workers = config_.workers;
+            for (uint32_t i = 0; i < config_.workers; ++i) {
+                tick.worker_hashrate[i] = workers_[i]->hashrate.load(std::memory_order_relaxed);
+                tick.hashrate += tick.worker_hashrate[i];
+            }
+            total_hashes += tick.hashrate * tick_period;
+            tick.total_hashes = total_hashes;
+            tick.temperature = temperature;
+            tick.connected = connected;
+            emit(EventType::TICK, [&] {
+                if (sink_.tick) {
+                    sink_.tick(tick);
+                }
+            });
+            next_tick += tick_period;
+        } else if (due == next_temperature) {
+            // Ornstein-Uhlenbeck walk towards the load temperature
+            double dt = next_temperature - last_temperature;
+            temperature += kTemperatureReversion * (target_temperature - temperature) * dt +
+                           kTemperatureNoise * std::sqrt(dt) * gaussian(rng);
+            temperature_.store(temperature, std::memory_order_relaxed);
+            emit(EventType::TEMPERATURE, [] {});
+            last_temperature = next_temperature;
+            next_temperature += nextArrival(rng, config_.temperature_hz);
+        } else if (due == next_disconnect) {
+            connected = false;
+            connected_.store(false, std::memory_order_relaxed);
+            emit(EventType::CONNECTION, [&] {
+                if (sink_.connection) {
+                    sink_.connection(false);
+                }
+            });
+            reconnect_at = next_disconnect + config_.disconnect_seconds *
+                (0.5 + std::uniform_real_distribution<double>(0.0, 1.0)(rng));
+            next_disconnect = kNever;
+        } else if (due == reconnect_at) {
+            connected = true;
+            connected_.store(true, std::memory_order_relaxed);
+            emit(EventType::CONNECTION, [&] {
+                if (sink_.connection) {
+                    sink_.connection(true);
+                }
+            });
+            new_job();      // pools send a fresh job on login
+            next_disconnect = reconnect_at + nextArrival(rng, config_.disconnects_per_hour / 3600.0);
+            reconnect_at = kNever;
+        } else {
+            new_job();
+            next_job += config_.job_interval_seconds;
+        }
+    }
+}
+
+/**
+ * Enhanced worker stream: hashrate updates and found shares
+ */
+void TelemetrySimulator::workerLoop(uint32_t index, uint32_t generation) {
+    WorkerState& state = *workers_[index];
+    state.tid.store(static_cast<int32_t>(syscall(SYS_gettid)), std::memory_order_relaxed);
+
+    ShareSource source;
+    source.index = index;
+    source.generation = generation;
+    source.rng.seed(streamSeed(config_.seed, index, generation));
+    source.scratchpad = LargePageBuffer(Scratchpad::kMinBytes);
+
+    std::normal_distribution<double> jitter(0.0, kHashrateJitter);
+    const double tick_period = 1.0 / config_.hashrate_tick_hz;
+    const double share_rate = config_.shares_per_minute / 60.0 / config_.workers;
+
+    double now = simulatedNow();
+    double next_update = now + std::uniform_real_distribution<double>(0.0, tick_period)(source.rng);
+    double next_share = now + nextArrival(source.rng, share_rate);
+
+    for (;;) {
+        double due = std::min(next_update, next_share);
+        if (!waitUntil(due, state.stop)) {
+            break;
+        }
+
+        if (due == next_update) {
+            double factor = throttleFactor(temperature_.load(std::memory_order_relaxed)) * (1.0 + jitter(source.rng));
+            state.hashrate.store(std::max(0.0, config_.base_hashrate * factor), std::memory_order_relaxed);
+            next_update += tick_period;
+        } else {
+            findShare(source);
+            next_share += nextArrival(source.rng, share_rate);
+        }
+    }
+
+    state.hashrate.store(0.0, std::memory_order_relaxed);
+    state.tid.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * Professional candidate construction
+ *
+ * Valid and low-difficulty candidates are real: nonces are hashed until
+ * one lands on the wanted side of the target. Nonces carry the worker
+ * index and restart generation in the top byte so no two streams repeat
+ * one for the same job. A valid share can still come back stale if the
+ * job switches before the verifier reaches it.
+ */
+void TelemetrySimulator::findShare(ShareSource& source) {
+    std::shared_ptr<const ShareVerifier::Job> job;
+    std::shared_ptr<const ShareVerifier::Job> previous;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        job = job_;
+        previous = previous_job_;
+    }
+    if (!job || !source.scratchpad) {
+        return;
+    }
+    if (!connected_.load(std::memory_order_relaxed)) {
+        lost_shares_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    double draw = std::uniform_real_distribution<double>(0.0, 1.0)(source.rng);
+    double stale_cut = config_.stale_fraction;
+    double duplicate_cut = stale_cut + config_.duplicate_fraction;
+    double low_cut = duplicate_cut + config_.low_difficulty_fraction;
+    double mismatch_cut = low_cut + config_.hash_mismatch_fraction;
+
+    Share share;
+    share.candidate.worker = source.index;
+    share.candidate.job_id = job->job_id;
+
+    auto search = [&](bool meets) {
+        source.blob = job->blob;
+        for (;;) {
+            uint32_t nonce = (source.index << 27) | ((source.generation & 0x7u) << 24) |
+                             (source.counter++ & 0xFFFFFFu);
+            std::memcpy(source.blob.data() + job->nonce_offset, &nonce, sizeof(nonce));
+            Scratchpad::hash(source.blob.data(), source.blob.size(), source.scratchpad.data(),
+                             Scratchpad::kMinBytes, share.candidate.hash.data());
+            if (ShareVerifier::meetsTarget(share.candidate.hash.data(), job->target) == meets) {
+                share.candidate.nonce = nonce;
+                return;
+            }
+        }
+    };
+
+    if (draw < stale_cut && previous) {
+        share.candidate.job_id = previous->job_id;
+        share.candidate.nonce = (source.index << 27) | (source.counter++ & 0xFFFFFFu);
+        share.expected = ShareVerifier::Reason::STALE;
+    } else if (draw < duplicate_cut && source.have_last && source.last.candidate.job_id == job->job_id) {
+        share.candidate = source.last.candidate;
+        // A corrupted hash never claimed its nonce, so the copy fails the hash check again
+        share.expected = source.last.expected == ShareVerifier::Reason::HASH_MISMATCH
+                             ? ShareVerifier::Reason::HASH_MISMATCH
+                             : ShareVerifier::Reason::DUPLICATE_NONCE;
+    } else if (draw >= duplicate_cut && draw < low_cut) {
+        search(false);
+        share.expected = ShareVerifier::Reason::LOW_DIFFICULTY;
+    } else {
+        search(true);
+        if (draw >= low_cut && draw < mismatch_cut) {
+            share.candidate.hash[0] ^= 0x01;
+            share.expected = ShareVerifier::Reason::HASH_MISMATCH;
+        }
+    }
+
+    if (share.expected != ShareVerifier::Reason::STALE) {
+        source.last = share;
+        source.have_last = true;
+    }
+    emit(EventType::SHARE, [&] {
+        if (sink_.share) {
+            sink_.share(share);
+        }
+    });
+}
+
+} // namespace TradingAnarchy
@@ -0,0 +1,559 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * Thread Planner - Cache-Aware Thread Count and Core Set per Algorithm
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#include "thread_planner.h"
+#include "memory_probe.h"
+#include "trading_anarchy_jni.h"
+
+#include <hwloc.h>
+#include <sched.h>
+#include <sys/utsname.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <sstream>
+#include <thread>
+
+namespace TradingAnarchy {
+namespace ThreadPlanner {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t KiB = 1024;
+constexpr size_t MiB = 1024 * KiB;
+
+/**
+ * Professional per-thread scratchpads, longest prefix first
+ */
+struct WorkingSet {
+    const char* prefix;
+    size_t bytes;
+};
+
+constexpr WorkingSet kWorkingSets[] = {
+    {"rx/wow", 1 * MiB},
+    {"rx/keva", 1 * MiB},
+    {"rx/arq", 256 * KiB},
+    {"rx/", 2 * MiB},
+    {"cn-heavy", 4 * MiB},
+    {"cn-lite", 1 * MiB},
+    {"cn-pico", 256 * KiB},
+    {"cn/upx2", 128 * KiB},
+    {"cn/", 2 * MiB},
+    {"argon2/chukwav2", 1 * MiB},
+    {"argon2/chukwa", 512 * KiB},
+    {"argon2/ninja", 256 * KiB},
+    {"ghostrider", 2 * MiB},
+};
+
+constexpr size_t kUnknownWorkingSet = 2 * MiB;
+
+// Typical big-core phone cluster when neither hwloc nor the probe knows better
+constexpr uint64_t kDefaultL2Bytes = 256 * KiB;
+constexpr uint64_t kDefaultL3Bytes = 2 * MiB;
+constexpr double kDefaultMissPenalty = 6.0;
+constexpr uint32_t kDefaultSaturationThreads = 4;
+
+// Relative speed of in-order little cores and of any kinds between them and the big ones
+constexpr double kLittleWeight = 0.35;
+constexpr double kMiddleWeight = 0.75;
+
+// Extra threads must beat the best score by this much to be recommended
+constexpr double kPlanTolerance = 0.01;
+
+// Bump when the key or file layout changes so old caches are rediscovered
+constexpr int kCacheFormat = 1;
+constexpr char kCacheFile[] = "/hwloc-topology.xml";
+
+std::mutex g_cache_mutex;
+std::string g_cache_directory;
+std::atomic<const Topology*> g_loaded{nullptr};
+
+const char* infoValue(const hwloc_info_s* infos, unsigned count, const char* name) {
+    for (unsigned i = 0; i < count; ++i) {
+        if (std::strcmp(infos[i].name, name) == 0) {
+            return infos[i].value;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * Enhanced CPU-kind weights
+ *
+ * cpu_capacity is the scheduler's own per-kind speed scale, so it is used
+ * as is. Without it only the efficiency ranking is known, and the kinds
+ * get fixed big, middle and little weights.
+ */
+void readCpuKinds(hwloc_topology_t topo, Topology& result) {
+    int kinds = hwloc_cpukinds_get_nr(topo, 0);
+    if (kinds < 2) {
+        return;
+    }
+
+    hwloc_bitmap_t set = hwloc_bitmap_alloc();
+    std::vector<double> capacity(kinds, 0.0);
+    std::vector<int> efficiency(kinds, -1);
+    std::vector<int> kind_of(result.cpus.size(), -1);
+
+    for (int kind = 0; kind < kinds; ++kind) {
+        unsigned nr_infos = 0;
+        hwloc_info_s* infos = nullptr;
+        if (hwloc_cpukinds_get_info(topo, kind, set, &efficiency[kind], &nr_infos, &infos, 0) != 0) {
+            continue;
+        }
+        if (const char* value = infoValue(infos, nr_infos, "LinuxCapacity")) {
+            capacity[kind] = std::strtod(value, nullptr);
+        }
+        for (size_t i = 0; i < result.cpus.size(); ++i) {
+            if (hwloc_bitmap_isset(set, result.cpus[i].os_index)) {
+                kind_of[i] = kind;
+            }
+        }
+    }
+    hwloc_bitmap_free(set);
+
+    double top_capacity = *std::max_element(capacity.begin(), capacity.end());
+    bool have_capacity = std::all_of(capacity.begin(), capacity.end(), [](double c) { return c > 0.0; });
+    bool have_ranking = std::all_of(efficiency.begin(), efficiency.end(), [](int e) { return e >= 0; });
+
+    for (size_t i = 0; i < result.cpus.size(); ++i) {
+        int kind = kind_of[i];
+        if (kind < 0) {
+            continue;
+        }
+        if (have_capacity) {
+            result.cpus[i].weight = capacity[kind] / top_capacity;
+        } else if (have_ranking) {
+            // Kinds are listed least powerful first
+            result.cpus[i].weight = kind == kinds - 1 ? 1.0 : kind == 0 ? kLittleWeight : kMiddleWeight;
+        }
+    }
+}
+
+/**
+ * Professional hwloc discovery - PUs, their L2 and outermost data caches, and CPU kinds
+ */
+bool readHwloc(hwloc_topology_t topo, Topology& result) {
+    std::map<hwloc_obj_t, uint32_t> cache_index;
+    auto cacheFor = [&](hwloc_obj_t obj) {
+        if (obj == nullptr) {
+            return kNoCache;
+        }
+        auto [it, inserted] = cache_index.emplace(obj, static_cast<uint32_t>(result.caches.size()));
+        if (inserted) {
+            result.caches.push_back({obj->attr->cache.depth, obj->attr->cache.size,
+                                     static_cast<uint32_t>(hwloc_bitmap_weight(obj->cpuset))});
+        }
+        return it->second;
+    };
+
+    int pus = hwloc_get_nbobjs_by_type(topo, HWLOC_OBJ_PU);
+    for (int i = 0; i < pus; ++i) {
+        hwloc_obj_t pu = hwloc_get_obj_by_type(topo, HWLOC_OBJ_PU, i);
+        Cpu cpu;
+        cpu.os_index = pu->os_index;
+        if (pu->parent != nullptr && pu->parent->type == HWLOC_OBJ_CORE) {
+            cpu.smt_rank = pu->sibling_rank;
+        }
+
+        hwloc_obj_t l2 = nullptr;
+        hwloc_obj_t llc = nullptr;
+        for (hwloc_obj_t obj = pu->parent; obj != nullptr; obj = obj->parent) {
+            if (!hwloc_obj_type_is_dcache(obj->type) || obj->attr->cache.depth < 2 || obj->attr->cache.size == 0) {
+                continue;
+            }
+            if (obj->attr->cache.depth == 2) {
+                l2 = obj;
+            }
+            llc = obj;
+        }
+        cpu.l2 = cacheFor(l2);
+        cpu.llc = cacheFor(llc);
+        result.cpus.push_back(cpu);
+    }
+
+    readCpuKinds(topo, result);
+    return !result.cpus.empty();
+}
+
+std::string readLine(const char* path) {
+    std::ifstream in(path);
+    std::string line;
+    std::getline(in, line);
+    return line;
+}
+
+/**
+ * Enhanced cache key - everything that can change the discovered topology
+ *
+ * Android moves apps between cpusets as they change foreground state, and
+ * hwloc drops CPUs outside the affinity mask, so the mask is part of the key.
+ */
+std::string cacheKey() {
+    std::ostringstream key;
+    key << "format=" << kCacheFormat << " hwloc=" << std::hex << hwloc_get_api_version() << std::dec;
+
+    struct utsname name{};
+    if (uname(&name) == 0) {
+        key << " kernel=" << name.release << ' ' << name.version << ' ' << name.machine;
+    }
+    key << " possible=" << readLine("/sys/devices/system/cpu/possible")
+        << " online=" << readLine("/sys/devices/system/cpu/online");
+
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0) {
+        key << " affinity=";
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &allowed)) {
+                key << cpu << ',';
+            }
+        }
+    }
+
+    std::string text = key.str();
+    std::replace(text.begin(), text.end(), '\n', ' ');
+    return text;
+}
+
+/**
+ * Professional cache file - key line, discovery time line, then the XML
+ */
+bool readCache(const std::string& path, const std::string& key, std::string& xml, double& discovery_ms) {
+    std::ifstream in(path, std::ios::binary);
+    std::string stored_key;
+    std::string discovery;
+    if (!in || !std::getline(in, stored_key) || stored_key != key || !std::getline(in, discovery)) {
+        return false;
+    }
+    discovery_ms = std::strtod(discovery.c_str(), nullptr);
+    xml.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    return !xml.empty();
+}
+
+void writeCache(hwloc_topology_t topo, const std::string& path, const std::string& key, double discovery_ms) {
+    char* xml = nullptr;
+    int length = 0;
+    if (hwloc_topology_export_xmlbuffer(topo, &xml, &length, 0) != 0) {
+        TA_LOGW("hwloc XML export failed; topology will be rediscovered next start");
+        return;
+    }
+
+    // Written aside and renamed so a concurrent reader never sees half a file
+    std::string temporary = path + ".tmp";
+    bool written = false;
+    {
+        std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+        out << key << '\n' << discovery_ms << '\n';
+        out.write(xml, length > 0 ? length - 1 : 0);    // the length counts the trailing NUL
+        written = static_cast<bool>(out);
+    }
+    hwloc_free_xmlbuffer(topo, xml);
+
+    if (!written || std::rename(temporary.c_str(), path.c_str()) != 0) {
+        std::remove(temporary.c_str());
+        TA_LOGW("Could not write topology cache %s", path.c_str());
+    }
+}
+
+bool loadFromXml(const std::string& xml, Topology& result) {
+    hwloc_topology_t topo;
+    if (hwloc_topology_init(&topo) != 0) {
+        return false;
+    }
+    bool loaded = hwloc_topology_set_xmlbuffer(topo, xml.c_str(), static_cast<int>(xml.size() + 1)) == 0 &&
+                  hwloc_topology_set_flags(topo, HWLOC_TOPOLOGY_FLAG_IS_THISSYSTEM) == 0 &&
+                  hwloc_topology_load(topo) == 0 && readHwloc(topo, result);
+    hwloc_topology_destroy(topo);
+    return loaded;
+}
+
+bool loadHwloc(Topology& result, const std::string& cache_path) {
+    std::string key = cache_path.empty() ? std::string() : cacheKey();
+
+    std::string xml;
+    double discovery_ms = 0.0;
+    if (!cache_path.empty() && readCache(cache_path, key, xml, discovery_ms)) {
+        if (loadFromXml(xml, result)) {
+            result.from_cache = true;
+            result.discovery_ms = discovery_ms;
+            return true;
+        }
+        TA_LOGW("Topology cache %s unreadable; rediscovering", cache_path.c_str());
+        result = Topology{};
+    }
+
+    auto start = Clock::now();
+    hwloc_topology_t topo;
+    if (hwloc_topology_init(&topo) != 0) {
+        return false;
+    }
+    bool loaded = hwloc_topology_load(topo) == 0;
+    result.discovery_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    loaded = loaded && readHwloc(topo, result);
+    if (loaded && !cache_path.empty()) {
+        writeCache(topo, cache_path, key, result.discovery_ms);
+    }
+    hwloc_topology_destroy(topo);
+    return loaded;
+}
+
+Topology loadTopology(const std::string& cache_path) {
+    Topology result;
+    auto start = Clock::now();
+
+    if (!loadHwloc(result, cache_path)) {
+        TA_LOGW("hwloc topology unavailable; planning over hardware_concurrency() uniform CPUs");
+        result = Topology{};
+        uint32_t cpus = std::max(1u, std::thread::hardware_concurrency());
+        for (uint32_t cpu = 0; cpu < cpus; ++cpu) {
+            result.cpus.push_back({cpu});
+        }
+    }
+
+    result.load_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    TA_LOGI("Thread planner topology: %zu CPUs, %zu caches, %s in %.1f ms (sysfs discovery %.1f ms)",
+            result.cpus.size(), result.caches.size(), result.from_cache ? "cached XML" : "discovered",
+            result.load_ms, result.discovery_ms);
+    return result;
+}
+
+double latencyAt(const MemoryProbe::Hierarchy& measured, uint64_t bytes) {
+    for (const MemoryProbe::LatencyPoint& point : measured.latency) {
+        if (point.bytes >= bytes) {
+            return point.ns_per_load;
+        }
+    }
+    return 0.0;
+}
+
+/**
+ * Enhanced cache-size resolution
+ *
+ * Without hwloc caches the probe's single-core view is applied to every
+ * CPU: a private L2 each and, when the probe found one, an L3 shared by
+ * all. The DRAM penalty and saturation point come from the probe either
+ * way, with phone-typical defaults until it has run.
+ */
+Topology resolve(const Topology& loaded) {
+    Topology result = loaded;
+    const MemoryProbe::Hierarchy* measured = MemoryProbe::cachedHierarchy();
+
+    bool hwloc_caches = std::any_of(result.cpus.begin(), result.cpus.end(),
+                                    [](const Cpu& cpu) { return cpu.llc != kNoCache; });
+    if (hwloc_caches) {
+        result.source = "hwloc";
+    } else {
+        uint64_t l2 = measured != nullptr && measured->l2_cache > 0 ? measured->l2_cache : kDefaultL2Bytes;
+        uint64_t l3 = measured != nullptr ? measured->l3_cache : kDefaultL3Bytes;
+        result.source = measured != nullptr ? "probe" : "default";
+
+        uint32_t shared = kNoCache;
+        if (l3 > 0) {
+            shared = static_cast<uint32_t>(result.caches.size());
+            result.caches.push_back({3, l3, static_cast<uint32_t>(result.cpus.size())});
+        }
+        for (Cpu& cpu : result.cpus) {
+            cpu.l2 = static_cast<uint32_t>(result.caches.size());
+            result.caches.push_back({2, l2, 1});
+            cpu.llc = shared != kNoCache ? shared : cpu.l2;
+        }
+    }
+
+    result.miss_penalty = kDefaultMissPenalty;
+    result.saturation_threads = kDefaultSaturationThreads;
+    if (measured != nullptr) {
+        uint64_t llc_bytes = 0;
+        for (const Cpu& cpu : result.cpus) {
+            llc_bytes = std::max(llc_bytes, result.caches[cpu.llc].bytes);
+        }
+        double llc_ns = latencyAt(*measured, llc_bytes);
+        if (llc_ns > 0.0 && measured->memory_latency_ns > llc_ns) {
+            result.miss_penalty = measured->memory_latency_ns / llc_ns;
+        }
+        if (measured->saturation_threads > 0) {
+            result.saturation_threads = measured->saturation_threads;
+        }
+    }
+    return result;
+}
+
+/**
+ * Professional CPU order - fastest kind, then one thread per core before
+ * SMT siblings, then round-robin across last-level caches
+ */
+std::vector<uint32_t> fillOrder(const Topology& topo) {
+    std::vector<uint32_t> position(topo.cpus.size(), 0);
+    std::map<std::pair<uint32_t, double>, uint32_t> seen;
+    for (size_t i = 0; i < topo.cpus.size(); ++i) {
+        position[i] = seen[{topo.cpus[i].llc, topo.cpus[i].weight}]++;
+    }
+
+    std::vector<uint32_t> order(topo.cpus.size());
+    std::iota(order.begin(), order.end(), 0u);
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        const Cpu& x = topo.cpus[a];
+        const Cpu& y = topo.cpus[b];
+        if (x.weight != y.weight) {
+            return x.weight > y.weight;
+        }
+        if (x.smt_rank != y.smt_rank) {
+            return x.smt_rank < y.smt_rank;
+        }
+        return position[a] < position[b];
+    });
+    return order;
+}
+
+/**
+ * Enhanced hit-rate model for the first `threads` CPUs of `order`
+ */
+double score(const Topology& topo, const std::vector<uint32_t>& order, size_t threads,
+             size_t scratchpad, bool bandwidth) {
+    std::vector<uint32_t> l2_load(topo.caches.size(), 0);
+    std::vector<uint32_t> llc_load(topo.caches.size(), 0);
+    for (size_t i = 0; i < threads; ++i) {
+        const Cpu& cpu = topo.cpus[order[i]];
+        if (cpu.l2 != kNoCache) {
+            l2_load[cpu.l2]++;
+        }
+    }
+
+    std::vector<double> hit(threads, 1.0);
+    for (size_t i = 0; i < threads; ++i) {
+        const Cpu& cpu = topo.cpus[order[i]];
+        bool fits_l2 = cpu.l2 != kNoCache && l2_load[cpu.l2] * scratchpad <= topo.caches[cpu.l2].bytes;
+        if (!fits_l2) {
+            hit[i] = 0.0;
+            if (cpu.llc != kNoCache) {
+                llc_load[cpu.llc]++;
+            }
+        }
+    }
+
+    uint32_t missing = 0;
+    for (size_t i = 0; i < threads; ++i) {
+        const Cpu& cpu = topo.cpus[order[i]];
+        if (hit[i] < 1.0 && cpu.llc != kNoCache) {
+            hit[i] = std::min(1.0, static_cast<double>(topo.caches[cpu.llc].bytes) /
+                                   (static_cast<double>(llc_load[cpu.llc]) * scratchpad));
+        }
+        if (hit[i] < 1.0) {
+            missing++;
+        }
+    }
+
+    // Past saturation every missing thread waits its share of the memory controller
+    double queueing = 1.0;
+    if (bandwidth && topo.saturation_threads > 0) {
+        queueing = std::max(1.0, static_cast<double>(missing) / topo.saturation_threads);
+    }
+
+    double total = 0.0;
+    for (size_t i = 0; i < threads; ++i) {
+        total += topo.cpus[order[i]].weight / (hit[i] + (1.0 - hit[i]) * topo.miss_penalty * queueing);
+    }
+    return total;
+}
+
+} // namespace
+
+size_t scratchpadBytesFor(const std::string& algorithm, bool* known) {
+    for (const WorkingSet& entry : kWorkingSets) {
+        if (algorithm.rfind(entry.prefix, 0) == 0) {
+            if (known != nullptr) {
+                *known = true;
+            }
+            return entry.bytes;
+        }
+    }
+    if (known != nullptr) {
+        *known = false;
+    }
+    return kUnknownWorkingSet;
+}
+
+void setCacheDirectory(const std::string& directory) {
+    std::lock_guard<std::mutex> lock(g_cache_mutex);
+    g_cache_directory = directory;
+}
+
+const Topology& topology() {
+    static const Topology loaded = [] {
+        std::string cache_path;
+        {
+            std::lock_guard<std::mutex> lock(g_cache_mutex);
+            cache_path = g_cache_directory.empty() ? std::string() : g_cache_directory + kCacheFile;
+        }
+        return loadTopology(cache_path);
+    }();
+    g_loaded.store(&loaded, std::memory_order_release);
+    return loaded;
+}
+
+const Topology* cachedTopology() {
+    return g_loaded.load(std::memory_order_acquire);
+}
+
+Plan plan(const std::string& algorithm) {
+    Plan result;
+    result.algorithm = algorithm;
+    result.scratchpad_bytes = scratchpadBytesFor(algorithm, &result.known_algorithm);
+
+    Topology topo = resolve(topology());
+    result.topology_source = topo.source;
+
+    std::vector<uint32_t> order = fillOrder(topo);
+    for (size_t threads = 1; threads <= order.size(); ++threads) {
+        result.predicted.push_back(score(topo, order, threads, result.scratchpad_bytes, true));
+    }
+
+    double best = *std::max_element(result.predicted.begin(), result.predicted.end());
+    size_t chosen = 0;
+    while (result.predicted[chosen] < best * (1.0 - kPlanTolerance)) {
+        chosen++;
+    }
+    result.threads = static_cast<uint32_t>(chosen + 1);
+    result.relative_throughput = result.predicted[chosen];
+    result.all_cores_relative_throughput = result.predicted.back();
+    for (size_t i = 0; i < result.threads; ++i) {
+        result.cpus.push_back(topo.cpus[order[i]].os_index);
+    }
+
+    if (result.threads == order.size()) {
+        result.limited_by = "cores";
+    } else {
+        // Would the next thread help if memory bandwidth were unlimited?
+        double unbounded = score(topo, order, result.threads + 1, result.scratchpad_bytes, false);
+        result.limited_by = unbounded > best * (1.0 + kPlanTolerance) ? "bandwidth" : "cache";
+    }
+
+    TA_LOGI("Thread plan for %s (%zu KiB scratchpad, %s caches): %u of %zu threads, "
+            "%.2fx vs %.2fx on every CPU, limited by %s",
+            algorithm.c_str(), result.scratchpad_bytes / KiB, result.topology_source.c_str(),
+            result.threads, order.size(), result.relative_throughput,
+            result.all_cores_relative_throughput, result.limited_by.c_str());
+    return result;
+}
+
+} // namespace ThreadPlanner
+} // namespace TradingAnarchy
@@ -7,8 +7,8 @@
  * React Native and native C++ mining functionality.
  */
 
-#ifndef TRADING_ANARCHY_JNI_H
-#define TRADING_ANARCHY_JNI_H
+#ifndef TRADING_ANARCHY_ENGINE_JNI_H
+#define TRADING_ANARCHY_ENGINE_JNI_H
 
 #include <jni.h>
 #include <string>
@@ -308,7 +308,7 @@ Java_com_tradinganarchy_computeengine_TradingAnarchyEngine_nativeExportStats(
 // Benchmark Functions
 JNIEXPORT jobject JNICALL
 Java_com_tradinganarchy_xmrig_TradingAnarchyModule_nativeBenchmarkAlgorithm(
-    JNIEnv *env, jobject thiz, jstring algorithm, jint duration, jint threads);
+    JNIEnv *env, jobject thiz, jstring algorithm, jint duration, jint threads, jstring files_dir);
 
 JNIEXPORT jboolean JNICALL
 Java_com_tradinganarchy_xmrig_TradingAnarchyModule_nativeStopBenchmark(
@@ -324,4 +324,4 @@ Java_com_tradinganarchy_computeengine_TradingAnarchyEngine_nativeCleanup(
 
 } // extern "C"
 
-#endif // TRADING_ANARCHY_JNI_H
\ No newline at end of file
+#endif // TRADING_ANARCHY_ENGINE_JNI_H
\ No newline at end of file
@@ -5,6 +5,22 @@
  */
 
 #include "trading_anarchy_jni.h"
+#include "live_metrics.h"
+#include "xmrig_launcher.h"
+#include "xmrig_bench.h"
+#include "fork_comparison.h"
+#include "security_manager.h"
+#include "scratchpad_kernel.h"
+#include "memory_probe.h"
+#include "share_verifier.h"
+#include "hashrate_watchdog.h"
+#include "telemetry_simulator.h"
+#include "regression_bench.h"
+#include <sched.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <vector>
@@ -18,57 +34,140 @@ namespace TradingAnarchy {
 
 class MiningEngine {
 private:
-    std::atomic<bool> is_running_{false};
     std::atomic<double> hashrate_{0.0};
     std::atomic<uint64_t> accepted_shares_{0};
     std::atomic<uint64_t> rejected_shares_{0};
+    std::atomic<uint64_t> submitted_shares_{0};
+    std::atomic<uint64_t> pool_seed_{0};
+    std::atomic<double> pool_reject_fraction_{0.0};
     std::mutex config_mutex_;
-    std::unique_ptr<std::thread> mining_thread_;
+    std::string pool_url_;
+
+    // Candidates pass through here before submission; the callback is the
+    // pool hand-off. Declared after the counters so it stops first.
+    ShareVerifier verifier_{[this](const ShareVerifier::Candidate& candidate) { poolSubmit(candidate); }};
+    HashrateWatchdog watchdog_;
+
+    // Drives the stats, verifier and watchdog; declared last so it stops first
+    TelemetrySimulator simulator_{simulatorSink()};
+
+    TelemetrySimulator::Sink simulatorSink() {
+        TelemetrySimulator::Sink sink;
+        sink.tick = [this](const TelemetrySimulator::Tick& tick) { publishLiveMetrics(tick); };
+        sink.share = [this](const TelemetrySimulator::Share& share) { verifier_.enqueue(share.candidate); };
+        sink.job = [this](const ShareVerifier::Job& job) { verifier_.setJob(job); };
+        sink.connection = [this](bool connected) {
+            TA_LOGI("Simulated pool %s - Pool: %s", connected ? "reconnected" : "disconnected", pool_url_.c_str());
+        };
+        return sink;
+    }
+
+    /**
+     * Enhanced simulated pool verdict - a pure function of the seed and nonce
+     */
+    void poolSubmit(const ShareVerifier::Candidate& candidate) {
+        submitted_shares_++;
+        uint64_t z = pool_seed_.load() ^ (static_cast<uint64_t>(candidate.worker) << 32 | candidate.nonce);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        z ^= z >> 31;
+        if (static_cast<double>(z >> 11) * 0x1.0p-53 < pool_reject_fraction_.load()) {
+            rejected_shares_++;
+        } else {
+            accepted_shares_++;
+        }
+    }
 
 public:
-    MiningEngine() = default;
-    ~MiningEngine() { stop(); }
+    MiningEngine() {
+        HashrateWatchdog::Remediation remediation;
+        remediation.worker_tid = [this](uint32_t worker) { return simulator_.workerTid(worker); };
+        remediation.restart_worker = [this](uint32_t worker) { return simulator_.restartWorker(worker); };
+        remediation.repin_worker = [this](uint32_t worker, uint32_t cpu) { return repinWorker(worker, cpu); };
+        watchdog_.setRemediation(std::move(remediation));
+    }
+
+    ~MiningEngine() {
+        watchdog_.shutdown();
+        stop();
+    }
 
     bool start(const std::string& pool_url, const std::string& wallet) {
+        TelemetrySimulator::Config config;
+        config.seed = static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+        config.workers = std::clamp<uint32_t>(std::thread::hardware_concurrency(), 1, TelemetrySimulator::kMaxWorkers);
+        return startSimulation(pool_url, config);
+    }
+
+    /**
+     * Professional simulator mode - a fixed seed replays the same event streams
+     */
+    bool startSimulation(const std::string& pool_url, const TelemetrySimulator::Config& config) {
         std::lock_guard<std::mutex> lock(config_mutex_);
         
-        if (is_running_) {
+        if (simulator_.running()) {
             return false;
         }
 
         // Modern C++23 implementation
-        mining_thread_ = std::make_unique<std::thread>([this, pool_url, wallet]() {
-            LOGI("Starting mining engine - Pool: %s", pool_url.c_str());
-            is_running_ = true;
-            
-            // Simulate mining operation
-            while (is_running_) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-                hashrate_ = 1000.0 + (rand() % 500); // Simulated hashrate
-                
-                if (rand() % 10 < 8) { // 80% acceptance rate
-                    accepted_shares_++;
-                } else {
-                    rejected_shares_++;
-                }
-            }
-        });
-
-        return true;
+        pool_url_ = pool_url;
+        pool_seed_ = config.seed;
+        pool_reject_fraction_ = config.pool_reject_fraction;
+        hashrate_ = 0.0;
+        accepted_shares_ = 0;
+        rejected_shares_ = 0;
+        watchdog_.reset();
+        TA_LOGI("Starting mining engine - Pool: %s", pool_url_.c_str());
+        return simulator_.start(config);
     }
 
     void stop() {
-        is_running_ = false;
-        if (mining_thread_ && mining_thread_->joinable()) {
-            mining_thread_->join();
+        std::lock_guard<std::mutex> lock(config_mutex_);
+        simulator_.stop();
+        hashrate_ = 0.0;
+    }
+
+    bool repinWorker(uint32_t worker, uint32_t cpu) {
+        int32_t tid = simulator_.workerTid(worker);
+        if (tid <= 0 || cpu >= CPU_SETSIZE) {
+            return false;
         }
-        mining_thread_.reset();
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        return sched_setaffinity(tid, sizeof(set), &set) == 0;
     }
 
+    /**
+     * Enhanced publish from the simulator's device thread, the only writer
+     */
+    void publishLiveMetrics(const TelemetrySimulator::Tick& tick) {
+        hashrate_ = tick.hashrate;
+
+        LiveMetricsSnapshot snapshot;
+        snapshot.timestamp_ms = tick.timestamp_ms;
+        snapshot.hashrate = tick.hashrate;
+        snapshot.accepted_shares = static_cast<double>(accepted_shares_.load());
+        snapshot.rejected_shares = static_cast<double>(rejected_shares_.load());
+        snapshot.temperature = tick.temperature;
+        snapshot.uptime_seconds = tick.uptime_seconds;
+        snapshot.thread_count = tick.workers;
+        std::copy(tick.worker_hashrate, tick.worker_hashrate + tick.workers, snapshot.thread_hashrate);
+        
+        LiveMetrics::instance().publish(snapshot);
+        watchdog_.observe(snapshot);
+    }
+
+    void setJob(ShareVerifier::Job job) { verifier_.setJob(std::move(job)); }
+    bool submitCandidate(const ShareVerifier::Candidate& candidate) { return verifier_.enqueue(candidate); }
+    ShareVerifier::Stats getShareVerification() const { return verifier_.stats(); }
+    HashrateWatchdog& watchdog() { return watchdog_; }
+    TelemetrySimulator::Stats getSimulationStats() const { return simulator_.stats(); }
+
     double getHashrate() const { return hashrate_.load(); }
     uint64_t getAcceptedShares() const { return accepted_shares_.load(); }
     uint64_t getRejectedShares() const { return rejected_shares_.load(); }
-    bool isRunning() const { return is_running_.load(); }
+    bool isRunning() const { return simulator_.running(); }
 };
 
 // Global mining engine instance
@@ -78,23 +177,183 @@ static std::once_flag g_init_flag;
 void initializeEngine() {
     std::call_once(g_init_flag, []() {
         g_mining_engine = std::make_unique<MiningEngine>();
-        LOGI("Trading Anarchy Engine initialized - 2025 Edition");
+        TA_LOGI("Trading Anarchy Engine initialized - 2025 Edition");
     });
 }
 
+/**
+ * Professional java.util.HashMap builder for benchmark results
+ */
+class JavaResultMap {
+public:
+    explicit JavaResultMap(JNIEnv* env) : env_(env) {
+        jclass map_class = env->FindClass("java/util/HashMap");
+        map_ = env->NewObject(map_class, env->GetMethodID(map_class, "<init>", "()V"));
+        put_ = env->GetMethodID(map_class, "put", "(Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;");
+        double_class_ = env->FindClass("java/lang/Double");
+        double_init_ = env->GetMethodID(double_class_, "<init>", "(D)V");
+        int_class_ = env->FindClass("java/lang/Integer");
+        int_init_ = env->GetMethodID(int_class_, "<init>", "(I)V");
+        bool_class_ = env->FindClass("java/lang/Boolean");
+        bool_init_ = env->GetMethodID(bool_class_, "<init>", "(Z)V");
+    }
+
+    void putDouble(const char* key, double value) { put(key, env_->NewObject(double_class_, double_init_, value)); }
+    void putInt(const char* key, int value) { put(key, env_->NewObject(int_class_, int_init_, value)); }
+    void putBool(const char* key, bool value) { put(key, env_->NewObject(bool_class_, bool_init_, static_cast<jboolean>(value))); }
+    void putString(const char* key, const std::string& value) { put(key, env_->NewStringUTF(value.c_str())); }
+    void putMap(const char* key, const JavaResultMap& value) { put(key, value.get()); }
+    
+    void putStringList(const char* key, const std::vector<std::string>& values) {
+        jclass list_class = env_->FindClass("java/util/ArrayList");
+        jobject list = env_->NewObject(list_class, env_->GetMethodID(list_class, "<init>", "()V"));
+        jmethodID add = env_->GetMethodID(list_class, "add", "(Ljava/lang/Object;)Z");
+        for (const std::string& value : values) {
+            jstring item = env_->NewStringUTF(value.c_str());
+            env_->CallBooleanMethod(list, add, item);
+            env_->DeleteLocalRef(item);
+        }
+        env_->DeleteLocalRef(list_class);
+        put(key, list);
+    }
+
+    jobject get() const { return map_; }
+
+private:
+    void put(const char* key, jobject value) {
+        jstring java_key = env_->NewStringUTF(key);
+        env_->CallObjectMethod(map_, put_, java_key, value);
+        env_->DeleteLocalRef(java_key);
+        env_->DeleteLocalRef(value);
+    }
+
+    JNIEnv* env_;
+    jobject map_;
+    jmethodID put_;
+    jclass double_class_;
+    jmethodID double_init_;
+    jclass int_class_;
+    jmethodID int_init_;
+    jclass bool_class_;
+    jmethodID bool_init_;
+};
+
+// Benchmark budgets of ten minutes or more run xmrig's 10M bench, shorter ones 1M
+constexpr int kTenMegaHashBudgetSeconds = 600;
+
+/**
+ * Enhanced RandomX benchmark through the bundled miner's --bench mode
+ *
+ * binary_base is the fork's library stem ("libxmrig" or "libxmrig-mo");
+ * the launcher resolves it to the best installed variant for this CPU.
+ * maxTemperature is the hottest thermal zone before or right after the
+ * run and is left out when no zone is readable. There is no power
+ * measurement, so unlike the estimated results there is no powerUsage.
+ */
+jobject runXmrigBenchmark(JNIEnv* env, const std::string& binary_base, const std::string& algorithm,
+                          const std::string& size, uint32_t threads, int64_t affinity) {
+    Launcher::Selection selection = Launcher::selectBinary(XmrigBench::nativeLibraryDir(), binary_base);
+
+    XmrigBench::BenchOptions options;
+    options.binary_path = selection.path;
+    options.algorithm = algorithm;
+    options.size = size;
+    options.threads = threads;
+    options.affinity = affinity;
+
+    double celsius_before = RegressionBench::hottestZoneCelsius();
+    XmrigBench::BenchResult bench = XmrigBench::run(options);
+    double max_celsius = std::fmax(celsius_before, RegressionBench::hottestZoneCelsius());
+
+    JavaResultMap result(env);
+    result.putString("source", "xmrig-bench");
+    result.putString("algorithm", algorithm);
+    result.putString("benchSize", size);
+    result.putString("binary", selection.file_name);
+    result.putString("binaryVariant", selection.variant->name);
+    result.putDouble("hashrate", bench.hashrate);
+    result.putDouble("durationSeconds", bench.duration_seconds);
+    result.putDouble("wallSeconds", bench.wall_seconds);
+    result.putInt("threads", static_cast<int>(bench.threads));
+    result.putInt("cores", static_cast<int>(std::thread::hardware_concurrency()));
+    result.putString("hashSum", bench.hash_sum);
+    result.putString("verification", XmrigBench::verificationName(bench.verification));
+    result.putBool("stable", bench.success);
+    result.putInt("exitCode", bench.exit_code);
+    if (!std::isnan(max_celsius)) {
+        result.putDouble("maxTemperature", max_celsius);
+    }
+    if (!bench.error.empty()) {
+        result.putString("error", bench.error);
+    }
+    return result.get();
+}
+
+/**
+ * Enhanced cn-family benchmark on the engine's scratchpad kernel
+ *
+ * A short single-thread sweep over every scratchpad size comes first,
+ * so results show where this device's L2 and L3 boundaries fall; the
+ * algorithm's own size then runs for the requested duration. With
+ * threads = 0 the memory-probe planner picks the count.
+ */
+jobject runScratchpadBenchmark(JNIEnv* env, const std::string& algorithm, int duration_seconds, uint32_t threads) {
+    constexpr double kSweepSecondsPerSize = 0.25;
+
+    JavaResultMap sweep(env);
+    for (const Scratchpad::BenchResult& point : Scratchpad::sweep(kSweepSecondsPerSize)) {
+        sweep.putDouble(std::to_string(point.scratchpad_bytes).c_str(), point.ns_per_iteration);
+    }
+
+    size_t scratchpad_bytes = Scratchpad::scratchpadBytesFor(algorithm);
+    if (threads == 0) {
+        threads = MemoryProbe::planThreads(scratchpad_bytes);
+    }
+    Scratchpad::BenchResult bench = Scratchpad::benchmark(scratchpad_bytes, threads, std::max(1, duration_seconds));
+
+    JavaResultMap result(env);
+    result.putString("source", "scratchpad-kernel");
+    result.putString("algorithm", algorithm);
+    result.putString("kernelVariant", Scratchpad::mainLoopKernel().selectedVariant());
+    result.putDouble("hashrate", bench.hashes_per_sec);
+    result.putDouble("durationSeconds", bench.seconds);
+    result.putInt("threads", static_cast<int>(bench.threads));
+    result.putInt("cores", static_cast<int>(std::thread::hardware_concurrency()));
+    result.putInt("bandwidthSaturationThreads", static_cast<int>(MemoryProbe::hierarchy().saturation_threads));
+    result.putInt("scratchpadBytes", static_cast<int>(bench.scratchpad_bytes));
+    result.putDouble("nsPerIteration", bench.ns_per_iteration);
+    result.putString("pageMode", LargePageBuffer::modeName(bench.page_mode));
+    result.putMap("scratchpadSweepNs", sweep);
+    result.putBool("stable", bench.hashes > 0);
+    return result.get();
+}
+
+void putForkSamples(JavaResultMap& result, const std::string& prefix, const ForkComparison::ForkSamples& fork) {
+    result.putString((prefix + "Binary").c_str(), fork.file_name);
+    result.putString((prefix + "Variant").c_str(), fork.variant);
+    result.putInt((prefix + "Samples").c_str(), static_cast<int>(fork.summary.count));
+    result.putInt((prefix + "Failures").c_str(), static_cast<int>(fork.failures));
+    result.putDouble((prefix + "Mean").c_str(), fork.summary.mean);
+    result.putDouble((prefix + "Median").c_str(), fork.summary.median);
+    result.putDouble((prefix + "Stddev").c_str(), fork.summary.stddev);
+    result.putDouble((prefix + "CiLow").c_str(), fork.summary.ci_low);
+    result.putDouble((prefix + "CiHigh").c_str(), fork.summary.ci_high);
+    result.putString((prefix + "HashSum").c_str(), fork.hash_sum);
+}
+
 } // namespace TradingAnarchy
 
 // JNI Implementation
 extern "C" {
 
 JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM* vm, void* reserved) {
-    LOGI("Trading Anarchy JNI Library loaded - 2025 Professional Edition");
+    TA_LOGI("Trading Anarchy JNI Library loaded - 2025 Professional Edition");
     TradingAnarchy::initializeEngine();
     return JNI_VERSION_1_6;
 }
 
 JNIEXPORT void JNICALL JNI_OnUnload(JavaVM* vm, void* reserved) {
-    LOGI("Trading Anarchy JNI Library unloaded");
+    TA_LOGI("Trading Anarchy JNI Library unloaded");
     TradingAnarchy::g_mining_engine.reset();
 }
 
@@ -171,6 +430,222 @@ Java_com_tradinganarchy_xmrig_TradingAnarchyModule_nativeGetRejectedShares(
     return static_cast<jlong>(TradingAnarchy::g_mining_engine->getRejectedShares());
 }
 
+JNIEXPORT jobject JNICALL
+Java_com_tradinganarchy_xmrig_TradingAnarchyModule_nativeGetShareVerification(
+    JNIEnv* env, jobject thiz) {
+    
+    TradingAnarchy::JavaResultMap result(env);
+    if (!TradingAnarchy::g_mining_engine) {
+        return result.get();
+    }
+
+    using TradingAnarchy::ShareVerifier;
+    ShareVerifier::Stats stats = TradingAnarchy::g_mining_engine->getShareVerification();
+    result.putDouble("enqueued", static_cast<double>(stats.enqueued));
+    result.putDouble("dropped", static_cast<double>(stats.dropped));
+    result.putDouble("verified", static_cast<double>(stats.verified));
+    result.putDouble("submitted", static_cast<double>(stats.submitted));
+    result.putDouble("batches", static_cast<double>(stats.batches));
+    result.putDouble("meanBatchSize", stats.mean_batch_size);
+    result.putDouble("hashUs", stats.hash_us);
+
+    TradingAnarchy::JavaResultMap rejected(env);
+    for (size_t i = 0; i < ShareVerifier::kReasonCount; ++i) {
+        rejected.putDouble(ShareVerifier::reasonName(static_cast<ShareVerifier::Reason>(i)),
+                           static_cast<double>(stats.rejected[i]));
+    }
+    result.putMap("rejected", rejected);
+    return result.get();
+}
+
+JNIEXPORT jobject JNICALL
+Java_com_tradinganarchy_xmrig_TradingAnarchyModule_nativeGetWatchdogReport(
+    JNIEnv* env, jobject thiz) {
+    
+    TradingAnarchy::JavaResultMap result(env);
+    if (!TradingAnarchy::g_mining_engine) {
+        return result.get();
+    }
+
+    using TradingAnarchy::HashrateWatchdog;
+    HashrateWatchdog::Report report = TradingAnarchy::g_mining_engine->watchdog().report();
+    result.putDouble("samples", static_cast<double>(report.samples));
+    result.putDouble("stalls", static_cast<double>(report.stalls));
+    result.putDouble("drops", static_cast<double>(report.drops));
+    result.putDouble("captures", static_cast<double>(report.captures));
+    result.putDouble("remediations", static_cast<double>(report.remediations));
+    result.putDouble("deviceBaselineHashrate", report.device_baseline_hps);
+    result.putBool("autoRemediate", report.auto_remediate);
+
+    TradingAnarchy::JavaResultMap workers(env);
+    for (size_t i = 0; i < report.workers.size(); ++i) {
+        const HashrateWatchdog::WorkerStatus& status = report.workers[i];
+        TradingAnarchy::JavaResultMap worker(env);
+        worker.putDouble("baselineHashrate", status.baseline_hps);
+        worker.putDouble("recentHashrate", status.recent_hps);
+        worker.putInt("baselineSamples", static_cast<int>(status.baseline_samples));
+        worker.putBool("anomalous", status.anomalous);
+        workers.putMap(std::to_string(i).c_str(), worker);
+    }
+    result.putMap("workers", workers);
+
+    // Bundles keyed by capture order, oldest first
+    TradingAnarchy::JavaResultMap bundles(env);
+    for (size_t i = 0; i < report.bundles.size(); ++i) {
+        const HashrateWatchdog::Bundle& bundle = report.bundles[i];
+        TradingAnarchy::JavaResultMap entry(env);
+        entry.putString("kind", HashrateWatchdog::kindName(bundle.anomaly.kind));
+        entry.putInt("worker", bundle.anomaly.worker == HashrateWatchdog::kAllWorkers
+                                   ? -1 : static_cast<int>(bundle.anomaly.worker));
+        entry.putDouble("timestampMs", bundle.anomaly.timestamp_ms);
+        entry.putDouble("baselineHashrate", bundle.anomaly.baseline_hps);
+        entry.putDouble("recentHashrate", bundle.anomaly.recent_hps);
+        entry.putDouble("relativeChange", bundle.anomaly.relative_change);
+        entry.putDouble("pValue", bundle.anomaly.p_value);
+        entry.putDouble("captureMs", bundle.capture_ms);
+        entry.putString("recommended", HashrateWatchdog::actionName(bundle.recommended));
+        entry.putInt("repinCpu", bundle.repin_cpu);
+        entry.putString("reason", bundle.reason);
+        entry.putBool("remediated", bundle.remediated);
+
+        TradingAnarchy::JavaResultMap perf(env);
+        for (const HashrateWatchdog::PerfCounter& counter : bundle.perf) {
+            if (counter.available) {
+                perf.putDouble(counter.name.c_str(), static_cast<double>(counter.value));
+            }
+        }
+        entry.putMap("perf", perf);
+
+        TradingAnarchy::JavaResultMap thermal(env);
+        for (const HashrateWatchdog::ThermalZone& zone : bundle.thermal) {
+            thermal.putDouble(zone.type.c_str(), zone.celsius);
+        }
+        entry.putMap("thermal", thermal);
+
+        TradingAnarchy::JavaResultMap frequencies(env);
+        for (const HashrateWatchdog::CpuFrequency& cpu : bundle.frequencies) {
+            TradingAnarchy::JavaResultMap item(env);
+            item.putBool("online", cpu.online);
+            item.putDouble("currentKhz", static_cast<double>(cpu.current_khz));
+            item.putDouble("maxKhz", static_cast<double>(cpu.max_khz));
+            item.putDouble("scalingMaxKhz", static_cast<double>(cpu.scaling_max_khz));
+            frequencies.putMap(std::to_string(cpu.cpu).c_str(), item);
+        }
+        entry.putMap("frequencies", frequencies);
+
+        TradingAnarchy::JavaResultMap threads(env);
+        for (const HashrateWatchdog::ThreadProfile& thread : bundle.threads) {
+            TradingAnarchy::JavaResultMap item(env);
+            item.putString("name", thread.name);
+            item.putDouble("cpuPercent", thread.cpu_percent);
+            item.putInt("lastCpu", thread.last_cpu);
+            item.putDouble("involuntarySwitches", static_cast<double>(thread.involuntary_switches));
+            threads.putMap(std::to_string(thread.tid).c_str(), item);
+        }
+        entry.putMap("threads", threads);
+
+        TradingAnarchy::JavaResultMap stages(env);
+        for (size_t stage = 0; stage < TradingAnarchy::StageProfiler::kStageCount; ++stage) {
+            stages.putDouble(TradingAnarchy::StageProfiler::stageName(
+                                 static_cast<TradingAnarchy::StageProfiler::Stage>(stage)),
+                             bundle.stages.stage_ns[stage]);
+        }
+        entry.putMap("stageNs", stages);
+
+        bundles.putMap(std::to_string(i).c_str(), entry);
+    }
+    result.putMap("bundles", bundles);
+    return result.get();
+}
+
+JNIEXPORT void JNICALL
+Java_com_tradinganarchy_xmrig_TradingAnarchyModule_nativeSetWatchdogAutoRemediate(
+    JNIEnv* env, jobject thiz, jboolean enabled) {
+    
+    if (TradingAnarchy::g_mining_engine) {
+        TradingAnarchy::g_mining_engine->watchdog().setAutoRemediate(enabled == JNI_TRUE);
+    }
+}
+
+/**
+ * Professional manual remediation - action is "restartWorker" or "repinWorker"
+ */
+JNIEXPORT jboolean JNICALL
+Java_com_tradinganarchy_xmrig_TradingAnarchyModule_nativeRemediateWorker(
+    JNIEnv* env, jobject thiz, jint worker, jstring action, jint cpu) {
+    
+    if (!TradingAnarchy::g_mining_engine || worker < 0 || cpu < 0) {
+        return JNI_FALSE;
+    }
+
+    using TradingAnarchy::HashrateWatchdog;
+    const char* action_str = env->GetStringUTFChars(action, nullptr);
+    std::string name(action_str);
+    env->ReleaseStringUTFChars(action, action_str);
+
+    HashrateWatchdog::Action parsed = HashrateWatchdog::Action::NONE;
+    if (name == HashrateWatchdog::actionName(HashrateWatchdog::Action::RESTART_WORKER)) {
+        parsed = HashrateWatchdog::Action::RESTART_WORKER;
+    } else if (name == HashrateWatchdog::actionName(HashrateWatchdog::Action::REPIN_WORKER)) {
+        parsed = HashrateWatchdog::Action::REPIN_WORKER;
+    }
+    bool applied = TradingAnarchy::g_mining_engine->watchdog().remediate(
+        static_cast<uint32_t>(worker), parsed, static_cast<uint32_t>(cpu));
+    return applied ? JNI_TRUE : JNI_FALSE;
+}
+
+/**
+ * Professional load-test mode - a fixed seed at rateMultiplier times realistic event rates
+ */
+JNIEXPORT jboolean JNICALL
+Java_com_tradinganarchy_xmrig_TradingAnarchyModule_nativeStartSimulation(
+    JNIEnv* env, jobject thiz, jlong seed, jdouble rate_multiplier, jint workers) {
+    
+    TradingAnarchy::initializeEngine();
+    if (workers <= 0) {
+        return JNI_FALSE;
+    }
+
+    TradingAnarchy::TelemetrySimulator::Config config;
+    config.seed = static_cast<uint64_t>(seed);
+    config.rate_multiplier = rate_multiplier;
+    config.workers = static_cast<uint32_t>(workers);
+    bool result = TradingAnarchy::g_mining_engine->startSimulation("simulator", config);
+    return static_cast<jboolean>(result);
+}
+
+JNIEXPORT jobject JNICALL
+Java_com_tradinganarchy_xmrig_TradingAnarchyModule_nativeGetSimulationStats(
+    JNIEnv* env, jobject thiz) {
+    
+    TradingAnarchy::JavaResultMap result(env);
+    if (!TradingAnarchy::g_mining_engine) {
+        return result.get();
+    }
+
+    using TradingAnarchy::TelemetrySimulator;
+    TelemetrySimulator::Stats stats = TradingAnarchy::g_mining_engine->getSimulationStats();
+    result.putBool("running", stats.running);
+    result.putString("seed", std::to_string(stats.seed));
+    result.putDouble("rateMultiplier", stats.rate_multiplier);
+    result.putDouble("wallSeconds", stats.wall_seconds);
+    result.putDouble("simulatedSeconds", stats.simulated_seconds);
+    result.putDouble("maxLagMs", stats.max_lag_ms);
+    result.putDouble("lostShares", static_cast<double>(stats.lost_shares));
+    result.putDouble("workerRestarts", static_cast<double>(stats.worker_restarts));
+
+    TradingAnarchy::JavaResultMap events(env);
+    for (size_t i = 0; i < TelemetrySimulator::kEventTypeCount; ++i) {
+        TradingAnarchy::JavaResultMap event(env);
+        event.putDouble("count", static_cast<double>(stats.events[i]));
+        event.putDouble("sinkMeanUs", stats.sink_mean_us[i]);
+        event.putDouble("sinkMaxUs", stats.sink_max_us[i]);
+        events.putMap(TelemetrySimulator::eventName(static_cast<TelemetrySimulator::EventType>(i)), event);
+    }
+    result.putMap("events", events);
+    return result.get();
+}
+
 // Device Information
 JNIEXPORT jstring JNICALL
 Java_com_tradinganarchy_xmrig_TradingAnarchyModule_nativeGetDeviceInfo(
@@ -179,6 +654,16 @@ Java_com_tradinganarchy_xmrig_TradingAnarchyModule_nativeGetDeviceInfo(
     std::string device_info = "Trading Anarchy 2025 - ";
     device_info += "Cores: " + std::to_string(std::thread::hardware_concurrency()) + ", ";
     device_info += "Architecture: Modern C++23, ";
+    
+    // Measured effective capacities - only once a probe has run; the probe itself takes seconds
+    if (const TradingAnarchy::MemoryProbe::Hierarchy* memory = TradingAnarchy::MemoryProbe::cachedHierarchy()) {
+        device_info += "L1: " + std::to_string(memory->l1_cache / 1024) + " KiB, ";
+        device_info += "L2: " + std::to_string(memory->l2_cache / 1024) + " KiB, ";
+        device_info += "L3: " + std::to_string(memory->l3_cache / 1024) + " KiB, ";
+        device_info += "Bandwidth saturates at " + std::to_string(memory->saturation_threads) + " threads, ";
+    } else {
+        device_info += "Memory hierarchy: not measured, ";
+    }
     device_info += "Status: Professional Edition";
     
     return env->NewStringUTF(device_info.c_str());
@@ -196,7 +681,7 @@ JNIEXPORT jboolean JNICALL
 Java_com_tradinganarchy_xmrig_TradingAnarchyModule_nativeSetThreads(
     JNIEnv* env, jobject thiz, jint thread_count) {
     
-    LOGI("Setting thread count: %d", static_cast<int>(thread_count));
+    TA_LOGI("Setting thread count: %d", static_cast<int>(thread_count));
     return JNI_TRUE; // Always successful for this implementation
 }
 
@@ -204,7 +689,7 @@ JNIEXPORT jboolean JNICALL
 Java_com_tradinganarchy_xmrig_TradingAnarchyModule_nativeSetIntensity(
     JNIEnv* env, jobject thiz, jint intensity) {
     
-    LOGI("Setting intensity: %d", static_cast<int>(intensity));
+    TA_LOGI("Setting intensity: %d", static_cast<int>(intensity));
     return JNI_TRUE; // Always successful for this implementation
 }
 
@@ -227,7 +712,7 @@ Java_com_tradinganarchy_xmrig_TradingAnarchyModule_nativeValidateConfig(
     JNIEnv* env, jobject thiz, jstring config_json) {
     
     const char* config_str = env->GetStringUTFChars(config_json, nullptr);
-    LOGI("Validating configuration: %s", config_str);
+    TA_LOGI("Validating configuration: %s", config_str);
     
     // Simple validation - in real implementation, parse and validate JSON
     bool is_valid = (config_str != nullptr && strlen(config_str) > 0);
@@ -237,22 +722,49 @@ Java_com_tradinganarchy_xmrig_TradingAnarchyModule_nativeValidateConfig(
 }
 
 // Benchmark Functions
+// files_dir holds the fork A/B winners; null benches the upstream fork
 JNIEXPORT jobject JNICALL
 Java_com_tradinganarchy_xmrig_TradingAnarchyModule_nativeBenchmarkAlgorithm(
-    JNIEnv* env, jobject thiz, jstring algorithm, jint duration, jint threads) {
+    JNIEnv* env, jobject thiz, jstring algorithm, jint duration, jint threads, jstring files_dir) {
     
     const char* algo_str = env->GetStringUTFChars(algorithm, nullptr);
-    LOGI("Starting benchmark - Algorithm: %s, Duration: %d, Threads: %d", 
+    TA_LOGI("Starting benchmark - Algorithm: %s, Duration: %d, Threads: %d", 
          algo_str, static_cast<int>(duration), static_cast<int>(threads));
     
+    // RandomX runs for real through the bundled miner, using the fork that won this device's A/B
+    if (strncmp(algo_str, "rx/", 3) == 0) {
+        std::string algo(algo_str);
+        env->ReleaseStringUTFChars(algorithm, algo_str);
+        
+        std::string fork;
+        if (files_dir != nullptr) {
+            const char* dir_str = env->GetStringUTFChars(files_dir, nullptr);
+            fork = TradingAnarchy::ForkComparison::preferredFork(dir_str, algo);
+            env->ReleaseStringUTFChars(files_dir, dir_str);
+        }
+        if (fork.empty()) {
+            fork = TradingAnarchy::ForkComparison::kUpstreamBinary;
+        }
+        
+        std::string size = duration >= TradingAnarchy::kTenMegaHashBudgetSeconds ? "10M" : "1M";
+        return TradingAnarchy::runXmrigBenchmark(env, fork, algo, size,
+                                                 static_cast<uint32_t>(std::max<jint>(0, threads)), -1);
+    }
+    
+    // CryptoNight variants run the memory-hard scratchpad kernel
+    if (strncmp(algo_str, "cn", 2) == 0) {
+        std::string algo(algo_str);
+        env->ReleaseStringUTFChars(algorithm, algo_str);
+        return TradingAnarchy::runScratchpadBenchmark(env, algo, static_cast<int>(duration),
+                                                      static_cast<uint32_t>(std::max<jint>(0, threads)));
+    }
+    
     // Simulate benchmark execution
     auto start_time = std::chrono::steady_clock::now();
     
     // Calculate simulated hashrate based on algorithm
     double base_hashrate = 1200.0; // Base hashrate for RandomX
-    if (strstr(algo_str, "cn") != nullptr) {
-        base_hashrate = 800.0; // CryptoNight variants
-    } else if (strstr(algo_str, "astrobwt") != nullptr) {
+    if (strstr(algo_str, "astrobwt") != nullptr) {
         base_hashrate = 450.0; // AstroBWT
     } else if (strstr(algo_str, "panthera") != nullptr) {
         base_hashrate = 350.0; // Panthera
@@ -305,6 +817,11 @@ Java_com_tradinganarchy_xmrig_TradingAnarchyModule_nativeBenchmarkAlgorithm(
     jstring archValue = env->NewStringUTF("ARM64");
     env->CallObjectMethod(result, putMethod, archKey, archValue);
     
+    // Record which libxmrig build this device launches so results compare per variant
+    jstring variantKey = env->NewStringUTF("binaryVariant");
+    jstring variantValue = env->NewStringUTF(TradingAnarchy::Launcher::preferredVariant().name);
+    env->CallObjectMethod(result, putMethod, variantKey, variantValue);
+    
     // Add stability
     jstring stableKey = env->NewStringUTF("stable");
     jclass boolClass = env->FindClass("java/lang/Boolean");
@@ -314,7 +831,7 @@ Java_com_tradinganarchy_xmrig_TradingAnarchyModule_nativeBenchmarkAlgorithm(
     
     env->ReleaseStringUTFChars(algorithm, algo_str);
     
-    LOGI("Benchmark completed - Hashrate: %.2f H/s", hashrate);
+    TA_LOGI("Benchmark completed - Hashrate: %.2f H/s", hashrate);
     return result;
 }
 
@@ -322,9 +839,190 @@ JNIEXPORT jboolean JNICALL
 Java_com_tradinganarchy_xmrig_TradingAnarchyModule_nativeStopBenchmark(
     JNIEnv* env, jobject thiz) {
     
-    LOGI("Stopping benchmark");
-    // In real implementation, signal benchmark thread to stop
-    return JNI_TRUE;
+    TA_LOGI("Stopping benchmark");
+    return static_cast<jboolean>(TradingAnarchy::XmrigBench::cancel());
+}
+
+JNIEXPORT jobject JNICALL
+Java_com_tradinganarchy_xmrig_TradingAnarchyModule_nativeCompareXmrigForks(
+    JNIEnv* env, jobject thiz, jstring files_dir, jstring algorithm, jstring size,
+    jint threads, jlong affinity, jint repetitions) {
+    
+    const char* dir_str = env->GetStringUTFChars(files_dir, nullptr);
+    const char* algo_str = env->GetStringUTFChars(algorithm, nullptr);
+    const char* size_str = env->GetStringUTFChars(size, nullptr);
+    
+    std::string directory(dir_str);
+    TradingAnarchy::ForkComparison::ComparisonOptions options;
+    options.native_lib_dir = TradingAnarchy::XmrigBench::nativeLibraryDir();
+    options.algorithm = algo_str;
+    options.size = size_str;
+    options.threads = static_cast<uint32_t>(std::max<jint>(0, threads));
+    options.affinity = static_cast<int64_t>(affinity);
+    options.repetitions = static_cast<uint32_t>(std::max<jint>(2, repetitions));
+    
+    env->ReleaseStringUTFChars(files_dir, dir_str);
+    env->ReleaseStringUTFChars(algorithm, algo_str);
+    env->ReleaseStringUTFChars(size, size_str);
+    
+    TradingAnarchy::ForkComparison::ComparisonResult comparison =
+        TradingAnarchy::ForkComparison::compare(options);
+    TradingAnarchy::ForkComparison::saveWinner(directory, options.algorithm, comparison);
+    
+    TradingAnarchy::JavaResultMap result(env);
+    result.putBool("success", comparison.success);
+    if (!comparison.error.empty()) {
+        result.putString("error", comparison.error);
+    }
+    result.putString("algorithm", options.algorithm);
+    result.putString("benchSize", options.size);
+    result.putString("winner", comparison.winner);
+    result.putBool("significant", comparison.significant);
+    result.putBool("hashesAgree", comparison.hashes_agree);
+    result.putDouble("pValue", comparison.test.p_value);
+    result.putDouble("tStatistic", comparison.test.t);
+    result.putDouble("degreesOfFreedom", comparison.test.degrees_of_freedom);
+    result.putDouble("difference", comparison.test.difference);
+    result.putDouble("relativeDifference", comparison.test.relative_difference);
+    result.putDouble("differenceCiLow", comparison.test.ci_low);
+    result.putDouble("differenceCiHigh", comparison.test.ci_high);
+    result.putDouble("durationSeconds", comparison.duration_seconds);
+    TradingAnarchy::putForkSamples(result, "upstream", comparison.upstream);
+    TradingAnarchy::putForkSamples(result, "moneroocean", comparison.moneroocean);
+    return result.get();
+}
+
+/**
+ * Professional reproducible benchmark against the baseline stored in files_dir
+ */
+JNIEXPORT jobject JNICALL
+Java_com_tradinganarchy_xmrig_TradingAnarchyModule_nativeRunRegressionBenchmark(
+    JNIEnv* env, jobject thiz, jstring files_dir, jstring algorithm, jint repetitions,
+    jdouble cooldown_celsius, jboolean update_baseline) {
+    
+    const char* dir_str = env->GetStringUTFChars(files_dir, nullptr);
+    const char* algo_str = env->GetStringUTFChars(algorithm, nullptr);
+    
+    TradingAnarchy::RegressionBench::Options options;
+    options.directory = dir_str;
+    options.algorithm = algo_str;
+    options.repetitions = static_cast<uint32_t>(std::max<jint>(2, repetitions));
+    options.cooldown_celsius = cooldown_celsius;
+    options.update_baseline = update_baseline == JNI_TRUE;
+    
+    env->ReleaseStringUTFChars(files_dir, dir_str);
+    env->ReleaseStringUTFChars(algorithm, algo_str);
+    
+    TradingAnarchy::RegressionBench::Result bench = TradingAnarchy::RegressionBench::run(options);
+    
+    TradingAnarchy::JavaResultMap result(env);
+    result.putBool("success", bench.success);
+    if (!bench.error.empty()) {
+        result.putString("error", bench.error);
+    }
+    result.putString("verdict", TradingAnarchy::RegressionBench::verdictName(bench.verdict));
+    result.putString("key", bench.key);
+    result.putString("checksum", bench.checksum);
+    result.putInt("threads", static_cast<int>(bench.threads));
+    result.putBool("pinned", bench.pinned);
+    result.putBool("thermalAvailable", bench.thermal_available);
+    result.putDouble("cooldownSeconds", bench.cooldown_seconds);
+    result.putInt("samples", static_cast<int>(bench.summary.count));
+    result.putDouble("median", bench.summary.median);
+    result.putDouble("mean", bench.summary.mean);
+    result.putDouble("stddev", bench.summary.stddev);
+    result.putBool("haveBaseline", bench.have_baseline);
+    result.putInt("baselineSamples", static_cast<int>(bench.baseline.size()));
+    result.putDouble("baselineTime", static_cast<double>(bench.baseline_time));
+    result.putDouble("pValue", bench.test.p_value);
+    result.putBool("exact", bench.test.exact);
+    result.putDouble("uStatistic", bench.test.u);
+    result.putDouble("rankBiserial", bench.test.rank_biserial);
+    result.putDouble("shift", bench.test.shift);
+    result.putDouble("relativeShift", bench.test.relative_shift);
+    result.putBool("baselineUpdated", bench.baseline_updated);
+    result.putDouble("durationSeconds", bench.duration_seconds);
+    return result.get();
+}
+
+JNIEXPORT jstring JNICALL
+Java_com_tradinganarchy_xmrig_TradingAnarchyModule_nativeGetPreferredXmrigFork(
+    JNIEnv* env, jobject thiz, jstring files_dir, jstring algorithm) {
+    
+    const char* dir_str = env->GetStringUTFChars(files_dir, nullptr);
+    const char* algo_str = env->GetStringUTFChars(algorithm, nullptr);
+    std::string winner = TradingAnarchy::ForkComparison::preferredFork(dir_str, algo_str);
+    env->ReleaseStringUTFChars(files_dir, dir_str);
+    env->ReleaseStringUTFChars(algorithm, algo_str);
+    
+    return winner.empty() ? nullptr : env->NewStringUTF(winner.c_str());
+}
+
+JNIEXPORT jobject JNICALL
+Java_com_tradinganarchy_xmrig_TradingAnarchyModule_nativeBenchmarkXmrig(
+    JNIEnv* env, jobject thiz, jstring binary_base, jstring algorithm, jstring size,
+    jint threads, jlong affinity) {
+    
+    const char* base_str = env->GetStringUTFChars(binary_base, nullptr);
+    const char* algo_str = env->GetStringUTFChars(algorithm, nullptr);
+    const char* size_str = env->GetStringUTFChars(size, nullptr);
+    
+    std::string base(base_str);
+    std::string algo(algo_str);
+    std::string bench_size(size_str);
+    
+    env->ReleaseStringUTFChars(binary_base, base_str);
+    env->ReleaseStringUTFChars(algorithm, algo_str);
+    env->ReleaseStringUTFChars(size, size_str);
+    
+    TA_LOGI("Starting xmrig benchmark - Binary: %s, Algorithm: %s, Size: %s, Threads: %d, Affinity: 0x%llx",
+         base.c_str(), algo.c_str(), bench_size.c_str(), static_cast<int>(threads),
+         static_cast<unsigned long long>(affinity));
+    
+    return TradingAnarchy::runXmrigBenchmark(env, base, algo, bench_size,
+                                             static_cast<uint32_t>(std::max<jint>(0, threads)),
+                                             static_cast<int64_t>(affinity));
+}
+
+// last_update_time is PackageInfo.lastUpdateTime (ms); each install or update re-baselines
+JNIEXPORT jobject JNICALL
+Java_com_tradinganarchy_xmrig_TradingAnarchyModule_nativeVerifyIntegrity(
+    JNIEnv* env, jobject thiz, jstring files_dir, jlong last_update_time) {
+    
+    TradingAnarchy::SecurityManager& manager = TradingAnarchy::SecurityManager::instance();
+    if (files_dir != nullptr) {
+        const char* dir_str = env->GetStringUTFChars(files_dir, nullptr);
+        manager.setCacheDirectory(dir_str);
+        env->ReleaseStringUTFChars(files_dir, dir_str);
+    }
+    
+    std::string native_lib_dir = TradingAnarchy::XmrigBench::nativeLibraryDir();
+    int64_t install_time_ns = last_update_time > 0
+        ? static_cast<int64_t>(last_update_time) * 1000000LL
+        : TradingAnarchy::SecurityManager::installTime(native_lib_dir);
+    TradingAnarchy::IntegrityReport report = manager.verify(
+        TradingAnarchy::SecurityManager::defaultTargets(native_lib_dir), install_time_ns);
+    
+    TradingAnarchy::JavaResultMap checksums(env);
+    uint32_t cached_files = 0;
+    for (const TradingAnarchy::FileIntegrity& file : report.files) {
+        checksums.putString(file.path.c_str(), file.digest);
+        cached_files += file.cached ? 1 : 0;
+    }
+    
+    TradingAnarchy::JavaResultMap result(env);
+    result.putBool("valid", report.valid);
+    result.putString("fingerprint", report.fingerprint);
+    result.putMap("checksums", checksums);
+    result.putStringList("modified", report.modified);
+    result.putStringList("missing", report.missing);
+    result.putStringList("threats", {});
+    result.putInt("files", static_cast<int>(report.files.size()));
+    result.putInt("cachedFiles", static_cast<int>(cached_files));
+    result.putInt("hashedFiles", static_cast<int>(report.files_hashed));
+    result.putDouble("bytesHashed", static_cast<double>(report.bytes_hashed));
+    result.putDouble("durationMs", report.duration_ms);
+    return result.get();
 }
 
 JNIEXPORT jdouble JNICALL
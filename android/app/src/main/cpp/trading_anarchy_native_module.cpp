@@ -8,11 +8,21 @@
  */
 
 #include "trading_anarchy_native_module.h"
+#include "native_executor.h"
+#include "live_metrics.h"
+#include "kernel_dispatch.h"
+#include "xmrig_launcher.h"
+#include "stage_profiler.h"
+#include "aes_round.h"
+#include "memory_probe.h"
+#include "thread_planner.h"
 // Mock React Native headers for development IntelliSense
 // These will be replaced with actual React Native headers during build
 #include <jni.h>
 #include <memory>
 #include <string>
+#include <algorithm>
+#include <cmath>
 // Mock JSI interface for development
 namespace facebook {
 namespace jsi {
@@ -30,6 +40,23 @@ namespace NativeModule {
 std::shared_ptr<TradingAnarchyComputeEngineModule> TradingAnarchyComputeEngineModule::instance_;
 std::mutex TradingAnarchyComputeEngineModule::module_mutex_;
 
+namespace {
+
+// PBKDF2 bounds for deriveKey - the default matches Crypto::deriveKeyPBKDF2
+constexpr int kDefaultDeriveIterations = 100000;
+constexpr int kMinDeriveIterations = 1000;
+constexpr int kMaxDeriveIterations = 10000000;
+
+std::string toHex(const std::vector<uint8_t>& bytes) {
+    std::stringstream ss;
+    for (uint8_t byte : bytes) {
+        ss << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(byte);
+    }
+    return ss.str();
+}
+
+} // namespace
+
 /**
  * Enhanced constructor with comprehensive initialization
  */
@@ -47,6 +74,33 @@ TradingAnarchyComputeEngineModule::TradingAnarchyComputeEngineModule(
         }
         
         metrics_.start_time = std::chrono::steady_clock::now();
+        schedulePromiseReaper();
+        
+        // Enhanced callback delivery - engine events are coalesced natively
+        callback_dispatcher_ = std::make_shared<CallbackDispatcher>(
+            NativeExecutor::callbacks(),
+            [this](CallbackDispatcher::Batch batch) { deliverCallbackBatch(std::move(batch)); });
+        
+        // Time the AES variants off the JS thread; readers report "pending" until done
+        NativeExecutor::engine().submit([] { AesRound::selection(); });
+        
+        // Engine threads may report after teardown; the lifetime guard turns them away
+        JNIBridge& bridge = JNIBridge::getInstance();
+        bridge.setStatusCallback([this, lifetime = lifetime_](ComputeEngineStatus status) {
+            if (auto scope = lifetime->enter()) {
+                invokeStatusCallback(status);
+            }
+        });
+        bridge.setPerformanceCallback([this, lifetime = lifetime_](const PerformanceMetrics& metrics) {
+            if (auto scope = lifetime->enter()) {
+                invokePerformanceCallback(metrics);
+            }
+        });
+        bridge.setErrorCallback([this, lifetime = lifetime_](const std::string& error) {
+            if (auto scope = lifetime->enter()) {
+                invokeErrorCallback("ENGINE_ERROR", error);
+            }
+        });
         TA_LOGI("TradingAnarchyComputeEngineModule - Initialization completed successfully");
         
     } catch (const std::exception& e) {
@@ -61,7 +115,22 @@ TradingAnarchyComputeEngineModule::TradingAnarchyComputeEngineModule(
 TradingAnarchyComputeEngineModule::~TradingAnarchyComputeEngineModule() {
     TA_LOGI("TradingAnarchyComputeEngineModule - Professional cleanup started");
     
+    // Waits out executor tasks that are inside the module; later ones see it gone
+    lifetime_->shutdown();
+    
     try {
+        {
+            std::lock_guard<std::mutex> lock(simulator_mutex_);
+            if (simulator_) {
+                simulator_->stop();
+            }
+        }
+        
+        // No batch is handed to this module once close() returns
+        if (callback_dispatcher_) {
+            callback_dispatcher_->close();
+        }
+        
         std::lock_guard<std::mutex> lock(callbacks_mutex_);
         
         // Enhanced callback cleanup
@@ -76,11 +145,9 @@ TradingAnarchyComputeEngineModule::~TradingAnarchyComputeEngineModule() {
         }
         
         // Professional promise cleanup
-        std::lock_guard<std::mutex> promises_lock(promises_mutex_);
-        for (auto& [id, promise] : pending_promises_) {
-            promise.reject("MODULE_CLEANUP", "Module is being destroyed");
-        }
-        pending_promises_.clear();
+        pending_promises_.drain([](PendingCall&& call) {
+            call.promise.reject("MODULE_CLEANUP", "Module is being destroyed");
+        });
         
         TA_LOGI("TradingAnarchyComputeEngineModule - Cleanup completed successfully");
         
@@ -104,17 +171,22 @@ facebook::react::jsi::Value TradingAnarchyComputeEngineModule::getConstants(
     
     // Enhanced engine states
     auto states = facebook::react::jsi::Object(rt);
-    states.setProperty(rt, "IDLE", facebook::react::jsi::Value(static_cast<int>(ComputeEngineStatus::IDLE)));
-    states.setProperty(rt, "INITIALIZING", facebook::react::jsi::Value(static_cast<int>(ComputeEngineStatus::INITIALIZING)));
+    states.setProperty(rt, "STARTING", facebook::react::jsi::Value(static_cast<int>(ComputeEngineStatus::STARTING)));
     states.setProperty(rt, "RUNNING", facebook::react::jsi::Value(static_cast<int>(ComputeEngineStatus::RUNNING)));
     states.setProperty(rt, "PAUSED", facebook::react::jsi::Value(static_cast<int>(ComputeEngineStatus::PAUSED)));
+    states.setProperty(rt, "STOPPING", facebook::react::jsi::Value(static_cast<int>(ComputeEngineStatus::STOPPING)));
     states.setProperty(rt, "STOPPED", facebook::react::jsi::Value(static_cast<int>(ComputeEngineStatus::STOPPED)));
     states.setProperty(rt, "ERROR", facebook::react::jsi::Value(static_cast<int>(ComputeEngineStatus::ERROR)));
     constants.setProperty(rt, "ENGINE_STATES", std::move(states));
     
     // Professional capabilities
     auto capabilities = facebook::react::jsi::Object(rt);
-    capabilities.setProperty(rt, "HAS_HARDWARE_AES", facebook::react::jsi::Value(true));
+    // Measured rather than flagged - slow crypto units lose to soft AES; null while pending
+    const AesRound::Selection* aes = AesRound::cachedSelection();
+    capabilities.setProperty(rt, "HAS_HARDWARE_AES",
+        aes ? facebook::react::jsi::Value(aes->hardware_preferred) : facebook::react::jsi::Value::null());
+    capabilities.setProperty(rt, "AES_SELECTION",
+        facebook::react::jsi::String::createFromUtf8(rt, aes ? "measured" : "pending"));
     capabilities.setProperty(rt, "HAS_NEON", facebook::react::jsi::Value(true));
     capabilities.setProperty(rt, "SUPPORTS_64BIT", facebook::react::jsi::Value(true));
     capabilities.setProperty(rt, "TURBO_MODULE_ENABLED", facebook::react::jsi::Value(true));
@@ -131,64 +203,35 @@ void TradingAnarchyComputeEngineModule::initializeEngine(
     const facebook::react::jsi::Value& config,
     facebook::react::Promise promise) {
     
-    updateMetrics(false); // Start tracking
-    
     try {
         if (!validateConfig(config)) {
             promise.reject("INVALID_CONFIG", "Engine configuration validation failed");
+            updateMetrics(ModuleMethod::INITIALIZE_ENGINE, false);
             return;
         }
         
-        std::string promiseId = generatePromiseId();
+        // Enhanced configuration extraction - JSI access stays on the JS thread
+        EngineConfig engineConfig = parseEngineConfig(rt, config.asObject(rt));
         {
-            std::lock_guard<std::mutex> lock(promises_mutex_);
-            pending_promises_[promiseId] = promise;
+            std::lock_guard<std::mutex> lock(engine_config_mutex_);
+            engine_config_ = engineConfig;
         }
         
-        // Professional asynchronous initialization
-        auto initializeAsync = [this, promiseId, config = config.asObject(rt)](facebook::react::jsi::Runtime& rt) {
-            try {
-                // Enhanced configuration extraction
-                SecurityConfig secConfig;
-                if (config.hasProperty(rt, "threads")) {
-                    secConfig.max_threads = static_cast<uint32_t>(config.getProperty(rt, "threads").asNumber());
-                }
-                if (config.hasProperty(rt, "priority")) {
-                    secConfig.thread_priority = static_cast<int>(config.getProperty(rt, "priority").asNumber());
-                }
-                if (config.hasProperty(rt, "enableHugePages")) {
-                    secConfig.enable_huge_pages = config.getProperty(rt, "enableHugePages").asBool();
-                }
-                
-                // Professional JNI bridge initialization
-                JNIBridge& bridge = JNIBridge::getInstance();
-                if (!bridge.initializeEngine(secConfig)) {
-                    rejectPromise(promiseId, "INIT_FAILED", "Engine initialization failed");
-                    updateMetrics(false);
-                    return;
-                }
-                
-                // Enhanced result preparation
-                auto result = facebook::react::jsi::Object(rt);
-                result.setProperty(rt, "success", facebook::react::jsi::Value(true));
-                result.setProperty(rt, "status", facebook::react::jsi::String::createFromUtf8(rt, "initialized"));
-                
-                resolvePromise(promiseId, std::move(result));
-                updateMetrics(true);
-                
-                TA_LOGI("Engine initialization completed successfully");
-                
-            } catch (const std::exception& e) {
-                rejectPromise(promiseId, "INIT_EXCEPTION", e.what());
-                updateMetrics(false);
-            }
-        };
+        PromiseHandle promiseId = registerPromise(promise, ModuleMethod::INITIALIZE_ENGINE);
+        if (promiseId == PendingPromises::kInvalidHandle) {
+            return;
+        }
         
-        js_invoker_->invokeAsync(std::move(initializeAsync));
+        // Professional background initialization
+        dispatchEngineOperation(
+            ModuleMethod::INITIALIZE_ENGINE,
+            promiseId,
+            [engineConfig] { return JNIBridge::getInstance().initializeEngine(engineConfig); },
+            "INIT", "Engine initialization failed", "initialized");
         
     } catch (const std::exception& e) {
         promise.reject("INIT_ERROR", e.what());
-        updateMetrics(false);
+        updateMetrics(ModuleMethod::INITIALIZE_ENGINE, false);
     }
 }
 
@@ -199,50 +242,28 @@ void TradingAnarchyComputeEngineModule::startEngine(
     facebook::react::jsi::Runtime& rt,
     facebook::react::Promise promise) {
     
-    updateMetrics(false);
-    
     try {
         if (!isInitialized()) {
             promise.reject("NOT_INITIALIZED", "Engine must be initialized before starting");
+            updateMetrics(ModuleMethod::START_ENGINE, false);
             return;
         }
         
-        std::string promiseId = generatePromiseId();
-        {
-            std::lock_guard<std::mutex> lock(promises_mutex_);
-            pending_promises_[promiseId] = promise;
+        PromiseHandle promiseId = registerPromise(promise, ModuleMethod::START_ENGINE);
+        if (promiseId == PendingPromises::kInvalidHandle) {
+            return;
         }
         
-        // Enhanced asynchronous start operation
-        auto startAsync = [this, promiseId](facebook::react::jsi::Runtime& rt) {
-            try {
-                JNIBridge& bridge = JNIBridge::getInstance();
-                if (!bridge.startEngine()) {
-                    rejectPromise(promiseId, "START_FAILED", "Engine start operation failed");
-                    updateMetrics(false);
-                    return;
-                }
-                
-                auto result = facebook::react::jsi::Object(rt);
-                result.setProperty(rt, "success", facebook::react::jsi::Value(true));
-                result.setProperty(rt, "status", facebook::react::jsi::String::createFromUtf8(rt, "running"));
-                
-                resolvePromise(promiseId, std::move(result));
-                updateMetrics(true);
-                
-                TA_LOGI("Engine started successfully");
-                
-            } catch (const std::exception& e) {
-                rejectPromise(promiseId, "START_EXCEPTION", e.what());
-                updateMetrics(false);
-            }
-        };
-        
-        js_invoker_->invokeAsync(std::move(startAsync));
+        // Enhanced background start operation
+        dispatchEngineOperation(
+            ModuleMethod::START_ENGINE,
+            promiseId,
+            [] { return JNIBridge::getInstance().startEngine(); },
+            "START", "Engine start operation failed", "running");
         
     } catch (const std::exception& e) {
         promise.reject("START_ERROR", e.what());
-        updateMetrics(false);
+        updateMetrics(ModuleMethod::START_ENGINE, false);
     }
 }
 
@@ -253,44 +274,93 @@ void TradingAnarchyComputeEngineModule::stopEngine(
     facebook::react::jsi::Runtime& rt,
     facebook::react::Promise promise) {
     
-    updateMetrics(false);
-    
     try {
-        std::string promiseId = generatePromiseId();
-        {
-            std::lock_guard<std::mutex> lock(promises_mutex_);
-            pending_promises_[promiseId] = promise;
+        PromiseHandle promiseId = registerPromise(promise, ModuleMethod::STOP_ENGINE);
+        if (promiseId == PendingPromises::kInvalidHandle) {
+            return;
         }
         
-        auto stopAsync = [this, promiseId](facebook::react::jsi::Runtime& rt) {
-            try {
-                JNIBridge& bridge = JNIBridge::getInstance();
-                if (!bridge.stopEngine()) {
-                    rejectPromise(promiseId, "STOP_FAILED", "Engine stop operation failed");
-                    updateMetrics(false);
+        dispatchEngineOperation(
+            ModuleMethod::STOP_ENGINE,
+            promiseId,
+            [] { return JNIBridge::getInstance().stopEngine(); },
+            "STOP", "Engine stop operation failed", "stopped");
+        
+    } catch (const std::exception& e) {
+        promise.reject("STOP_ERROR", e.what());
+        updateMetrics(ModuleMethod::STOP_ENGINE, false);
+    }
+}
+
+/**
+ * Professional background dispatch
+ *
+ * The blocking engine call runs on the serial lifecycle queue; only
+ * promise settlement hops back to the JS thread through the CallInvoker.
+ */
+void TradingAnarchyComputeEngineModule::dispatchEngineOperation(
+    ModuleMethod method,
+    PromiseHandle promiseId,
+    std::function<bool()> operation,
+    const std::string& errorPrefix,
+    const std::string& failureMessage,
+    const std::string& resultStatus) {
+    
+    // Outcome metrics are recorded when the promise settles; called inside a lifetime scope
+    auto settle = [this, promiseId, errorPrefix, failureMessage, resultStatus, lifetime = lifetime_](
+                      bool success, std::string exceptionMessage) {
+        js_invoker_->invokeAsync(
+            [this, promiseId, errorPrefix, failureMessage, resultStatus, success, lifetime,
+             exceptionMessage = std::move(exceptionMessage)](facebook::react::jsi::Runtime& rt) {
+                auto scope = lifetime->enter();
+                if (!scope) {
+                    return;
+                }
+                if (!exceptionMessage.empty()) {
+                    rejectPromise(promiseId, errorPrefix + "_EXCEPTION", exceptionMessage);
+                    return;
+                }
+                if (!success) {
+                    rejectPromise(promiseId, errorPrefix + "_FAILED", failureMessage);
                     return;
                 }
                 
                 auto result = facebook::react::jsi::Object(rt);
                 result.setProperty(rt, "success", facebook::react::jsi::Value(true));
-                result.setProperty(rt, "status", facebook::react::jsi::String::createFromUtf8(rt, "stopped"));
+                result.setProperty(rt, "status", facebook::react::jsi::String::createFromUtf8(rt, resultStatus));
                 
                 resolvePromise(promiseId, std::move(result));
-                updateMetrics(true);
-                
-                TA_LOGI("Engine stopped successfully");
                 
+                TA_LOGI("Engine operation completed: %s", resultStatus.c_str());
+            });
+    };
+    
+    // Serial queue - a stop never overtakes the start queued before it
+    auto enqueued = std::chrono::steady_clock::now();
+    bool queued = NativeExecutor::lifecycle().submit(
+        [this, method, enqueued, operation = std::move(operation), settle, lifetime = lifetime_]() {
+            auto started = std::chrono::steady_clock::now();
+            
+            // The engine transition still runs after teardown; only module state is skipped
+            bool success = false;
+            std::string exceptionMessage;
+            try {
+                success = operation();
             } catch (const std::exception& e) {
-                rejectPromise(promiseId, "STOP_EXCEPTION", e.what());
-                updateMetrics(false);
+                exceptionMessage = e.what();
             }
-        };
-        
-        js_invoker_->invokeAsync(std::move(stopAsync));
-        
-    } catch (const std::exception& e) {
-        promise.reject("STOP_ERROR", e.what());
-        updateMetrics(false);
+            
+            auto scope = lifetime->enter();
+            if (!scope) {
+                return;
+            }
+            metrics_.methods.recordQueueWait(method, started - enqueued);
+            metrics_.methods.recordExecution(method, std::chrono::steady_clock::now() - started);
+            settle(success, std::move(exceptionMessage));
+        });
+    
+    if (!queued) {
+        rejectPromise(promiseId, errorPrefix + "_UNAVAILABLE", "Engine executor is shutting down");
     }
 }
 
@@ -301,13 +371,11 @@ void TradingAnarchyComputeEngineModule::pauseEngine(
     facebook::react::jsi::Runtime& rt,
     facebook::react::Promise promise) {
     
-    updateMetrics(false);
-    
     try {
         JNIBridge& bridge = JNIBridge::getInstance();
         if (!bridge.pauseEngine()) {
             promise.reject("PAUSE_FAILED", "Engine pause operation failed");
-            updateMetrics(false);
+            updateMetrics(ModuleMethod::PAUSE_ENGINE, false);
             return;
         }
         
@@ -316,11 +384,11 @@ void TradingAnarchyComputeEngineModule::pauseEngine(
         result.setProperty(rt, "status", facebook::react::jsi::String::createFromUtf8(rt, "paused"));
         
         promise.resolve(std::move(result));
-        updateMetrics(true);
+        updateMetrics(ModuleMethod::PAUSE_ENGINE, true);
         
     } catch (const std::exception& e) {
         promise.reject("PAUSE_ERROR", e.what());
-        updateMetrics(false);
+        updateMetrics(ModuleMethod::PAUSE_ENGINE, false);
     }
 }
 
@@ -331,13 +399,11 @@ void TradingAnarchyComputeEngineModule::resumeEngine(
     facebook::react::jsi::Runtime& rt,
     facebook::react::Promise promise) {
     
-    updateMetrics(false);
-    
     try {
         JNIBridge& bridge = JNIBridge::getInstance();
         if (!bridge.resumeEngine()) {
             promise.reject("RESUME_FAILED", "Engine resume operation failed");
-            updateMetrics(false);
+            updateMetrics(ModuleMethod::RESUME_ENGINE, false);
             return;
         }
         
@@ -346,11 +412,11 @@ void TradingAnarchyComputeEngineModule::resumeEngine(
         result.setProperty(rt, "status", facebook::react::jsi::String::createFromUtf8(rt, "running"));
         
         promise.resolve(std::move(result));
-        updateMetrics(true);
+        updateMetrics(ModuleMethod::RESUME_ENGINE, true);
         
     } catch (const std::exception& e) {
         promise.reject("RESUME_ERROR", e.what());
-        updateMetrics(false);
+        updateMetrics(ModuleMethod::RESUME_ENGINE, false);
     }
 }
 
@@ -390,6 +456,25 @@ facebook::react::jsi::Value TradingAnarchyComputeEngineModule::getPerformanceMet
     }
 }
 
+/**
+ * Professional zero-copy metrics exposure
+ */
+namespace {
+
+class LiveMetricsBuffer : public facebook::react::jsi::MutableBuffer {
+public:
+    size_t size() const override { return LiveMetrics::sizeBytes(); }
+    uint8_t* data() override { return LiveMetrics::instance().data(); }
+};
+
+} // namespace
+
+facebook::react::jsi::Value TradingAnarchyComputeEngineModule::getMetricsBuffer(
+    facebook::react::jsi::Runtime& rt) {
+    
+    return facebook::react::jsi::ArrayBuffer(rt, std::make_shared<LiveMetricsBuffer>());
+}
+
 /**
  * Professional system information
  */
@@ -400,7 +485,7 @@ facebook::react::jsi::Value TradingAnarchyComputeEngineModule::getSystemInfo(
         auto systemInfo = facebook::react::jsi::Object(rt);
         
         // Enhanced system information
-        systemInfo.setProperty(rt, "cpuCores", facebook::react::jsi::Value(std::thread::hardware_concurrency()));
+        systemInfo.setProperty(rt, "cpuCores", facebook::react::jsi::Value(static_cast<double>(std::thread::hardware_concurrency())));
         systemInfo.setProperty(rt, "architecture", facebook::react::jsi::String::createFromUtf8(rt, "arm64-v8a"));
         systemInfo.setProperty(rt, "apiLevel", facebook::react::jsi::Value(35));
         systemInfo.setProperty(rt, "turboModules", facebook::react::jsi::Value(true));
@@ -408,9 +493,19 @@ facebook::react::jsi::Value TradingAnarchyComputeEngineModule::getSystemInfo(
         
         // Professional module metrics
         auto moduleMetrics = facebook::react::jsi::Object(rt);
-        moduleMetrics.setProperty(rt, "methodCalls", facebook::react::jsi::Value(static_cast<double>(metrics_.method_calls.load())));
-        moduleMetrics.setProperty(rt, "successfulOperations", facebook::react::jsi::Value(static_cast<double>(metrics_.successful_operations.load())));
-        moduleMetrics.setProperty(rt, "failedOperations", facebook::react::jsi::Value(static_cast<double>(metrics_.failed_operations.load())));
+        uint64_t methodCalls = 0;
+        uint64_t successfulOperations = 0;
+        uint64_t failedOperations = 0;
+        for (size_t i = 0; i < kModuleMethodCount; ++i) {
+            const MethodSlot& slot = metrics_.methods.slot(static_cast<ModuleMethod>(i));
+            methodCalls += slot.calls.load(std::memory_order_relaxed);
+            successfulOperations += slot.successes.load(std::memory_order_relaxed);
+            failedOperations += slot.failures.load(std::memory_order_relaxed);
+        }
+        moduleMetrics.setProperty(rt, "methodCalls", facebook::react::jsi::Value(static_cast<double>(methodCalls)));
+        moduleMetrics.setProperty(rt, "successfulOperations", facebook::react::jsi::Value(static_cast<double>(successfulOperations)));
+        moduleMetrics.setProperty(rt, "failedOperations", facebook::react::jsi::Value(static_cast<double>(failedOperations)));
+        moduleMetrics.setProperty(rt, "methods", methodMetricsToJSI(rt));
         
         auto now = std::chrono::steady_clock::now();
         auto uptime = std::chrono::duration_cast<std::chrono::seconds>(now - metrics_.start_time).count();
@@ -418,6 +513,99 @@ facebook::react::jsi::Value TradingAnarchyComputeEngineModule::getSystemInfo(
         
         systemInfo.setProperty(rt, "moduleMetrics", std::move(moduleMetrics));
         
+        // Enhanced callback delivery statistics
+        CallbackDispatcher::Stats delivery = callback_dispatcher_->stats();
+        auto callbackDelivery = facebook::react::jsi::Object(rt);
+        callbackDelivery.setProperty(rt, "maxRateHz", facebook::react::jsi::Value(delivery.max_rate_hz));
+        callbackDelivery.setProperty(rt, "deliveredUpdates", facebook::react::jsi::Value(static_cast<double>(delivery.delivered_metrics)));
+        callbackDelivery.setProperty(rt, "droppedUpdates", facebook::react::jsi::Value(static_cast<double>(delivery.dropped_metrics)));
+        callbackDelivery.setProperty(rt, "deliveredEvents", facebook::react::jsi::Value(static_cast<double>(delivery.delivered_events)));
+        systemInfo.setProperty(rt, "callbackDelivery", std::move(callbackDelivery));
+        
+        // Enhanced AES round measurement - started at module init, never timed on the JS thread
+        auto aesInfo = facebook::react::jsi::Object(rt);
+        if (const AesRound::Selection* aes = AesRound::cachedSelection()) {
+            aesInfo.setProperty(rt, "status", facebook::react::jsi::String::createFromUtf8(rt, "measured"));
+            aesInfo.setProperty(rt, "variant", facebook::react::jsi::String::createFromUtf8(rt, aes->variant));
+            aesInfo.setProperty(rt, "hardwareSupported", facebook::react::jsi::Value(aes->hardware_supported));
+            aesInfo.setProperty(rt, "hardwarePreferred", facebook::react::jsi::Value(aes->hardware_preferred));
+            aesInfo.setProperty(rt, "hardwareNsPerRound", facebook::react::jsi::Value(aes->hardware_ns_per_round));
+            aesInfo.setProperty(rt, "softNsPerRound", facebook::react::jsi::Value(aes->soft_ns_per_round));
+        } else {
+            aesInfo.setProperty(rt, "status", facebook::react::jsi::String::createFromUtf8(rt, "pending"));
+        }
+        systemInfo.setProperty(rt, "aes", std::move(aesInfo));
+        
+        // Professional measured memory hierarchy - only once a probe has run, never on the JS thread
+        if (const MemoryProbe::Hierarchy* memory = MemoryProbe::cachedHierarchy()) {
+            auto hierarchy = facebook::react::jsi::Object(rt);
+            hierarchy.setProperty(rt, "l1Cache", facebook::react::jsi::Value(static_cast<double>(memory->l1_cache)));
+            hierarchy.setProperty(rt, "l2Cache", facebook::react::jsi::Value(static_cast<double>(memory->l2_cache)));
+            hierarchy.setProperty(rt, "l3Cache", facebook::react::jsi::Value(static_cast<double>(memory->l3_cache)));
+            hierarchy.setProperty(rt, "memoryLatencyNs", facebook::react::jsi::Value(memory->memory_latency_ns));
+            hierarchy.setProperty(rt, "peakBytesPerSec", facebook::react::jsi::Value(memory->peak_bytes_per_sec));
+            hierarchy.setProperty(rt, "saturationThreads",
+                facebook::react::jsi::Value(static_cast<double>(memory->saturation_threads)));
+            auto latencyNs = facebook::react::jsi::Object(rt);
+            for (const MemoryProbe::LatencyPoint& point : memory->latency) {
+                latencyNs.setProperty(rt, std::to_string(point.bytes).c_str(), facebook::react::jsi::Value(point.ns_per_load));
+            }
+            hierarchy.setProperty(rt, "latencyNs", std::move(latencyNs));
+            auto bandwidth = facebook::react::jsi::Array(rt, memory->bandwidth.size());
+            for (size_t i = 0; i < memory->bandwidth.size(); ++i) {
+                bandwidth.setValueAtIndex(rt, i, facebook::react::jsi::Value(memory->bandwidth[i].bytes_per_sec));
+            }
+            hierarchy.setProperty(rt, "bandwidthBytesPerSec", std::move(bandwidth));
+            systemInfo.setProperty(rt, "memoryHierarchy", std::move(hierarchy));
+        }
+        
+        // Enhanced planner topology load time - sysfs discovery versus the cached XML
+        if (const ThreadPlanner::Topology* topology = ThreadPlanner::cachedTopology()) {
+            auto topologyInfo = facebook::react::jsi::Object(rt);
+            topologyInfo.setProperty(rt, "cpus", facebook::react::jsi::Value(static_cast<double>(topology->cpus.size())));
+            topologyInfo.setProperty(rt, "fromCache", facebook::react::jsi::Value(topology->from_cache));
+            topologyInfo.setProperty(rt, "loadMs", facebook::react::jsi::Value(topology->load_ms));
+            topologyInfo.setProperty(rt, "discoveryMs", facebook::react::jsi::Value(topology->discovery_ms));
+            systemInfo.setProperty(rt, "topology", std::move(topologyInfo));
+        }
+        
+        // Professional ISA features and the kernel variants bound at load time
+        systemInfo.setProperty(rt, "cpuFeatures",
+            facebook::react::jsi::String::createFromUtf8(rt, cpuFeatures().describe()));
+        auto kernelVariants = facebook::react::jsi::Object(rt);
+        for (const KernelDispatchBase* kernel : kernelRegistry()) {
+            kernelVariants.setProperty(rt, kernel->kernelName(),
+                facebook::react::jsi::String::createFromUtf8(rt, kernel->selectedVariant()));
+        }
+        systemInfo.setProperty(rt, "kernelVariants", std::move(kernelVariants));
+        systemInfo.setProperty(rt, "minerVariant",
+            facebook::react::jsi::String::createFromUtf8(rt, Launcher::preferredVariant().name));
+        
+        // Enhanced per-stage RandomX timings from the profiling miner build
+        StageProfiler::ProfileSnapshot profile = StageProfiler::Collector::instance().snapshot();
+        auto stageProfile = facebook::react::jsi::Object(rt);
+        stageProfile.setProperty(rt, "enabled", facebook::react::jsi::Value(Launcher::profilingEnabled()));
+        stageProfile.setProperty(rt, "reports", facebook::react::jsi::Value(static_cast<double>(profile.reports)));
+        auto stageNs = facebook::react::jsi::Object(rt);
+        for (size_t i = 0; i < StageProfiler::kStageCount; ++i) {
+            stageNs.setProperty(rt, StageProfiler::stageName(static_cast<StageProfiler::Stage>(i)),
+                facebook::react::jsi::Value(profile.stage_ns[i]));
+        }
+        stageProfile.setProperty(rt, "stageNs", std::move(stageNs));
+        auto scopes = facebook::react::jsi::Array(rt, profile.scopes.size());
+        for (size_t i = 0; i < profile.scopes.size(); ++i) {
+            const StageProfiler::ScopeTiming& timing = profile.scopes[i];
+            auto scope = facebook::react::jsi::Object(rt);
+            scope.setProperty(rt, "name", facebook::react::jsi::String::createFromUtf8(rt, timing.scope));
+            scope.setProperty(rt, "stage", facebook::react::jsi::String::createFromUtf8(rt, StageProfiler::stageName(timing.stage)));
+            scope.setProperty(rt, "meanNs", facebook::react::jsi::Value(timing.mean_ns));
+            scope.setProperty(rt, "sharePercent", facebook::react::jsi::Value(timing.share_percent));
+            scope.setProperty(rt, "threads", facebook::react::jsi::Value(static_cast<double>(timing.threads)));
+            scopes.setValueAtIndex(rt, i, std::move(scope));
+        }
+        stageProfile.setProperty(rt, "scopes", std::move(scopes));
+        systemInfo.setProperty(rt, "stageProfile", std::move(stageProfile));
+        
         return systemInfo;
         
     } catch (const std::exception& e) {
@@ -426,6 +614,634 @@ facebook::react::jsi::Value TradingAnarchyComputeEngineModule::getSystemInfo(
     }
 }
 
+/**
+ * Enhanced configuration management
+ */
+void TradingAnarchyComputeEngineModule::updateEngineConfig(
+    facebook::react::jsi::Runtime& rt,
+    const facebook::react::jsi::Value& config,
+    facebook::react::Promise promise) {
+    
+    try {
+        if (!validateConfig(config)) {
+            promise.reject("INVALID_CONFIG", "Engine configuration validation failed");
+            updateMetrics(ModuleMethod::UPDATE_ENGINE_CONFIG, false);
+            return;
+        }
+        
+        EngineConfig engineConfig = parseEngineConfig(rt, config.asObject(rt));
+        
+        // Professional miner stage profiling - takes effect on the next miner launch
+        auto stageProfiling = config.asObject(rt).getProperty(rt, "stageProfiling");
+        if (stageProfiling.isBool()) {
+            Launcher::setProfilingEnabled(stageProfiling.getBool());
+        }
+        
+        if (isInitialized() && !JNIBridge::getInstance().updateConfiguration(engineConfig)) {
+            promise.reject("UPDATE_FAILED", "Engine configuration update failed");
+            updateMetrics(ModuleMethod::UPDATE_ENGINE_CONFIG, false);
+            return;
+        }
+        
+        {
+            std::lock_guard<std::mutex> lock(engine_config_mutex_);
+            engine_config_ = engineConfig;
+        }
+        
+        promise.resolve(getCurrentConfig(rt));
+        updateMetrics(ModuleMethod::UPDATE_ENGINE_CONFIG, true);
+        
+    } catch (const std::exception& e) {
+        promise.reject("UPDATE_ERROR", e.what());
+        updateMetrics(ModuleMethod::UPDATE_ENGINE_CONFIG, false);
+    }
+}
+
+facebook::react::jsi::Value TradingAnarchyComputeEngineModule::getCurrentConfig(
+    facebook::react::jsi::Runtime& rt) {
+    
+    EngineConfig snapshot;
+    {
+        std::lock_guard<std::mutex> lock(engine_config_mutex_);
+        snapshot = engine_config_;
+    }
+    
+    auto config = facebook::react::jsi::Object(rt);
+    config.setProperty(rt, "threads", facebook::react::jsi::Value(static_cast<double>(snapshot.max_threads)));
+    config.setProperty(rt, "priority", facebook::react::jsi::Value(snapshot.thread_priority));
+    config.setProperty(rt, "enableHugePages", facebook::react::jsi::Value(snapshot.enable_huge_pages));
+    config.setProperty(rt, "stageProfiling", facebook::react::jsi::Value(Launcher::profilingEnabled()));
+    
+    return config;
+}
+
+/**
+ * Professional cache-aware thread plan - topology only, no benchmark
+ */
+void TradingAnarchyComputeEngineModule::getOptimalConfiguration(
+    facebook::react::jsi::Runtime& rt,
+    const facebook::react::jsi::Value& algorithm,
+    facebook::react::Promise promise) {
+    
+    try {
+        std::string algo = algorithm.isString() ? algorithm.asString(rt).utf8(rt) : "rx/0";
+        
+        PromiseHandle promiseId = registerPromise(promise, ModuleMethod::GET_OPTIMAL_CONFIGURATION);
+        if (promiseId == PendingPromises::kInvalidHandle) {
+            return;
+        }
+        
+        // The first call loads the hwloc topology, which walks sysfs
+        auto enqueued = std::chrono::steady_clock::now();
+        bool queued = NativeExecutor::engine().submit([this, promiseId, enqueued, algo, lifetime = lifetime_] {
+            auto started = std::chrono::steady_clock::now();
+            {
+                auto scope = lifetime->enter();
+                if (!scope) {
+                    return;
+                }
+                metrics_.methods.recordQueueWait(ModuleMethod::GET_OPTIMAL_CONFIGURATION, started - enqueued);
+            }
+            
+            // Topology load runs outside any scope so teardown never waits on sysfs
+            auto plan = std::make_shared<ThreadPlanner::Plan>(ThreadPlanner::plan(algo));
+            
+            auto scope = lifetime->enter();
+            if (!scope) {
+                return;
+            }
+            metrics_.methods.recordExecution(ModuleMethod::GET_OPTIMAL_CONFIGURATION,
+                                             std::chrono::steady_clock::now() - started);
+            
+            js_invoker_->invokeAsync([this, promiseId, lifetime, plan](facebook::react::jsi::Runtime& rt) {
+                auto scope = lifetime->enter();
+                if (!scope) {
+                    return;
+                }
+                resolvePromise(promiseId, convertToJSI(rt, *plan));
+            });
+        });
+        
+        if (!queued) {
+            rejectPromise(promiseId, "PLANNER_UNAVAILABLE", "Engine executor is shutting down");
+        }
+        
+    } catch (const std::exception& e) {
+        promise.reject("PLANNER_ERROR", e.what());
+        updateMetrics(ModuleMethod::GET_OPTIMAL_CONFIGURATION, false);
+    }
+}
+
+/**
+ * Professional callback registration
+ */
+void TradingAnarchyComputeEngineModule::setStatusCallback(
+    facebook::react::jsi::Runtime& rt,
+    const facebook::react::jsi::Value& callback) {
+    
+    std::lock_guard<std::mutex> lock(callbacks_mutex_);
+    status_callback_ = callback.isObject()
+        ? callback.asObject(rt).asFunction(rt)
+        : facebook::react::jsi::Function();
+}
+
+void TradingAnarchyComputeEngineModule::setPerformanceCallback(
+    facebook::react::jsi::Runtime& rt,
+    const facebook::react::jsi::Value& callback) {
+    
+    std::lock_guard<std::mutex> lock(callbacks_mutex_);
+    performance_callback_ = callback.isObject()
+        ? callback.asObject(rt).asFunction(rt)
+        : facebook::react::jsi::Function();
+}
+
+void TradingAnarchyComputeEngineModule::setErrorCallback(
+    facebook::react::jsi::Runtime& rt,
+    const facebook::react::jsi::Value& callback) {
+    
+    std::lock_guard<std::mutex> lock(callbacks_mutex_);
+    error_callback_ = callback.isObject()
+        ? callback.asObject(rt).asFunction(rt)
+        : facebook::react::jsi::Function();
+}
+
+void TradingAnarchyComputeEngineModule::setCallbackRate(
+    facebook::react::jsi::Runtime& rt,
+    const facebook::react::jsi::Value& hz) {
+    
+    if (hz.isNumber()) {
+        callback_dispatcher_->setMaxRate(hz.asNumber());
+    }
+}
+
+/**
+ * Professional simulated load
+ *
+ * Hashrate ticks become performance callbacks and pool disconnects become
+ * status and error callbacks, all through the dispatcher the engine uses,
+ * at rateMultiplier times realistic rates. Shares are counted, not
+ * verified - the JNI simulator covers the verifier.
+ */
+TelemetrySimulator::Sink TradingAnarchyComputeEngineModule::simulatorSink() {
+    TelemetrySimulator::Sink sink;
+    sink.tick = [this](const TelemetrySimulator::Tick& tick) {
+        PerformanceMetrics metrics{};
+        metrics.hashrate = tick.hashrate;
+        metrics.temperature = tick.temperature;
+        metrics.accepted_shares = simulated_accepted_.load(std::memory_order_relaxed);
+        metrics.rejected_shares = simulated_rejected_.load(std::memory_order_relaxed);
+        metrics.total_hashes = static_cast<uint64_t>(tick.total_hashes);
+        metrics.threads_active = tick.workers;
+        metrics.last_update = std::chrono::steady_clock::now();
+        invokePerformanceCallback(metrics);
+    };
+    sink.share = [this](const TelemetrySimulator::Share& share) {
+        if (share.expected == ShareVerifier::Reason::COUNT) {
+            simulated_accepted_.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            simulated_rejected_.fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+    sink.connection = [this](bool connected) {
+        invokeStatusCallback(connected ? ComputeEngineStatus::RUNNING : ComputeEngineStatus::PAUSED);
+        if (!connected) {
+            invokeErrorCallback("POOL_DISCONNECTED", "Simulated pool connection lost");
+        }
+    };
+    return sink;
+}
+
+facebook::react::jsi::Value TradingAnarchyComputeEngineModule::startSimulation(
+    facebook::react::jsi::Runtime& rt,
+    const facebook::react::jsi::Value& options) {
+    
+    TelemetrySimulator::Config config;
+    if (options.isObject()) {
+        auto object = options.asObject(rt);
+        auto number = [&](const char* name, double fallback) {
+            auto value = object.getProperty(rt, name);
+            return value.isNumber() ? value.asNumber() : fallback;
+        };
+        config.seed = static_cast<uint64_t>(number("seed", static_cast<double>(config.seed)));
+        config.workers = static_cast<uint32_t>(number("workers", config.workers));
+        config.rate_multiplier = number("rateMultiplier", config.rate_multiplier);
+        config.hashrate_tick_hz = number("hashrateTickHz", config.hashrate_tick_hz);
+        config.shares_per_minute = number("sharesPerMinute", config.shares_per_minute);
+        config.temperature_hz = number("temperatureHz", config.temperature_hz);
+        config.disconnects_per_hour = number("disconnectsPerHour", config.disconnects_per_hour);
+    }
+    
+    std::lock_guard<std::mutex> lock(simulator_mutex_);
+    if (!simulator_) {
+        simulator_ = std::make_unique<TelemetrySimulator>(simulatorSink());
+    }
+    if (simulator_->running()) {
+        return facebook::react::jsi::Value(false);
+    }
+    
+    simulated_accepted_ = 0;
+    simulated_rejected_ = 0;
+    invokeStatusCallback(ComputeEngineStatus::RUNNING);
+    bool started = simulator_->start(config);
+    if (!started) {
+        invokeStatusCallback(ComputeEngineStatus::STOPPED);
+    }
+    return facebook::react::jsi::Value(started);
+}
+
+facebook::react::jsi::Value TradingAnarchyComputeEngineModule::stopSimulation(
+    facebook::react::jsi::Runtime& rt) {
+    
+    std::lock_guard<std::mutex> lock(simulator_mutex_);
+    if (!simulator_) {
+        return facebook::react::jsi::Value::null();
+    }
+    
+    bool was_running = simulator_->running();
+    simulator_->stop();
+    if (was_running) {
+        invokeStatusCallback(ComputeEngineStatus::STOPPED);
+    }
+    
+    TelemetrySimulator::Stats stats = simulator_->stats();
+    auto result = facebook::react::jsi::Object(rt);
+    result.setProperty(rt, "seed", facebook::react::jsi::Value(static_cast<double>(stats.seed)));
+    result.setProperty(rt, "rateMultiplier", facebook::react::jsi::Value(stats.rate_multiplier));
+    result.setProperty(rt, "wallSeconds", facebook::react::jsi::Value(stats.wall_seconds));
+    result.setProperty(rt, "simulatedSeconds", facebook::react::jsi::Value(stats.simulated_seconds));
+    result.setProperty(rt, "maxLagMs", facebook::react::jsi::Value(stats.max_lag_ms));
+    result.setProperty(rt, "acceptedShares", facebook::react::jsi::Value(static_cast<double>(simulated_accepted_.load())));
+    result.setProperty(rt, "rejectedShares", facebook::react::jsi::Value(static_cast<double>(simulated_rejected_.load())));
+    result.setProperty(rt, "lostShares", facebook::react::jsi::Value(static_cast<double>(stats.lost_shares)));
+    
+    auto events = facebook::react::jsi::Object(rt);
+    for (size_t i = 0; i < TelemetrySimulator::kEventTypeCount; ++i) {
+        auto event = facebook::react::jsi::Object(rt);
+        event.setProperty(rt, "count", facebook::react::jsi::Value(static_cast<double>(stats.events[i])));
+        event.setProperty(rt, "sinkMeanUs", facebook::react::jsi::Value(stats.sink_mean_us[i]));
+        event.setProperty(rt, "sinkMaxUs", facebook::react::jsi::Value(stats.sink_max_us[i]));
+        events.setProperty(rt, TelemetrySimulator::eventName(static_cast<TelemetrySimulator::EventType>(i)), event);
+    }
+    result.setProperty(rt, "events", events);
+    
+    // Delivery side: what the dispatcher coalesced to keep the JS thread responsive
+    CallbackDispatcher::Stats delivery = callback_dispatcher_->stats();
+    auto callbacks = facebook::react::jsi::Object(rt);
+    callbacks.setProperty(rt, "maxRateHz", facebook::react::jsi::Value(delivery.max_rate_hz));
+    callbacks.setProperty(rt, "deliveredMetrics", facebook::react::jsi::Value(static_cast<double>(delivery.delivered_metrics)));
+    callbacks.setProperty(rt, "droppedMetrics", facebook::react::jsi::Value(static_cast<double>(delivery.dropped_metrics)));
+    callbacks.setProperty(rt, "deliveredEvents", facebook::react::jsi::Value(static_cast<double>(delivery.delivered_events)));
+    result.setProperty(rt, "callbacks", callbacks);
+    return result;
+}
+
+/**
+ * Enhanced callback invocation - routed through the delivery policy
+ */
+void TradingAnarchyComputeEngineModule::invokeStatusCallback(const ComputeEngineStatus& status) {
+    callback_dispatcher_->publishStatus(status);
+}
+
+void TradingAnarchyComputeEngineModule::invokePerformanceCallback(const PerformanceMetrics& metrics) {
+    callback_dispatcher_->publishMetrics(metrics);
+}
+
+void TradingAnarchyComputeEngineModule::invokeErrorCallback(
+    const std::string& error, const std::string& message) {
+    callback_dispatcher_->publishError(error, message);
+}
+
+/**
+ * Professional batch delivery on the JS thread
+ *
+ * Callbacks are only registered and invoked on the JS thread, so no lock
+ * is held while calling into JS (a callback may re-register itself).
+ *
+ * The dispatcher is held by the closure and acknowledged even when the
+ * module is gone, so the in-flight metrics slot is always released.
+ */
+void TradingAnarchyComputeEngineModule::deliverCallbackBatch(CallbackDispatcher::Batch batch) {
+    js_invoker_->invokeAsync(
+        [this, lifetime = lifetime_, dispatcher = callback_dispatcher_, batch = std::move(batch)](
+            facebook::react::jsi::Runtime& rt) {
+            auto scope = lifetime->enter();
+            if (!scope) {
+                dispatcher->acknowledge(batch.metrics.has_value());
+                return;
+            }
+            
+            for (const auto& event : batch.events) {
+                try {
+                    if (event.kind == CallbackDispatcher::Event::Kind::STATUS) {
+                        if (status_callback_.isValid()) {
+                            status_callback_.call(rt, convertToJSI(rt, event.status));
+                        }
+                    } else if (error_callback_.isValid()) {
+                        error_callback_.call(rt,
+                            facebook::react::jsi::String::createFromUtf8(rt, event.error),
+                            facebook::react::jsi::String::createFromUtf8(rt, event.message));
+                    }
+                } catch (const std::exception& e) {
+                    TA_LOGE("Exception in JS event callback: %s", e.what());
+                }
+            }
+            
+            if (batch.metrics && performance_callback_.isValid()) {
+                try {
+                    performance_callback_.call(rt, convertToJSI(rt, *batch.metrics));
+                } catch (const std::exception& e) {
+                    TA_LOGE("Exception in JS performance callback: %s", e.what());
+                }
+            }
+            
+            dispatcher->acknowledge(batch.metrics.has_value());
+        });
+}
+
+/**
+ * Enhanced security operations
+ */
+void TradingAnarchyComputeEngineModule::generateSecureKey(
+    facebook::react::jsi::Runtime& rt,
+    const facebook::react::jsi::Value& length,
+    facebook::react::Promise promise) {
+    
+    try {
+        size_t keyLength = length.isNumber() ? static_cast<size_t>(length.asNumber()) : 32;
+        if (keyLength == 0 || keyLength > 1024) {
+            promise.reject("INVALID_LENGTH", "Key length must be between 1 and 1024 bytes");
+            updateMetrics(ModuleMethod::GENERATE_SECURE_KEY, false);
+            return;
+        }
+        
+        std::vector<uint8_t> key = Crypto::generateSecureRandom(keyLength);
+        if (key.empty()) {
+            promise.reject("KEYGEN_FAILED", "Secure random generation failed");
+            updateMetrics(ModuleMethod::GENERATE_SECURE_KEY, false);
+            return;
+        }
+        
+        promise.resolve(facebook::react::jsi::String::createFromUtf8(rt, toHex(key)));
+        updateMetrics(ModuleMethod::GENERATE_SECURE_KEY, true);
+        
+    } catch (const std::exception& e) {
+        promise.reject("KEYGEN_ERROR", e.what());
+        updateMetrics(ModuleMethod::GENERATE_SECURE_KEY, false);
+    }
+}
+
+void TradingAnarchyComputeEngineModule::deriveKey(
+    facebook::react::jsi::Runtime& rt,
+    const facebook::react::jsi::Value& password,
+    const facebook::react::jsi::Value& salt,
+    const facebook::react::jsi::Value& iterations,
+    facebook::react::Promise promise) {
+    
+    try {
+        if (!password.isString() || !salt.isString()) {
+            promise.reject("INVALID_ARGUMENTS", "Password and salt must be strings");
+            updateMetrics(ModuleMethod::DERIVE_KEY, false);
+            return;
+        }
+        
+        double requested = iterations.isNumber() ? iterations.asNumber() : kDefaultDeriveIterations;
+        if (!(requested >= kMinDeriveIterations && requested <= kMaxDeriveIterations) ||
+            requested != std::floor(requested)) {
+            promise.reject("INVALID_ITERATIONS", "Iterations must be a whole number between " +
+                           std::to_string(kMinDeriveIterations) + " and " + std::to_string(kMaxDeriveIterations));
+            updateMetrics(ModuleMethod::DERIVE_KEY, false);
+            return;
+        }
+        int rounds = static_cast<int>(requested);
+        
+        // JSI values are read here; PBKDF2 itself runs on the engine executor
+        std::string passwordStr = password.asString(rt).utf8(rt);
+        std::string saltStr = salt.asString(rt).utf8(rt);
+        
+        PromiseHandle promiseId = registerPromise(promise, ModuleMethod::DERIVE_KEY);
+        if (promiseId == PendingPromises::kInvalidHandle) {
+            return;
+        }
+        
+        auto enqueued = std::chrono::steady_clock::now();
+        bool queued = NativeExecutor::engine().submit(
+            [this, promiseId, enqueued, rounds, lifetime = lifetime_,
+             passwordStr = std::move(passwordStr), saltStr = std::move(saltStr)] {
+                auto started = std::chrono::steady_clock::now();
+                {
+                    auto scope = lifetime->enter();
+                    if (!scope) {
+                        return;
+                    }
+                    metrics_.methods.recordQueueWait(ModuleMethod::DERIVE_KEY, started - enqueued);
+                }
+                
+                // Up to kMaxDeriveIterations rounds - outside any scope so teardown never waits on it
+                std::vector<uint8_t> saltBytes(saltStr.begin(), saltStr.end());
+                auto key = std::make_shared<std::string>(
+                    toHex(Crypto::deriveKeyPBKDF2(passwordStr, saltBytes, rounds, 32)));
+                
+                auto scope = lifetime->enter();
+                if (!scope) {
+                    return;
+                }
+                metrics_.methods.recordExecution(ModuleMethod::DERIVE_KEY, std::chrono::steady_clock::now() - started);
+                
+                js_invoker_->invokeAsync([this, promiseId, lifetime, key](facebook::react::jsi::Runtime& rt) {
+                    auto scope = lifetime->enter();
+                    if (!scope) {
+                        return;
+                    }
+                    if (key->empty()) {
+                        rejectPromise(promiseId, "DERIVE_FAILED", "PBKDF2 key derivation failed");
+                        return;
+                    }
+                    resolvePromise(promiseId, facebook::react::jsi::String::createFromUtf8(rt, *key));
+                });
+            });
+        
+        if (!queued) {
+            rejectPromise(promiseId, "DERIVE_UNAVAILABLE", "Engine executor is shutting down");
+        }
+        
+    } catch (const std::exception& e) {
+        promise.reject("DERIVE_ERROR", e.what());
+        updateMetrics(ModuleMethod::DERIVE_KEY, false);
+    }
+}
+
+void TradingAnarchyComputeEngineModule::computeHash(
+    facebook::react::jsi::Runtime& rt,
+    const facebook::react::jsi::Value& data,
+    const facebook::react::jsi::Value& algorithm,
+    facebook::react::Promise promise) {
+    
+    try {
+        std::string algo = algorithm.isString() ? algorithm.asString(rt).utf8(rt) : "SHA256";
+        
+        // Enhanced batch form - an array of strings resolves to an array of digests
+        std::vector<std::string> inputs;
+        bool batch = data.isObject() && data.asObject(rt).isArray(rt);
+        if (batch) {
+            auto array = data.asObject(rt).asArray(rt);
+            size_t count = array.size(rt);
+            inputs.reserve(count);
+            for (size_t i = 0; i < count; ++i) {
+                auto item = array.getValueAtIndex(rt, i);
+                if (!item.isString()) {
+                    promise.reject("INVALID_ARGUMENTS", "Hash inputs must be strings");
+                    updateMetrics(ModuleMethod::COMPUTE_HASH, false);
+                    return;
+                }
+                inputs.push_back(item.asString(rt).utf8(rt));
+            }
+        } else if (data.isString()) {
+            inputs.push_back(data.asString(rt).utf8(rt));
+        } else {
+            promise.reject("INVALID_ARGUMENTS", "Hash input must be a string");
+            updateMetrics(ModuleMethod::COMPUTE_HASH, false);
+            return;
+        }
+        
+        PromiseHandle promiseId = registerPromise(promise, ModuleMethod::COMPUTE_HASH);
+        if (promiseId == PendingPromises::kInvalidHandle) {
+            return;
+        }
+        
+        // Hashing runs on the engine executor; large batches never block the JS thread
+        auto enqueued = std::chrono::steady_clock::now();
+        bool queued = NativeExecutor::engine().submit(
+            [this, promiseId, enqueued, batch, lifetime = lifetime_, algo = std::move(algo), inputs = std::move(inputs)] {
+                auto started = std::chrono::steady_clock::now();
+                {
+                    auto scope = lifetime->enter();
+                    if (!scope) {
+                        return;
+                    }
+                    metrics_.methods.recordQueueWait(ModuleMethod::COMPUTE_HASH, started - enqueued);
+                }
+                
+                auto digests = std::make_shared<std::vector<std::string>>(
+                    batch ? computeBridgeHashBatch(inputs, algo)
+                          : std::vector<std::string>{computeBridgeHash(inputs.front(), algo)});
+                bool complete = digests->size() == inputs.size() &&
+                                std::none_of(digests->begin(), digests->end(),
+                                             [](const std::string& digest) { return digest.empty(); });
+                
+                auto scope = lifetime->enter();
+                if (!scope) {
+                    return;
+                }
+                metrics_.methods.recordExecution(ModuleMethod::COMPUTE_HASH, std::chrono::steady_clock::now() - started);
+                
+                js_invoker_->invokeAsync([this, promiseId, lifetime, batch, complete, digests](facebook::react::jsi::Runtime& rt) {
+                    auto scope = lifetime->enter();
+                    if (!scope) {
+                        return;
+                    }
+                    if (!complete) {
+                        rejectPromise(promiseId, "HASH_FAILED", "Hash computation failed");
+                        return;
+                    }
+                    if (!batch) {
+                        resolvePromise(promiseId, facebook::react::jsi::String::createFromUtf8(rt, digests->front()));
+                        return;
+                    }
+                    auto result = facebook::react::jsi::Array(rt, digests->size());
+                    for (size_t i = 0; i < digests->size(); ++i) {
+                        result.setValueAtIndex(rt, i, facebook::react::jsi::String::createFromUtf8(rt, (*digests)[i]));
+                    }
+                    resolvePromise(promiseId, std::move(result));
+                });
+            });
+        
+        if (!queued) {
+            rejectPromise(promiseId, "HASH_UNAVAILABLE", "Engine executor is shutting down");
+        }
+        
+    } catch (const std::exception& e) {
+        promise.reject("HASH_ERROR", e.what());
+        updateMetrics(ModuleMethod::COMPUTE_HASH, false);
+    }
+}
+
+/**
+ * Professional diagnostic operations
+ */
+void TradingAnarchyComputeEngineModule::runDiagnostics(
+    facebook::react::jsi::Runtime& rt,
+    facebook::react::Promise promise) {
+    
+    try {
+        PromiseHandle promiseId = registerPromise(promise, ModuleMethod::RUN_DIAGNOSTICS);
+        if (promiseId == PendingPromises::kInvalidHandle) {
+            return;
+        }
+        
+        // Enhanced background battery - takes a few seconds, never on the JS thread
+        auto enqueued = std::chrono::steady_clock::now();
+        bool queued = NativeExecutor::engine().submit([this, promiseId, enqueued, lifetime = lifetime_] {
+            auto started = std::chrono::steady_clock::now();
+            {
+                auto scope = lifetime->enter();
+                if (!scope) {
+                    return;
+                }
+                metrics_.methods.recordQueueWait(ModuleMethod::RUN_DIAGNOSTICS, started - enqueued);
+            }
+            
+            // The battery itself runs outside any scope; the module may be torn down meanwhile
+            auto report = std::make_shared<Diagnostics::DiagnosticsReport>(Diagnostics::runBattery());
+            
+            auto scope = lifetime->enter();
+            if (!scope) {
+                return;
+            }
+            metrics_.methods.recordExecution(ModuleMethod::RUN_DIAGNOSTICS, std::chrono::steady_clock::now() - started);
+            
+            js_invoker_->invokeAsync([this, promiseId, lifetime, report](facebook::react::jsi::Runtime& rt) {
+                auto scope = lifetime->enter();
+                if (!scope) {
+                    return;
+                }
+                resolvePromise(promiseId, convertToJSI(rt, *report));
+            });
+        });
+        
+        if (!queued) {
+            rejectPromise(promiseId, "DIAGNOSTICS_UNAVAILABLE", "Engine executor is shutting down");
+        }
+        
+    } catch (const std::exception& e) {
+        promise.reject("DIAGNOSTICS_ERROR", e.what());
+        updateMetrics(ModuleMethod::RUN_DIAGNOSTICS, false);
+    }
+}
+
+void TradingAnarchyComputeEngineModule::exportLogs(
+    facebook::react::jsi::Runtime& rt,
+    const facebook::react::jsi::Value& level,
+    facebook::react::Promise promise) {
+    
+    // Professional trace export - miner stage timings as Chrome trace-event JSON
+    try {
+        std::string trace = StageProfiler::Collector::instance().exportTrace();
+        promise.resolve(facebook::react::jsi::String::createFromUtf8(rt, trace));
+        updateMetrics(ModuleMethod::EXPORT_LOGS, true);
+    } catch (const std::exception& e) {
+        promise.reject("EXPORT_ERROR", e.what());
+        updateMetrics(ModuleMethod::EXPORT_LOGS, false);
+    }
+}
+
+void TradingAnarchyComputeEngineModule::clearCache(
+    facebook::react::jsi::Runtime& rt,
+    facebook::react::Promise promise) {
+    
+    promise.reject("NOT_SUPPORTED", "Cache management is not available in this build");
+    updateMetrics(ModuleMethod::CLEAR_CACHE, false);
+}
+
 /**
  * Enhanced utility methods implementation
  */
@@ -435,13 +1251,13 @@ facebook::react::jsi::Value TradingAnarchyComputeEngineModule::convertToJSI(
     
     auto jsMetrics = facebook::react::jsi::Object(rt);
     
-    jsMetrics.setProperty(rt, "hashRate", facebook::react::jsi::Value(metrics.hash_rate));
-    jsMetrics.setProperty(rt, "cpuUsage", facebook::react::jsi::Value(metrics.cpu_usage));
-    jsMetrics.setProperty(rt, "memoryUsage", facebook::react::jsi::Value(metrics.memory_usage));
+    jsMetrics.setProperty(rt, "hashRate", facebook::react::jsi::Value(metrics.hashrate));
+    jsMetrics.setProperty(rt, "powerUsage", facebook::react::jsi::Value(metrics.power_usage));
     jsMetrics.setProperty(rt, "temperature", facebook::react::jsi::Value(metrics.temperature));
     jsMetrics.setProperty(rt, "acceptedShares", facebook::react::jsi::Value(static_cast<double>(metrics.accepted_shares)));
     jsMetrics.setProperty(rt, "rejectedShares", facebook::react::jsi::Value(static_cast<double>(metrics.rejected_shares)));
-    jsMetrics.setProperty(rt, "uptime", facebook::react::jsi::Value(static_cast<double>(metrics.uptime)));
+    jsMetrics.setProperty(rt, "totalHashes", facebook::react::jsi::Value(static_cast<double>(metrics.total_hashes)));
+    jsMetrics.setProperty(rt, "threadsActive", facebook::react::jsi::Value(static_cast<double>(metrics.threads_active)));
     
     return jsMetrics;
 }
@@ -453,41 +1269,170 @@ facebook::react::jsi::Value TradingAnarchyComputeEngineModule::convertToJSI(
     return facebook::react::jsi::Value(static_cast<int>(status));
 }
 
+facebook::react::jsi::Value TradingAnarchyComputeEngineModule::convertToJSI(
+    facebook::react::jsi::Runtime& rt,
+    const Diagnostics::DiagnosticsReport& report) const {
+    
+    using facebook::react::jsi::Value;
+    
+    auto selfTests = facebook::react::jsi::Array(rt, report.known_answer_tests.size());
+    for (size_t i = 0; i < report.known_answer_tests.size(); ++i) {
+        const Diagnostics::KnownAnswerResult& kat = report.known_answer_tests[i];
+        auto entry = facebook::react::jsi::Object(rt);
+        entry.setProperty(rt, "kernel", facebook::react::jsi::String::createFromUtf8(rt, kat.kernel));
+        entry.setProperty(rt, "passed", Value(kat.passed));
+        entry.setProperty(rt, "durationUs", Value(kat.duration_us));
+        selfTests.setValueAtIndex(rt, i, std::move(entry));
+    }
+    
+    auto hashing = facebook::react::jsi::Object(rt);
+    hashing.setProperty(rt, "algorithm", facebook::react::jsi::String::createFromUtf8(rt, "sha256-64B"));
+    hashing.setProperty(rt, "singleCoreHashesPerSec", Value(report.single_core_hashes_per_sec));
+    hashing.setProperty(rt, "allCoreHashesPerSec", Value(report.all_core_hashes_per_sec));
+    hashing.setProperty(rt, "threads", Value(static_cast<double>(report.hash_threads)));
+    
+    auto memory = facebook::react::jsi::Object(rt);
+    memory.setProperty(rt, "readBytesPerSec", Value(report.memory_read_bytes_per_sec));
+    memory.setProperty(rt, "copyBytesPerSec", Value(report.memory_copy_bytes_per_sec));
+    memory.setProperty(rt, "latencyNs", Value(report.memory_latency_ns));
+    
+    auto thermal = facebook::react::jsi::Object(rt);
+    thermal.setProperty(rt, "zones", Value(static_cast<double>(report.thermal_zones)));
+    thermal.setProperty(rt, "readLatencyUs", Value(report.thermal_read_us));
+    thermal.setProperty(rt, "maxTemperatureC", Value(report.max_temperature_c));
+    
+    auto jsReport = facebook::react::jsi::Object(rt);
+    jsReport.setProperty(rt, "batteryVersion", Value(static_cast<double>(report.battery_version)));
+    jsReport.setProperty(rt, "selfTestPassed", Value(report.self_test_passed));
+    jsReport.setProperty(rt, "selfTests", std::move(selfTests));
+    jsReport.setProperty(rt, "hashing", std::move(hashing));
+    jsReport.setProperty(rt, "memory", std::move(memory));
+    jsReport.setProperty(rt, "timerResolutionNs", Value(report.timer_resolution_ns));
+    jsReport.setProperty(rt, "thermal", std::move(thermal));
+    jsReport.setProperty(rt, "deviceScore", Value(report.device_score));
+    jsReport.setProperty(rt, "durationMs", Value(report.duration_ms));
+    
+    return jsReport;
+}
+
+facebook::react::jsi::Value TradingAnarchyComputeEngineModule::convertToJSI(
+    facebook::react::jsi::Runtime& rt,
+    const ThreadPlanner::Plan& plan) const {
+    
+    using facebook::react::jsi::Value;
+    
+    auto cpus = facebook::react::jsi::Array(rt, plan.cpus.size());
+    for (size_t i = 0; i < plan.cpus.size(); ++i) {
+        cpus.setValueAtIndex(rt, i, Value(static_cast<double>(plan.cpus[i])));
+    }
+    
+    auto predicted = facebook::react::jsi::Array(rt, plan.predicted.size());
+    for (size_t i = 0; i < plan.predicted.size(); ++i) {
+        predicted.setValueAtIndex(rt, i, Value(plan.predicted[i]));
+    }
+    
+    auto jsPlan = facebook::react::jsi::Object(rt);
+    jsPlan.setProperty(rt, "algorithm", facebook::react::jsi::String::createFromUtf8(rt, plan.algorithm));
+    jsPlan.setProperty(rt, "knownAlgorithm", Value(plan.known_algorithm));
+    jsPlan.setProperty(rt, "scratchpadBytes", Value(static_cast<double>(plan.scratchpad_bytes)));
+    jsPlan.setProperty(rt, "threads", Value(static_cast<double>(plan.threads)));
+    jsPlan.setProperty(rt, "cpus", std::move(cpus));
+    jsPlan.setProperty(rt, "relativeThroughput", Value(plan.relative_throughput));
+    jsPlan.setProperty(rt, "allCoresRelativeThroughput", Value(plan.all_cores_relative_throughput));
+    jsPlan.setProperty(rt, "predictedRelativeThroughput", std::move(predicted));
+    jsPlan.setProperty(rt, "limitedBy", facebook::react::jsi::String::createFromUtf8(rt, plan.limited_by));
+    jsPlan.setProperty(rt, "cacheSource", facebook::react::jsi::String::createFromUtf8(rt, plan.topology_source));
+    
+    return jsPlan;
+}
+
 /**
  * Professional promise management
+ *
+ * Pending promises live in a fixed-capacity slab keyed by generation-tagged
+ * handles; registration and settlement never take a lock, and a recurring
+ * sweep rejects anything still pending after kPromiseTimeout.
  */
-std::string TradingAnarchyComputeEngineModule::generatePromiseId() const {
-    static std::atomic<uint64_t> counter{0};
-    std::stringstream ss;
-    ss << "promise_" << std::hex << counter.fetch_add(1);
-    return ss.str();
+TradingAnarchyComputeEngineModule::PromiseHandle TradingAnarchyComputeEngineModule::registerPromise(
+    facebook::react::Promise promise,
+    ModuleMethod method) {
+    
+    PromiseHandle handle = pending_promises_.insert(
+        PendingCall{promise, method}, std::chrono::steady_clock::now() + kPromiseTimeout);
+    
+    if (handle == PendingPromises::kInvalidHandle) {
+        promise.reject("TOO_MANY_PENDING", "Too many pending engine operations");
+        updateMetrics(method, false);
+    }
+    
+    return handle;
 }
 
 void TradingAnarchyComputeEngineModule::resolvePromise(
-    const std::string& promiseId,
+    PromiseHandle promiseId,
     const facebook::react::jsi::Value& result) {
     
-    std::lock_guard<std::mutex> lock(promises_mutex_);
-    auto it = pending_promises_.find(promiseId);
-    if (it != pending_promises_.end()) {
-        it->second.resolve(result);
-        pending_promises_.erase(it);
+    if (auto call = pending_promises_.take(promiseId)) {
+        call->promise.resolve(result);
+        updateMetrics(call->method, true);
     }
 }
 
 void TradingAnarchyComputeEngineModule::rejectPromise(
-    const std::string& promiseId,
+    PromiseHandle promiseId,
     const std::string& error,
     const std::string& message) {
     
-    std::lock_guard<std::mutex> lock(promises_mutex_);
-    auto it = pending_promises_.find(promiseId);
-    if (it != pending_promises_.end()) {
-        it->second.reject(error, message);
-        pending_promises_.erase(it);
+    if (auto call = pending_promises_.take(promiseId)) {
+        call->promise.reject(error, message);
+        updateMetrics(call->method, false);
     }
 }
 
+void TradingAnarchyComputeEngineModule::schedulePromiseReaper() {
+    NativeExecutor::engine().submitAfter(
+        kPromiseReapInterval,
+        [this, lifetime = lifetime_]() {
+            // Held through the reap; the destructor drains only after every scope has closed
+            auto scope = lifetime->enter();
+            if (!scope) {
+                return;
+            }
+            
+            pending_promises_.reapExpired(
+                std::chrono::steady_clock::now(),
+                [this](PendingCall&& call) {
+                    updateMetrics(call.method, false);
+                    js_invoker_->invokeAsync(
+                        [promise = std::move(call.promise)](facebook::react::jsi::Runtime&) mutable {
+                            promise.reject("TIMEOUT", "Engine operation timed out");
+                        });
+                });
+            
+            schedulePromiseReaper();
+        });
+}
+
+/**
+ * Professional configuration parsing
+ */
+EngineConfig TradingAnarchyComputeEngineModule::parseEngineConfig(
+    facebook::react::jsi::Runtime& rt,
+    const facebook::react::jsi::Object& config) const {
+    
+    EngineConfig engineConfig;
+    if (config.hasProperty(rt, "threads")) {
+        engineConfig.max_threads = static_cast<uint32_t>(config.getProperty(rt, "threads").asNumber());
+    }
+    if (config.hasProperty(rt, "priority")) {
+        engineConfig.thread_priority = static_cast<int>(config.getProperty(rt, "priority").asNumber());
+    }
+    if (config.hasProperty(rt, "enableHugePages")) {
+        engineConfig.enable_huge_pages = config.getProperty(rt, "enableHugePages").asBool();
+    }
+    return engineConfig;
+}
+
 /**
  * Enhanced validation methods
  */
@@ -504,13 +1449,70 @@ bool TradingAnarchyComputeEngineModule::isInitialized() const {
     return JNIBridge::getInstance().isInitialized();
 }
 
-void TradingAnarchyComputeEngineModule::updateMetrics(bool success) {
-    metrics_.method_calls.fetch_add(1);
-    if (success) {
-        metrics_.successful_operations.fetch_add(1);
-    } else {
-        metrics_.failed_operations.fetch_add(1);
+void TradingAnarchyComputeEngineModule::updateMetrics(ModuleMethod method, bool success) {
+    metrics_.methods.recordOutcome(method, success);
+}
+
+/**
+ * Professional per-method latency export
+ */
+namespace {
+
+facebook::react::jsi::Object histogramToJSI(
+    facebook::react::jsi::Runtime& rt,
+    const LatencyHistogram::Snapshot& snapshot) {
+    
+    using facebook::react::jsi::Value;
+    
+    auto histogram = facebook::react::jsi::Object(rt);
+    histogram.setProperty(rt, "count", Value(static_cast<double>(snapshot.count)));
+    histogram.setProperty(rt, "meanUs", Value(snapshot.mean_us));
+    histogram.setProperty(rt, "p50Us", Value(snapshot.p50_us));
+    histogram.setProperty(rt, "p90Us", Value(snapshot.p90_us));
+    histogram.setProperty(rt, "p99Us", Value(snapshot.p99_us));
+    histogram.setProperty(rt, "maxUs", Value(snapshot.max_us));
+    
+    // Trailing empty buckets are trimmed; bucket i counts samples below 2^i us
+    size_t used = LatencyHistogram::kBuckets;
+    while (used > 0 && snapshot.buckets[used - 1] == 0) {
+        --used;
+    }
+    auto buckets = facebook::react::jsi::Array(rt, used);
+    for (size_t i = 0; i < used; ++i) {
+        buckets.setValueAtIndex(rt, i, Value(static_cast<double>(snapshot.buckets[i])));
     }
+    histogram.setProperty(rt, "log2Buckets", std::move(buckets));
+    
+    return histogram;
+}
+
+} // namespace
+
+facebook::react::jsi::Value TradingAnarchyComputeEngineModule::methodMetricsToJSI(
+    facebook::react::jsi::Runtime& rt) const {
+    
+    using facebook::react::jsi::Value;
+    
+    auto methods = facebook::react::jsi::Object(rt);
+    for (size_t i = 0; i < kModuleMethodCount; ++i) {
+        auto method = static_cast<ModuleMethod>(i);
+        const MethodSlot& slot = metrics_.methods.slot(method);
+        
+        uint64_t calls = slot.calls.load(std::memory_order_relaxed);
+        if (calls == 0) {
+            continue;
+        }
+        
+        auto entry = facebook::react::jsi::Object(rt);
+        entry.setProperty(rt, "calls", Value(static_cast<double>(calls)));
+        entry.setProperty(rt, "successes", Value(static_cast<double>(slot.successes.load(std::memory_order_relaxed))));
+        entry.setProperty(rt, "failures", Value(static_cast<double>(slot.failures.load(std::memory_order_relaxed))));
+        entry.setProperty(rt, "queueWait", histogramToJSI(rt, slot.queue_wait.snapshot()));
+        entry.setProperty(rt, "execution", histogramToJSI(rt, slot.execution.snapshot()));
+        methods.setProperty(rt, methodName(method), std::move(entry));
+    }
+    
+    return methods;
 }
 
 /**
@@ -533,6 +1535,229 @@ void TradingAnarchyComputeEngineModule::cleanup() {
     instance_.reset();
 }
 
+/**
+ * Professional JSI method table
+ *
+ * Getters return synchronously so the UI reads engine state without a
+ * promise or bridge round-trip; long-running operations return promises.
+ */
+namespace {
+
+using ModuleRef = TradingAnarchyComputeEngineModule;
+using JSValue = facebook::react::jsi::Value;
+using JSRuntime = facebook::react::jsi::Runtime;
+
+using HostMethod = JSValue (*)(
+    const std::shared_ptr<ModuleRef>& module,
+    JSRuntime& rt,
+    const JSValue* args,
+    size_t count);
+
+struct MethodBinding {
+    ModuleMethod method;
+    unsigned int arg_count;
+    HostMethod invoke;
+};
+
+// Blocking engine operations record their own queue wait and execution on the executor
+constexpr bool runsOnExecutor(ModuleMethod method) {
+    return method == ModuleMethod::INITIALIZE_ENGINE ||
+           method == ModuleMethod::START_ENGINE ||
+           method == ModuleMethod::STOP_ENGINE ||
+           method == ModuleMethod::GET_OPTIMAL_CONFIGURATION ||
+           method == ModuleMethod::DERIVE_KEY ||
+           method == ModuleMethod::COMPUTE_HASH ||
+           method == ModuleMethod::RUN_DIAGNOSTICS;
+}
+
+// Promise-returning methods record their outcome when the promise settles
+constexpr bool settlesPromise(ModuleMethod method) {
+    return method >= ModuleMethod::INITIALIZE_ENGINE;
+}
+
+const JSValue& argAt(const JSValue* args, size_t count, size_t index) {
+    static const JSValue undefined;
+    return index < count ? args[index] : undefined;
+}
+
+template <typename Operation>
+JSValue makePromise(JSRuntime& rt, Operation&& operation) {
+    return facebook::react::createPromiseAsJSIValue(
+        rt,
+        [operation = std::forward<Operation>(operation)](
+            JSRuntime& rt, std::shared_ptr<facebook::react::Promise> promise) {
+            operation(rt, *promise);
+        });
+}
+
+const MethodBinding kMethodTable[] = {
+    // Synchronous getters
+    {ModuleMethod::GET_ENGINE_STATUS, 0, [](const std::shared_ptr<ModuleRef>& m, JSRuntime& rt, const JSValue*, size_t) {
+        return m->getEngineStatus(rt);
+    }},
+    {ModuleMethod::GET_PERFORMANCE_METRICS, 0, [](const std::shared_ptr<ModuleRef>& m, JSRuntime& rt, const JSValue*, size_t) {
+        return m->getPerformanceMetrics(rt);
+    }},
+    {ModuleMethod::GET_SYSTEM_INFO, 0, [](const std::shared_ptr<ModuleRef>& m, JSRuntime& rt, const JSValue*, size_t) {
+        return m->getSystemInfo(rt);
+    }},
+    {ModuleMethod::GET_METRICS_BUFFER, 0, [](const std::shared_ptr<ModuleRef>& m, JSRuntime& rt, const JSValue*, size_t) {
+        return m->getMetricsBuffer(rt);
+    }},
+    {ModuleMethod::GET_CURRENT_CONFIG, 0, [](const std::shared_ptr<ModuleRef>& m, JSRuntime& rt, const JSValue*, size_t) {
+        return m->getCurrentConfig(rt);
+    }},
+    
+    // Callback registration
+    {ModuleMethod::SET_STATUS_CALLBACK, 1, [](const std::shared_ptr<ModuleRef>& m, JSRuntime& rt, const JSValue* a, size_t n) {
+        m->setStatusCallback(rt, argAt(a, n, 0));
+        return JSValue::undefined();
+    }},
+    {ModuleMethod::SET_PERFORMANCE_CALLBACK, 1, [](const std::shared_ptr<ModuleRef>& m, JSRuntime& rt, const JSValue* a, size_t n) {
+        m->setPerformanceCallback(rt, argAt(a, n, 0));
+        return JSValue::undefined();
+    }},
+    {ModuleMethod::SET_ERROR_CALLBACK, 1, [](const std::shared_ptr<ModuleRef>& m, JSRuntime& rt, const JSValue* a, size_t n) {
+        m->setErrorCallback(rt, argAt(a, n, 0));
+        return JSValue::undefined();
+    }},
+    
+    {ModuleMethod::SET_CALLBACK_RATE, 1, [](const std::shared_ptr<ModuleRef>& m, JSRuntime& rt, const JSValue* a, size_t n) {
+        m->setCallbackRate(rt, argAt(a, n, 0));
+        return JSValue::undefined();
+    }},
+    {ModuleMethod::START_SIMULATION, 1, [](const std::shared_ptr<ModuleRef>& m, JSRuntime& rt, const JSValue* a, size_t n) {
+        return m->startSimulation(rt, argAt(a, n, 0));
+    }},
+    {ModuleMethod::STOP_SIMULATION, 0, [](const std::shared_ptr<ModuleRef>& m, JSRuntime& rt, const JSValue*, size_t) {
+        return m->stopSimulation(rt);
+    }},
+    
+    // Engine lifecycle
+    {ModuleMethod::INITIALIZE_ENGINE, 1, [](const std::shared_ptr<ModuleRef>& m, JSRuntime& rt, const JSValue* a, size_t n) {
+        return makePromise(rt, [&](JSRuntime& rt, facebook::react::Promise& p) {
+            m->initializeEngine(rt, argAt(a, n, 0), p);
+        });
+    }},
+    {ModuleMethod::START_ENGINE, 0, [](const std::shared_ptr<ModuleRef>& m, JSRuntime& rt, const JSValue*, size_t) {
+        return makePromise(rt, [&](JSRuntime& rt, facebook::react::Promise& p) {
+            m->startEngine(rt, p);
+        });
+    }},
+    {ModuleMethod::STOP_ENGINE, 0, [](const std::shared_ptr<ModuleRef>& m, JSRuntime& rt, const JSValue*, size_t) {
+        return makePromise(rt, [&](JSRuntime& rt, facebook::react::Promise& p) {
+            m->stopEngine(rt, p);
+        });
+    }},
+    {ModuleMethod::PAUSE_ENGINE, 0, [](const std::shared_ptr<ModuleRef>& m, JSRuntime& rt, const JSValue*, size_t) {
+        return makePromise(rt, [&](JSRuntime& rt, facebook::react::Promise& p) {
+            m->pauseEngine(rt, p);
+        });
+    }},
+    {ModuleMethod::RESUME_ENGINE, 0, [](const std::shared_ptr<ModuleRef>& m, JSRuntime& rt, const JSValue*, size_t) {
+        return makePromise(rt, [&](JSRuntime& rt, facebook::react::Promise& p) {
+            m->resumeEngine(rt, p);
+        });
+    }},
+    {ModuleMethod::UPDATE_ENGINE_CONFIG, 1, [](const std::shared_ptr<ModuleRef>& m, JSRuntime& rt, const JSValue* a, size_t n) {
+        return makePromise(rt, [&](JSRuntime& rt, facebook::react::Promise& p) {
+            m->updateEngineConfig(rt, argAt(a, n, 0), p);
+        });
+    }},
+    {ModuleMethod::GET_OPTIMAL_CONFIGURATION, 1, [](const std::shared_ptr<ModuleRef>& m, JSRuntime& rt, const JSValue* a, size_t n) {
+        return makePromise(rt, [&](JSRuntime& rt, facebook::react::Promise& p) {
+            m->getOptimalConfiguration(rt, argAt(a, n, 0), p);
+        });
+    }},
+    
+    // Security operations
+    {ModuleMethod::GENERATE_SECURE_KEY, 1, [](const std::shared_ptr<ModuleRef>& m, JSRuntime& rt, const JSValue* a, size_t n) {
+        return makePromise(rt, [&](JSRuntime& rt, facebook::react::Promise& p) {
+            m->generateSecureKey(rt, argAt(a, n, 0), p);
+        });
+    }},
+    {ModuleMethod::DERIVE_KEY, 3, [](const std::shared_ptr<ModuleRef>& m, JSRuntime& rt, const JSValue* a, size_t n) {
+        return makePromise(rt, [&](JSRuntime& rt, facebook::react::Promise& p) {
+            m->deriveKey(rt, argAt(a, n, 0), argAt(a, n, 1), argAt(a, n, 2), p);
+        });
+    }},
+    {ModuleMethod::COMPUTE_HASH, 2, [](const std::shared_ptr<ModuleRef>& m, JSRuntime& rt, const JSValue* a, size_t n) {
+        return makePromise(rt, [&](JSRuntime& rt, facebook::react::Promise& p) {
+            m->computeHash(rt, argAt(a, n, 0), argAt(a, n, 1), p);
+        });
+    }},
+    
+    // Diagnostics
+    {ModuleMethod::RUN_DIAGNOSTICS, 0, [](const std::shared_ptr<ModuleRef>& m, JSRuntime& rt, const JSValue*, size_t) {
+        return makePromise(rt, [&](JSRuntime& rt, facebook::react::Promise& p) {
+            m->runDiagnostics(rt, p);
+        });
+    }},
+    {ModuleMethod::EXPORT_LOGS, 1, [](const std::shared_ptr<ModuleRef>& m, JSRuntime& rt, const JSValue* a, size_t n) {
+        return makePromise(rt, [&](JSRuntime& rt, facebook::react::Promise& p) {
+            m->exportLogs(rt, argAt(a, n, 0), p);
+        });
+    }},
+    {ModuleMethod::CLEAR_CACHE, 0, [](const std::shared_ptr<ModuleRef>& m, JSRuntime& rt, const JSValue*, size_t) {
+        return makePromise(rt, [&](JSRuntime& rt, facebook::react::Promise& p) {
+            m->clearCache(rt, p);
+        });
+    }},
+};
+
+} // namespace
+
+void TradingAnarchyComputeEngineModule::installJSIBindings(
+    facebook::react::jsi::Runtime& rt,
+    std::shared_ptr<TradingAnarchyComputeEngineModule> module) {
+    
+    auto moduleObject = facebook::react::jsi::Object(rt);
+    
+    moduleObject.setProperty(rt, "getConstants",
+        facebook::react::jsi::Function::createFromHostFunction(
+            rt,
+            facebook::react::jsi::PropNameID::forAscii(rt, "getConstants"),
+            0,
+            [](JSRuntime& rt, const JSValue&, const JSValue*, size_t) -> JSValue {
+                return TradingAnarchyComputeEngineModule::getConstants(rt);
+            }));
+    
+    for (const MethodBinding& binding : kMethodTable) {
+        HostMethod invoke = binding.invoke;
+        ModuleMethod method = binding.method;
+        moduleObject.setProperty(rt, methodName(method),
+            facebook::react::jsi::Function::createFromHostFunction(
+                rt,
+                facebook::react::jsi::PropNameID::forAscii(rt, methodName(method)),
+                binding.arg_count,
+                [module, method, invoke](JSRuntime& rt, const JSValue&,
+                                         const JSValue* arguments, size_t count) -> JSValue {
+                    MethodMetrics& metrics = module->metrics_.methods;
+                    metrics.recordCall(method);
+                    if (runsOnExecutor(method)) {
+                        return invoke(module, rt, arguments, count);
+                    }
+                    
+                    // Enhanced inline timing - the whole call runs on the JS thread
+                    auto started = std::chrono::steady_clock::now();
+                    try {
+                        JSValue result = invoke(module, rt, arguments, count);
+                        metrics.recordExecution(method, std::chrono::steady_clock::now() - started);
+                        if (!settlesPromise(method)) {
+                            metrics.recordOutcome(method, true);
+                        }
+                        return result;
+                    } catch (...) {
+                        metrics.recordExecution(method, std::chrono::steady_clock::now() - started);
+                        metrics.recordOutcome(method, false);
+                        throw;
+                    }
+                }));
+    }
+    
+    rt.global().setProperty(rt, "TradingAnarchyComputeEngine", std::move(moduleObject));
+}
+
 } // namespace NativeModule
 } // namespace TradingAnarchy
 
@@ -560,24 +1785,7 @@ Java_com_tradinganarchy_computeengine_TradingAnarchyComputeEngineModule_nativeIn
         
         // Professional module installation
         auto module = TradingAnarchy::NativeModule::TradingAnarchyComputeEngineModule::getInstance(callInvoker);
-        
-        // Enhanced global object registration
-        auto moduleObject = facebook::react::jsi::Object(*jsContext);
-        
-        // Professional method binding
-        moduleObject.setProperty(*jsContext, "getConstants", 
-            facebook::react::jsi::Function::createFromHostFunction(
-                *jsContext, 
-                facebook::react::jsi::PropNameID::forAscii(*jsContext, "getConstants"), 
-                0,
-                [module](facebook::react::jsi::Runtime& rt, 
-                        const facebook::react::jsi::Value& thisValue,
-                        const facebook::react::jsi::Value* arguments, 
-                        size_t count) -> facebook::react::jsi::Value {
-                    return TradingAnarchy::NativeModule::TradingAnarchyComputeEngineModule::getConstants(rt);
-                }));
-        
-        jsContext->global().setProperty(*jsContext, "TradingAnarchyComputeEngine", std::move(moduleObject));
+        TradingAnarchy::NativeModule::TradingAnarchyComputeEngineModule::installJSIBindings(*jsContext, module);
         
         TA_LOGI("TradingAnarchyComputeEngineModule installed successfully");
         
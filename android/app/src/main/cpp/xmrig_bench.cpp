@@ -0,0 +1,318 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * XMRig Bench - Verified RandomX Benchmark via the Bundled Miner
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#include "xmrig_bench.h"
+#include "stage_profiler.h"
+#include "trading_anarchy_jni.h"
+
+#include <atomic>
+#include <cctype>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char** environ;
+
+namespace TradingAnarchy {
+namespace XmrigBench {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr char kFinishedMarker[] = "benchmark finished in ";
+constexpr char kHashSumMarker[] = "hash sum = ";
+constexpr char kProfileMarker[] = "use profile";
+constexpr int kPollIntervalMs = 250;
+
+// pid of the running benchmark, 0 when idle
+std::atomic<pid_t> g_running_pid{0};
+std::atomic<bool> g_cancelled{false};
+
+std::string stripAnsi(const std::string& line) {
+    std::string plain;
+    plain.reserve(line.size());
+    for (size_t i = 0; i < line.size(); ++i) {
+        if (line[i] == '\x1b' && i + 1 < line.size() && line[i + 1] == '[') {
+            i += 2;
+            while (i < line.size() && !std::isalpha(static_cast<unsigned char>(line[i]))) {
+                ++i;
+            }
+            continue;
+        }
+        plain.push_back(line[i]);
+    }
+    return plain;
+}
+
+/**
+ * Professional hash-sum colour check on the raw, still coloured line
+ */
+Verification verdictFromColour(const std::string& raw) {
+    size_t pos = raw.find(kHashSumMarker);
+    if (pos == std::string::npos) {
+        return Verification::UNKNOWN;
+    }
+
+    Verification verdict = Verification::UNKNOWN;
+    pos += sizeof(kHashSumMarker) - 1;
+    while (pos + 1 < raw.size() && raw[pos] == '\x1b' && raw[pos + 1] == '[') {
+        size_t end = raw.find('m', pos);
+        if (end == std::string::npos) {
+            break;
+        }
+        std::string code = raw.substr(pos + 2, end - pos - 2);
+        if (code.find("32") != std::string::npos) {
+            verdict = Verification::VERIFIED;
+        } else if (code.find("31") != std::string::npos) {
+            verdict = Verification::MISMATCH;
+        }
+        pos = end + 1;
+    }
+    return verdict;
+}
+
+bool equalsIgnoreCase(const std::string& a, const std::string& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (std::toupper(static_cast<unsigned char>(a[i])) != std::toupper(static_cast<unsigned char>(b[i]))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<std::string> buildArguments(const BenchOptions& options) {
+    std::vector<std::string> args = {
+        options.binary_path,
+        "--bench=" + options.size,
+        "--algo=" + options.algorithm,
+    };
+    if (options.threads > 0) {
+        args.push_back("--threads=" + std::to_string(options.threads));
+    }
+    if (options.affinity >= 0) {
+        char mask[32];
+        std::snprintf(mask, sizeof(mask), "0x%llx", static_cast<unsigned long long>(options.affinity));
+        args.push_back(std::string("--cpu-affinity=") + mask);
+    }
+    return args;
+}
+
+} // namespace
+
+const char* verificationName(Verification verification) {
+    switch (verification) {
+        case Verification::VERIFIED: return "verified";
+        case Verification::MISMATCH: return "mismatch";
+        default: return "unknown";
+    }
+}
+
+void parseLine(const std::string& raw, BenchResult& result) {
+    // Profiling builds interleave stage timings with the bench output
+    if (StageProfiler::Collector::instance().ingestLine(raw)) {
+        return;
+    }
+
+    std::string line = stripAnsi(raw);
+
+    size_t profile = line.find(kProfileMarker);
+    if (profile != std::string::npos) {
+        size_t open = line.find('(', profile);
+        unsigned threads = 0;
+        if (open != std::string::npos && std::sscanf(line.c_str() + open, "(%u thread", &threads) == 1) {
+            result.threads = threads;
+        }
+        return;
+    }
+
+    size_t finished = line.find(kFinishedMarker);
+    if (finished == std::string::npos) {
+        return;
+    }
+
+    double seconds = 0.0;
+    double hashrate = 0.0;
+    if (std::sscanf(line.c_str() + finished + sizeof(kFinishedMarker) - 1,
+                    "%lf seconds (%lf h/s)", &seconds, &hashrate) == 2) {
+        result.duration_seconds = seconds;
+        result.hashrate = hashrate;
+    }
+
+    size_t hash = line.find(kHashSumMarker, finished);
+    if (hash != std::string::npos) {
+        size_t begin = hash + sizeof(kHashSumMarker) - 1;
+        size_t end = begin;
+        while (end < line.size() && std::isxdigit(static_cast<unsigned char>(line[end]))) {
+            ++end;
+        }
+        result.hash_sum = line.substr(begin, end - begin);
+        result.verification = verdictFromColour(raw);
+    }
+}
+
+BenchResult run(const BenchOptions& options) {
+    BenchResult result;
+
+    if (access(options.binary_path.c_str(), X_OK) != 0) {
+        result.error = "binary not executable: " + options.binary_path;
+        return result;
+    }
+
+    pid_t idle = 0;
+    if (!g_running_pid.compare_exchange_strong(idle, -1)) {
+        result.error = "busy";
+        return result;
+    }
+    g_cancelled.store(false);
+
+    int pipe_fds[2];
+    if (pipe2(pipe_fds, O_CLOEXEC) != 0) {
+        g_running_pid.store(0);
+        result.error = std::string("pipe failed: ") + std::strerror(errno);
+        return result;
+    }
+
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_adddup2(&actions, pipe_fds[1], STDOUT_FILENO);
+    posix_spawn_file_actions_adddup2(&actions, pipe_fds[1], STDERR_FILENO);
+
+    std::vector<std::string> args = buildArguments(options);
+    std::vector<char*> argv;
+    for (std::string& arg : args) {
+        argv.push_back(arg.data());
+    }
+    argv.push_back(nullptr);
+
+    auto started = Clock::now();
+    pid_t pid = 0;
+    int spawn_error = posix_spawn(&pid, options.binary_path.c_str(), &actions, nullptr, argv.data(), environ);
+    posix_spawn_file_actions_destroy(&actions);
+    close(pipe_fds[1]);
+
+    if (spawn_error != 0) {
+        close(pipe_fds[0]);
+        g_running_pid.store(0);
+        result.error = std::string("spawn failed: ") + std::strerror(spawn_error);
+        return result;
+    }
+
+    g_running_pid.store(pid);
+    TA_LOGI("xmrig bench started: pid %d, %s --bench=%s --algo=%s",
+            pid, options.binary_path.c_str(), options.size.c_str(), options.algorithm.c_str());
+
+    // Professional output pump with deadline
+    auto deadline = started + options.timeout;
+    std::string pending;
+    char buffer[4096];
+    bool timed_out = false;
+
+    for (;;) {
+        if (Clock::now() >= deadline) {
+            timed_out = true;
+            kill(pid, SIGKILL);
+            break;
+        }
+
+        pollfd fd{pipe_fds[0], POLLIN, 0};
+        int ready = poll(&fd, 1, kPollIntervalMs);
+        if (ready < 0 && errno != EINTR) {
+            break;
+        }
+        if (ready <= 0) {
+            continue;
+        }
+
+        ssize_t n = read(pipe_fds[0], buffer, sizeof(buffer));
+        if (n <= 0) {
+            break;      // EOF - xmrig exited or closed its output
+        }
+
+        pending.append(buffer, static_cast<size_t>(n));
+        size_t newline;
+        while ((newline = pending.find('\n')) != std::string::npos) {
+            parseLine(pending.substr(0, newline), result);
+            pending.erase(0, newline + 1);
+        }
+    }
+    if (!pending.empty()) {
+        parseLine(pending, result);
+    }
+    close(pipe_fds[0]);
+
+    int status = 0;
+    while (waitpid(pid, &status, 0) < 0 && errno == EINTR) {
+    }
+    g_running_pid.store(0);
+
+    result.wall_seconds = std::chrono::duration<double>(Clock::now() - started).count();
+    result.exit_code = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+
+    // An explicit expected hash overrides an uncoloured verdict
+    if (!options.expected_hash.empty() && !result.hash_sum.empty() &&
+        result.verification == Verification::UNKNOWN) {
+        result.verification = equalsIgnoreCase(options.expected_hash, result.hash_sum)
+            ? Verification::VERIFIED : Verification::MISMATCH;
+    }
+
+    if (timed_out) {
+        result.error = "timeout";
+    } else if (g_cancelled.load()) {
+        result.error = "cancelled";
+    } else if (WIFSIGNALED(status) && WTERMSIG(status) == SIGILL) {
+        result.error = "illegal instruction - binary not supported by this CPU";
+    } else if (result.hash_sum.empty()) {
+        result.error = "no benchmark result in output (exit " + std::to_string(result.exit_code) + ")";
+    } else if (result.verification == Verification::MISMATCH) {
+        result.error = "hash sum mismatch";
+    } else {
+        result.success = true;
+    }
+
+    TA_LOGI("xmrig bench finished: %.1f H/s in %.1fs, hash %s (%s)%s%s",
+            result.hashrate, result.duration_seconds, result.hash_sum.c_str(),
+            verificationName(result.verification),
+            result.error.empty() ? "" : " - ", result.error.c_str());
+    return result;
+}
+
+bool cancel() {
+    pid_t pid = g_running_pid.load();
+    if (pid <= 0) {
+        return false;
+    }
+    g_cancelled.store(true);
+    return kill(pid, SIGTERM) == 0;
+}
+
+std::string nativeLibraryDir() {
+    Dl_info info{};
+    if (dladdr(reinterpret_cast<void*>(&nativeLibraryDir), &info) == 0 || info.dli_fname == nullptr) {
+        return {};
+    }
+    std::string path = info.dli_fname;
+    size_t slash = path.rfind('/');
+    return slash == std::string::npos ? std::string() : path.substr(0, slash);
+}
+
+} // namespace XmrigBench
+} // namespace TradingAnarchy
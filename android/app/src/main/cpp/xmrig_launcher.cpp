@@ -0,0 +1,278 @@
+/*
+ * =============================================
+ * Trading Anarchy Android Compute Engine
+ * XMRig Launcher - Per-Microarchitecture Miner Binary Selection
+ * Copyright (c) 2025 Trading Anarchy. All rights reserved.
+ * Version: 2025.1.0 - Enhanced Performance & Modern Architecture
+ * =============================================
+ */
+
+#include "xmrig_launcher.h"
+#include "stage_profiler.h"
+#include "aes_round.h"
+#include "thread_planner.h"
+#include "native_executor.h"
+#include "trading_anarchy_jni.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <thread>
+#include <unistd.h>
+
+namespace TradingAnarchy {
+namespace Launcher {
+
+namespace {
+
+constexpr uint32_t kImplementerArm = 0x41;
+constexpr uint32_t kImplementerQualcomm = 0x51;
+
+/**
+ * Professional in-order core classification by MIDR part number
+ *
+ * Only the little cores are listed; everything else shipped in phones
+ * since 2018 (A7x, X-series, Kryo Gold) benefits from the big-core tuning.
+ */
+bool isLittleCore(uint32_t implementer, uint32_t part) {
+    if (implementer == kImplementerArm) {
+        switch (part) {
+            case 0xd03:     // Cortex-A53
+            case 0xd04:     // Cortex-A35
+            case 0xd05:     // Cortex-A55
+            case 0xd46:     // Cortex-A510
+            case 0xd80:     // Cortex-A520
+                return true;
+        }
+    }
+    if (implementer == kImplementerQualcomm) {
+        switch (part) {
+            case 0x801:     // Kryo 2xx Silver
+            case 0x803:     // Kryo 3xx Silver
+            case 0x805:     // Kryo 4xx/5xx Silver
+                return true;
+        }
+    }
+    return false;
+}
+
+bool readMidr(unsigned cpu, uint64_t& midr) {
+    char path[96];
+    std::snprintf(path, sizeof(path),
+                  "/sys/devices/system/cpu/cpu%u/regs/identification/midr_el1", cpu);
+    std::ifstream file(path);
+    std::string text;
+    if (!(file >> text)) {
+        return false;
+    }
+    midr = std::strtoull(text.c_str(), nullptr, 16);
+    return true;
+}
+
+/**
+ * Enhanced fallback for kernels without the identification sysfs node
+ */
+void scanCpuInfo(CoreInventory& cores) {
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    uint32_t implementer = 0;
+
+    while (std::getline(cpuinfo, line)) {
+        size_t colon = line.find(':');
+        if (colon == std::string::npos) {
+            continue;
+        }
+        uint32_t value = static_cast<uint32_t>(std::strtoul(line.c_str() + colon + 1, nullptr, 0));
+        if (line.rfind("CPU implementer", 0) == 0) {
+            implementer = value;
+        } else if (line.rfind("CPU part", 0) == 0) {
+            if (isLittleCore(implementer, value)) {
+                cores.little_cores++;
+            } else {
+                cores.big_cores++;
+            }
+        }
+    }
+}
+
+bool isExecutable(const std::string& path) {
+    return access(path.c_str(), X_OK) == 0;
+}
+
+#if defined(__aarch64__)
+// armv8.2-a+crypto+dotprod+fp16+rcpc, the ISA implied by -mcpu=cortex-a55/a76
+constexpr uint64_t kArmv82Features =
+    CPU_AES | CPU_PMULL | CPU_SHA1 | CPU_SHA2 | CPU_DOTPROD | CPU_FP16 | CPU_RCPC;
+#endif
+
+// Baseline ISA with xmrig's WITH_PROFILING scopes compiled in
+const BinaryVariant kProfilingVariant = {"profile", "-profile", 0, false};
+
+std::atomic<bool> g_profiling_enabled{false};
+
+} // namespace
+
+const std::vector<BinaryVariant>& binaryVariants() {
+    static const std::vector<BinaryVariant> variants = {
+#if defined(__aarch64__)
+        {"v82-a76", "-v82-a76", kArmv82Features, true},
+        {"v82-a55", "-v82-a55", kArmv82Features, false},
+        {"armv8", "", 0, false},
+#else
+        {"baseline", "", 0, false},
+#endif
+    };
+    return variants;
+}
+
+CoreInventory detectCores() {
+    CoreInventory cores;
+    unsigned cpu_count = std::max(1u, std::thread::hardware_concurrency());
+
+    for (unsigned cpu = 0; cpu < cpu_count; ++cpu) {
+        uint64_t midr = 0;
+        if (!readMidr(cpu, midr)) {
+            cores.unknown_cores++;
+            continue;
+        }
+        uint32_t implementer = static_cast<uint32_t>((midr >> 24) & 0xff);
+        uint32_t part = static_cast<uint32_t>((midr >> 4) & 0xfff);
+        if (isLittleCore(implementer, part)) {
+            cores.little_cores++;
+        } else {
+            cores.big_cores++;
+        }
+    }
+
+    if (cores.unknown_cores == cpu_count) {
+        cores = CoreInventory{};
+        scanCpuInfo(cores);
+    }
+
+    return cores;
+}
+
+const BinaryVariant& preferredVariant() {
+    static const BinaryVariant& preferred = [] () -> const BinaryVariant& {
+        const std::vector<BinaryVariant>& variants = binaryVariants();
+        bool big_cores = detectCores().hasBigCores();
+
+        for (const BinaryVariant& variant : variants) {
+            if (!cpuFeatures().has(variant.required_features)) {
+                continue;
+            }
+            if (variant.prefers_big_cores && !big_cores) {
+                continue;
+            }
+            return variant;
+        }
+        return variants.back();
+    }();
+    return preferred;
+}
+
+Selection selectBinary(const std::string& native_lib_dir, const std::string& base_name) {
+    const std::vector<BinaryVariant>& variants = binaryVariants();
+    const BinaryVariant& preferred = preferredVariant();
+    Selection selection;
+
+    if (g_profiling_enabled.load(std::memory_order_relaxed)) {
+        selection.variant = &kProfilingVariant;
+        selection.file_name = base_name + kProfilingVariant.suffix + ".so";
+        selection.path = native_lib_dir + "/" + selection.file_name;
+        if (isExecutable(selection.path)) {
+            return selection;
+        }
+        TA_LOGW("Stage profiling requested but %s is not installed", selection.file_name.c_str());
+    }
+
+    // Start at the preferred variant and walk down towards the baseline
+    size_t start = static_cast<size_t>(&preferred - variants.data());
+
+    for (size_t i = start; i < variants.size(); ++i) {
+        selection.variant = &variants[i];
+        selection.file_name = base_name + variants[i].suffix + ".so";
+        selection.path = native_lib_dir + "/" + selection.file_name;
+        if (isExecutable(selection.path)) {
+            break;
+        }
+        TA_LOGD("Miner variant %s not installed for %s", variants[i].name, base_name.c_str());
+    }
+
+    return selection;
+}
+
+void setProfilingEnabled(bool enabled) {
+    g_profiling_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool profilingEnabled() {
+    return g_profiling_enabled.load(std::memory_order_relaxed);
+}
+
+const BinaryVariant& profilingVariant() {
+    return kProfilingVariant;
+}
+
+} // namespace Launcher
+} // namespace TradingAnarchy
+
+// Professional JNI entry point for MiningService
+extern "C" {
+
+JNIEXPORT jstring JNICALL
+Java_com_xmrigforandroid_MiningService_nativeSelectXmrigBinary(
+    JNIEnv* env, jclass clazz, jstring native_lib_dir, jstring base_name) {
+
+    const char* dir_str = env->GetStringUTFChars(native_lib_dir, nullptr);
+    const char* base_str = env->GetStringUTFChars(base_name, nullptr);
+
+    TradingAnarchy::Launcher::Selection selection =
+        TradingAnarchy::Launcher::selectBinary(dir_str, base_str);
+
+    TA_LOGI("Selected miner binary %s (variant %s, cpu features: %s)",
+            selection.file_name.c_str(), selection.variant->name,
+            TradingAnarchy::cpuFeatures().describe().c_str());
+
+    // A fresh profiling run starts a fresh stage profile
+    if (selection.variant == &TradingAnarchy::Launcher::profilingVariant()) {
+        TradingAnarchy::StageProfiler::Collector::instance().reset();
+    }
+
+    env->ReleaseStringUTFChars(native_lib_dir, dir_str);
+    env->ReleaseStringUTFChars(base_name, base_str);
+
+    return env->NewStringUTF(selection.file_name.c_str());
+}
+
+JNIEXPORT jint JNICALL
+Java_com_xmrigforandroid_MiningService_nativeHardwareAesPreference(
+    JNIEnv* env, jclass clazz) {
+
+    // Never times the variants here; the service warms them when it is created
+    const TradingAnarchy::AesRound::Selection* selection = TradingAnarchy::AesRound::cachedSelection();
+    if (selection == nullptr) {
+        return -1;
+    }
+    return selection->hardware_preferred ? 1 : 0;
+}
+
+JNIEXPORT void JNICALL
+Java_com_xmrigforandroid_MiningService_nativeSetTopologyCacheDirectory(
+    JNIEnv* env, jclass clazz, jstring files_dir) {
+
+    const char* dir_str = env->GetStringUTFChars(files_dir, nullptr);
+    TradingAnarchy::ThreadPlanner::setCacheDirectory(dir_str);
+    env->ReleaseStringUTFChars(files_dir, dir_str);
+
+    // Load now, off the main thread, so neither the first plan nor the first launch waits
+    TradingAnarchy::NativeExecutor::engine().submit([] {
+        TradingAnarchy::ThreadPlanner::topology();
+        TradingAnarchy::AesRound::selection();
+    });
+}
+
+} // extern "C"
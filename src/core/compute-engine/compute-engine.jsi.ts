@@ -0,0 +1,302 @@
+/**
+ * Direct JSI binding installed by TradingAnarchyComputeEngineModule.nativeInstall.
+ * Getters are synchronous host functions; engine operations return promises.
+ */
+export interface ComputeEngineJSI {
+  getConstants(): Record<string, unknown>;
+  getEngineStatus(): number | null;
+  getPerformanceMetrics(): Record<string, number> | null;
+  getSystemInfo(): Record<string, unknown> | null;
+  getCurrentConfig(): Record<string, unknown>;
+  getMetricsBuffer(): ArrayBuffer;
+  setStatusCallback(callback: ((status: number) => void) | null): void;
+  setPerformanceCallback(callback: ((metrics: Record<string, number>) => void) | null): void;
+  setErrorCallback(callback: ((error: string, message: string) => void) | null): void;
+  setCallbackRate(hz: number): void;
+  /** Synthetic engine events through the callback pipeline; false if already running. */
+  startSimulation(options?: SimulationOptions): boolean;
+  stopSimulation(): SimulationStats | null;
+  initializeEngine(config: Record<string, unknown>): Promise<{ success: boolean; status: string }>;
+  startEngine(): Promise<{ success: boolean; status: string }>;
+  stopEngine(): Promise<{ success: boolean; status: string }>;
+  pauseEngine(): Promise<{ success: boolean; status: string }>;
+  resumeEngine(): Promise<{ success: boolean; status: string }>;
+  updateEngineConfig(config: Record<string, unknown>): Promise<Record<string, unknown>>;
+  /** Cache-aware thread count and core set from the CPU topology; defaults to rx/0. */
+  getOptimalConfiguration(algorithm?: string): Promise<OptimalConfiguration>;
+  generateSecureKey(length: number): Promise<string>;
+  deriveKey(password: string, salt: string, iterations: number): Promise<string>;
+  computeHash(data: string, algorithm: string): Promise<string>;
+  /** Batch form; SHA3-256 and KECCAK-256 batches share interleaved Keccak permutations. */
+  computeHash(data: string[], algorithm: string): Promise<string[]>;
+  runDiagnostics(): Promise<DiagnosticsReport>;
+  /** Miner stage timings as Chrome trace-event JSON (chrome://tracing, Perfetto). */
+  exportLogs(level: string): Promise<string>;
+  clearCache(): Promise<boolean>;
+}
+
+/**
+ * Result of the native self-test and microbenchmark battery. deviceScore is
+ * only comparable between reports with the same batteryVersion and is 0 when
+ * any self-test fails.
+ */
+export interface DiagnosticsReport {
+  batteryVersion: number;
+  selfTestPassed: boolean;
+  selfTests: { kernel: string; passed: boolean; durationUs: number }[];
+  hashing: {
+    algorithm: string;
+    singleCoreHashesPerSec: number;
+    allCoreHashesPerSec: number;
+    threads: number;
+  };
+  memory: { readBytesPerSec: number; copyBytesPerSec: number; latencyNs: number };
+  timerResolutionNs: number;
+  thermal: { zones: number; readLatencyUs: number; maxTemperatureC: number };
+  deviceScore: number;
+  durationMs: number;
+}
+
+/**
+ * Thread plan for one algorithm. Throughputs are predictions relative to one
+ * thread on the fastest core with its scratchpad in cache; cpus are OS CPU
+ * indexes to pin to, fastest first. predictedRelativeThroughput[i] is the
+ * prediction for i + 1 threads on the first i + 1 of the same CPU order.
+ */
+export interface OptimalConfiguration {
+  algorithm: string;
+  knownAlgorithm: boolean;
+  scratchpadBytes: number;
+  threads: number;
+  cpus: number[];
+  relativeThroughput: number;
+  allCoresRelativeThroughput: number;
+  predictedRelativeThroughput: number[];
+  limitedBy: 'cores' | 'cache' | 'bandwidth';
+  cacheSource: 'hwloc' | 'probe' | 'default';
+}
+
+/**
+ * Load-test options. Rates are realistic per simulated second; rateMultiplier
+ * runs simulated time that many times faster than the wall clock, so 100
+ * replays a session at 100x its event rates. The same seed replays the same
+ * event streams.
+ */
+export interface SimulationOptions {
+  seed?: number;
+  workers?: number;
+  rateMultiplier?: number;
+  hashrateTickHz?: number;
+  sharesPerMinute?: number;
+  temperatureHz?: number;
+  disconnectsPerHour?: number;
+}
+
+export interface SimulationEventStats {
+  count: number;
+  sinkMeanUs: number; // native time spent publishing one event
+  sinkMaxUs: number;
+}
+
+export interface SimulationStats {
+  seed: number;
+  rateMultiplier: number;
+  wallSeconds: number;
+  simulatedSeconds: number;
+  maxLagMs: number; // how late a simulator thread woke for a due event
+  acceptedShares: number;
+  rejectedShares: number;
+  lostShares: number;
+  events: Record<'tick' | 'share' | 'temperature' | 'connection' | 'job', SimulationEventStats>;
+  callbacks: { maxRateHz: number; deliveredMetrics: number; droppedMetrics: number; deliveredEvents: number };
+}
+
+export interface CallOverheadReport {
+  iterations: number;
+  jsiMicros: number; // mean per call
+}
+
+declare global {
+  // eslint-disable-next-line no-var
+  var TradingAnarchyComputeEngine: ComputeEngineJSI | undefined;
+}
+
+export const getComputeEngine = (): ComputeEngineJSI | undefined => global.TradingAnarchyComputeEngine;
+
+/**
+ * Measure per-call overhead of getEngineStatus through the synchronous JSI
+ * binding. There is no bridge comparison: no bridge module in this tree
+ * exports getEngineStatus, so an A/B would only ever report NaN.
+ */
+export const measureCallOverhead = async (iterations: number = 1000): Promise<CallOverheadReport> => {
+  const engine = getComputeEngine();
+  if (!engine) {
+    throw new Error('TradingAnarchyComputeEngine JSI binding is not installed');
+  }
+
+  // Warm the path so first-call setup stays out of the timed loop
+  engine.getEngineStatus();
+
+  const jsiStart = performance.now();
+  for (let i = 0; i < iterations; i++) {
+    engine.getEngineStatus();
+  }
+  const jsiMicros = ((performance.now() - jsiStart) * 1000) / iterations;
+
+  return {
+    iterations,
+    jsiMicros,
+  };
+};
+
+export interface FrameDropReport {
+  frames: number;
+  droppedFrames: number; // frames that took longer than 1.5x the target interval
+  longestFrameMs: number;
+  durationMs: number;
+}
+
+/**
+ * Count JS frame drops while an engine operation is in flight.
+ */
+export const measureFrameDrops = async <T>(
+  operation: () => Promise<T>,
+  targetFrameMs: number = 1000 / 60,
+): Promise<{ result: T; report: FrameDropReport }> => {
+  const report: FrameDropReport = { frames: 0, droppedFrames: 0, longestFrameMs: 0, durationMs: 0 };
+  let running = true;
+  let lastFrame = performance.now();
+
+  const onFrame = (now: number) => {
+    const delta = now - lastFrame;
+    lastFrame = now;
+    report.frames++;
+    report.longestFrameMs = Math.max(report.longestFrameMs, delta);
+    if (delta > targetFrameMs * 1.5) {
+      report.droppedFrames += Math.round(delta / targetFrameMs) - 1;
+    }
+    if (running) {
+      requestAnimationFrame(onFrame);
+    }
+  };
+
+  const start = performance.now();
+  requestAnimationFrame(onFrame);
+  try {
+    const result = await operation();
+    return { result, report };
+  } finally {
+    running = false;
+    report.durationMs = performance.now() - start;
+  }
+};
+
+/**
+ * Slot layout of the native live metrics block (live_metrics.h).
+ */
+const LIVE_METRICS_LAYOUT_VERSION = 1;
+const LIVE_METRICS_MAX_THREADS = 32;
+const LIVE_METRICS_READ_ATTEMPTS = 4;
+
+enum LiveMetricsSlot {
+  LAYOUT_VERSION = 0,
+  SEQUENCE,
+  TIMESTAMP_MS,
+  HASHRATE,
+  ACCEPTED_SHARES,
+  REJECTED_SHARES,
+  TEMPERATURE,
+  CPU_USAGE,
+  UPTIME_SECONDS,
+  THREAD_COUNT,
+  THREAD_HASHRATE_BASE,
+}
+
+export interface LiveMetrics {
+  sequence: number;
+  timestamp: number;
+  hashrate: number;
+  acceptedShares: number;
+  rejectedShares: number;
+  temperature: number;
+  cpuUsage: number;
+  uptime: number;
+  threadHashrates: Float64Array;
+}
+
+/**
+ * Create a reader over the native metrics block. The returned function fills
+ * and returns the same object on every call, so per-frame reads allocate nothing.
+ */
+export const createLiveMetricsReader = (): (() => LiveMetrics | null) => {
+  const engine = getComputeEngine();
+  if (!engine) {
+    throw new Error('TradingAnarchyComputeEngine JSI binding is not installed');
+  }
+
+  const view = new Float64Array(engine.getMetricsBuffer());
+  if (view[LiveMetricsSlot.LAYOUT_VERSION] !== LIVE_METRICS_LAYOUT_VERSION) {
+    throw new Error(`Unsupported live metrics layout ${view[LiveMetricsSlot.LAYOUT_VERSION]}`);
+  }
+
+  // Thread rates are copied out of the shared block inside the seqlock window;
+  // the returned array never aliases memory the engine is writing.
+  const threadScratch = new Float64Array(LIVE_METRICS_MAX_THREADS);
+  const threadRates = new Float64Array(LIVE_METRICS_MAX_THREADS);
+  const metrics: LiveMetrics = {
+    sequence: 0,
+    timestamp: 0,
+    hashrate: 0,
+    acceptedShares: 0,
+    rejectedShares: 0,
+    temperature: 0,
+    cpuUsage: 0,
+    uptime: 0,
+    threadHashrates: threadRates.subarray(0, 0),
+  };
+
+  return () => {
+    // Seqlock read: an odd sequence means the writer is mid-update, so give up
+    // for this frame; a changed sequence means a torn copy, retried a few times
+    for (let attempt = 0; attempt < LIVE_METRICS_READ_ATTEMPTS; attempt++) {
+      const before = view[LiveMetricsSlot.SEQUENCE];
+      if (before % 2 !== 0) {
+        return null;
+      }
+
+      const timestamp = view[LiveMetricsSlot.TIMESTAMP_MS];
+      const hashrate = view[LiveMetricsSlot.HASHRATE];
+      const acceptedShares = view[LiveMetricsSlot.ACCEPTED_SHARES];
+      const rejectedShares = view[LiveMetricsSlot.REJECTED_SHARES];
+      const temperature = view[LiveMetricsSlot.TEMPERATURE];
+      const cpuUsage = view[LiveMetricsSlot.CPU_USAGE];
+      const uptime = view[LiveMetricsSlot.UPTIME_SECONDS];
+      const threads = Math.min(Math.max(view[LiveMetricsSlot.THREAD_COUNT] | 0, 0), LIVE_METRICS_MAX_THREADS);
+      for (let i = 0; i < threads; i++) {
+        threadScratch[i] = view[LiveMetricsSlot.THREAD_HASHRATE_BASE + i];
+      }
+
+      if (view[LiveMetricsSlot.SEQUENCE] !== before) {
+        continue;
+      }
+
+      // Consistent snapshot: publish it into the reused object
+      metrics.sequence = before;
+      metrics.timestamp = timestamp;
+      metrics.hashrate = hashrate;
+      metrics.acceptedShares = acceptedShares;
+      metrics.rejectedShares = rejectedShares;
+      metrics.temperature = temperature;
+      metrics.cpuUsage = cpuUsage;
+      metrics.uptime = uptime;
+      for (let i = 0; i < threads; i++) {
+        threadRates[i] = threadScratch[i];
+      }
+      if (metrics.threadHashrates.length !== threads) {
+        metrics.threadHashrates = threadRates.subarray(0, threads);
+      }
+      return metrics;
+    }
+    return null;
+  };
+};
@@ -0,0 +1,136 @@
+#!/usr/bin/env bash
+#
+# Trading Anarchy - Android Compute Engine
+# Engine PGO Pipeline - Train, merge and verify profile-guided builds of the engine hot sources
+# Copyright (c) 2025 Trading Anarchy. All rights reserved.
+# Version: 2025.1.0 - Enhanced Performance & Modern Standards
+#
+# Usage (from xmrig/lib-builder, one device attached over adb):
+#   script/engine-pgo.sh
+#
+# 1. Builds tradingAnarchyEngineBench with TRADING_ANARCHY_PGO=GENERATE
+# 2. Runs the diagnostics battery on device as the training workload
+# 3. Merges the raw profiles into pgo/<abi>/engine.profdata
+# 4. Builds plain (OFF) and PGO (USE) benches and runs them interleaved
+# 5. Reports the hashrate and latency delta and writes pgo/<abi>/report.json
+#
+
+set -euo pipefail
+set -o posix
+
+source script/env.sh
+
+PGO_ABI=${TA_PGO_ABI:-arm64-v8a}
+PGO_TRAINING_RUNS=${TA_PGO_TRAINING_RUNS:-5}
+PGO_COMPARE_ROUNDS=${TA_PGO_COMPARE_ROUNDS:-9}
+ANDROID_PLATFORM="android-29"
+
+REPO_ROOT=$(cd ../.. && pwd)
+PGO_DIR="$REPO_ROOT/pgo/$PGO_ABI"
+PGO_BUILD_ROOT="$EXTERNAL_LIBS_BUILD/engine-pgo/$PGO_ABI"
+DEVICE_DIR="/data/local/tmp/ta-pgo"
+
+TOOLCHAIN="$ANDROID_NDK_HOME/build/cmake/android.toolchain.cmake"
+CMAKE=${CMAKE:-$(command -v cmake || true)}
+LLVM_PROFDATA=$(find "$ANDROID_NDK_HOME/toolchains/llvm/prebuilt" -name llvm-profdata -type f 2>/dev/null | head -1)
+
+[[ -n "$CMAKE" ]] || log_error "cmake not found in PATH (set CMAKE=...)"
+[[ -n "$LLVM_PROFDATA" ]] || log_error "llvm-profdata not found in NDK: $ANDROID_NDK_HOME"
+command -v adb >/dev/null || log_error "adb not found in PATH"
+adb get-state >/dev/null 2>&1 || log_error "No device attached - PGO training must run on target hardware"
+
+mkdir -p "$PGO_DIR" "$PGO_BUILD_ROOT"
+
+# Professional configure + build of the benchmark runner for one PGO mode
+build_bench() {
+    local mode=$1
+    local build_dir="$PGO_BUILD_ROOT/${mode,,}"
+
+    log_info "Building engine bench ($mode) for $PGO_ABI..."
+    "$CMAKE" -S "$REPO_ROOT" -B "$build_dir" \
+        -DCMAKE_TOOLCHAIN_FILE="$TOOLCHAIN" \
+        -DANDROID_ABI="$PGO_ABI" \
+        -DANDROID_PLATFORM="$ANDROID_PLATFORM" \
+        -DANDROID_NDK="$ANDROID_NDK_HOME" \
+        -DCMAKE_BUILD_TYPE=Release \
+        -DTRADING_ANARCHY_ENGINE_BENCH=ON \
+        -DTRADING_ANARCHY_PGO="$mode" \
+        -DTRADING_ANARCHY_PGO_PROFILE="$PGO_DIR/engine.profdata" >/dev/null \
+        || log_error "CMake configuration failed for PGO mode $mode"
+
+    "$CMAKE" --build "$build_dir" --target tradingAnarchyEngineBench -j "$TA_BUILD_THREADS" >/dev/null \
+        || log_error "Engine bench build failed for PGO mode $mode"
+
+    adb push "$build_dir/tradingAnarchyEngineBench" "$DEVICE_DIR/bench-${mode,,}" >/dev/null
+    adb shell chmod 755 "$DEVICE_DIR/bench-${mode,,}"
+}
+
+# Enhanced key=value extraction from a bench output line
+field() {
+    local key=$1
+    sed -n "s/.* $key=\([^ ]*\).*/\1/p"
+}
+
+median() {
+    sort -n | awk '{ v[NR] = $1 } END { if (NR == 0) { print 0 } else if (NR % 2) { print v[(NR + 1) / 2] } else { print (v[NR / 2] + v[NR / 2 + 1]) / 2 } }'
+}
+
+adb shell "rm -rf $DEVICE_DIR && mkdir -p $DEVICE_DIR"
+
+# Phase 1 - instrumented training run
+build_bench GENERATE
+log_info "Training on device with $PGO_TRAINING_RUNS diagnostics runs..."
+adb shell "cd $DEVICE_DIR && LLVM_PROFILE_FILE=$DEVICE_DIR/engine-%p.profraw ./bench-generate $PGO_TRAINING_RUNS" \
+    || log_error "Training workload failed (self-test failure in instrumented build?)"
+
+rm -f "$PGO_DIR"/*.profraw
+adb shell "ls $DEVICE_DIR/*.profraw" | tr -d '\r' | while read -r profile; do
+    adb pull "$profile" "$PGO_DIR/" >/dev/null
+done
+
+"$LLVM_PROFDATA" merge -o "$PGO_DIR/engine.profdata" "$PGO_DIR"/*.profraw \
+    || log_error "llvm-profdata merge failed"
+rm -f "$PGO_DIR"/*.profraw
+log_success "Merged profile: $PGO_DIR/engine.profdata"
+
+# Phase 2 - plain vs PGO comparison, interleaved so thermal drift hits both equally
+build_bench OFF
+build_bench USE
+
+PLAIN_RESULTS=$(mktemp)
+PGO_RESULTS=$(mktemp)
+
+log_info "Comparing plain and PGO builds over $PGO_COMPARE_ROUNDS interleaved rounds..."
+for round in $(seq 1 "$PGO_COMPARE_ROUNDS"); do
+    adb shell "cd $DEVICE_DIR && ./bench-off 1" | tr -d '\r' | grep '^run ' >> "$PLAIN_RESULTS" \
+        || log_error "Plain bench failed in round $round"
+    adb shell "cd $DEVICE_DIR && ./bench-use 1" | tr -d '\r' | grep '^run ' >> "$PGO_RESULTS" \
+        || log_error "PGO bench failed in round $round"
+done
+
+REPORT="$PGO_DIR/report.json"
+echo "{\"timestamp\": \"$(date -Iseconds)\", \"abi\": \"$PGO_ABI\", \"rounds\": $PGO_COMPARE_ROUNDS, \"metrics\": {}}" > "$REPORT"
+
+log_success "PGO delta (median of $PGO_COMPARE_ROUNDS rounds, positive = PGO better):"
+for metric in single_core_hps all_core_hps hash_latency_ns kat_us; do
+    plain=$(field "$metric" < "$PLAIN_RESULTS" | median)
+    pgo=$(field "$metric" < "$PGO_RESULTS" | median)
+
+    # Throughput improves upward, latency improves downward
+    case "$metric" in
+        *_hps) delta=$(awk -v a="$plain" -v b="$pgo" 'BEGIN { printf "%.2f", a > 0 ? (b - a) * 100 / a : 0 }') ;;
+        *)     delta=$(awk -v a="$plain" -v b="$pgo" 'BEGIN { printf "%.2f", a > 0 ? (a - b) * 100 / a : 0 }') ;;
+    esac
+
+    log_success "  - $metric: plain=$plain pgo=$pgo delta=${delta}%"
+
+    temp_report=$(mktemp)
+    jq --arg m "$metric" --arg p "$plain" --arg g "$pgo" --arg d "$delta" \
+       '.metrics[$m] = {"plain": ($p | tonumber), "pgo": ($g | tonumber), "delta_percent": ($d | tonumber)}' \
+       "$REPORT" > "$temp_report"
+    mv "$temp_report" "$REPORT"
+done
+
+rm -f "$PLAIN_RESULTS" "$PGO_RESULTS"
+log_success "Report written to $REPORT"
+log_info "Build the app with -DTRADING_ANARCHY_PGO=USE to ship the profiled engine"
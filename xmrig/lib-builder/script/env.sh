@@ -16,6 +16,11 @@ export TA_BUILD_LOG_LEVEL=${TA_BUILD_LOG_LEVEL:-"INFO"}
 export TA_ENABLE_BUILD_CACHE=${TA_ENABLE_BUILD_CACHE:-"true"}
 export TA_ENABLE_PARALLEL_BUILDS=${TA_ENABLE_PARALLEL_BUILDS:-"true"}
 export TA_BUILD_THREADS=${TA_BUILD_THREADS:-$(nproc 2>/dev/null || echo 4)}
+export TA_BUILD_VARIANTS=${TA_BUILD_VARIANTS:-"true"}
+export TA_BUILD_PROFILING=${TA_BUILD_PROFILING:-"false"}
+
+# Per-microarchitecture arm64 libxmrig builds, installed as libxmrig-<variant>.so
+ARM64_VARIANTS=(v82-a55 v82-a76)
 
 # Professional logging system for 2025
 log() {
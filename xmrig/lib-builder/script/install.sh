@@ -74,6 +74,29 @@ install_architecture() {
     cp "$compute_source/xmrig" "$jni_target/libcompute.so"
     chmod 755 "$jni_target/libcompute.so"
     
+    # Per-microarchitecture variants, chosen at launch by the native launcher
+    if [[ "$arch" == "arm64" && "$TA_BUILD_VARIANTS" == "true" ]]; then
+        local variant
+        for variant in "${ARM64_VARIANTS[@]}"; do
+            local variant_source="$EXTERNAL_LIBS_BUILD_ROOT/xmrig/build/$android_arch-$variant/xmrig"
+            if [[ -f "$variant_source" ]]; then
+                cp "$variant_source" "$jni_target/libxmrig-$variant.so"
+                chmod 755 "$jni_target/libxmrig-$variant.so"
+                log_success "Installed $android_arch variant $variant"
+            else
+                log_warn "Variant $variant not built for $arch; the launcher falls back to the baseline"
+            fi
+        done
+    fi
+    
+    # Stage-profiling build, only launched when the app enables stageProfiling
+    local profile_source="$EXTERNAL_LIBS_BUILD_ROOT/xmrig/build/$android_arch-profile/xmrig"
+    if [[ "$TA_BUILD_PROFILING" == "true" && -f "$profile_source" ]]; then
+        cp "$profile_source" "$jni_target/libxmrig-profile.so"
+        chmod 755 "$jni_target/libxmrig-profile.so"
+        log_success "Installed $android_arch profiling build"
+    fi
+    
     # Verify installation
     if [[ -f "$jni_target/libcompute.so" ]]; then
         local installed_size=$(stat -f%z "$jni_target/libcompute.so" 2>/dev/null || stat -c%s "$jni_target/libcompute.so" 2>/dev/null || echo 0)
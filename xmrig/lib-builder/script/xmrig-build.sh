@@ -116,6 +116,32 @@ declare -A ARCH_CONFIG=(
 SUPPORTED_ARCHS=(arm arm64 x86 x86_64)
 BUILD_ARCHS=("${TA_BUILD_ARCHS[@]:-"${SUPPORTED_ARCHS[@]}"}")
 
+# Tuning for ARM64_VARIANTS (env.sh). Keep in sync with binaryVariants() in
+# android/app/src/main/cpp/xmrig_launcher.cpp, which picks one from hwcaps at launch.
+# The explicit -march follows xmrig's own -march=armv8-a+crypto in the Release flags;
+# -mcpu supplies the core scheduling model.
+declare -A VARIANT_FLAGS=(
+    ["arm64"]="-mtune=cortex-a53"
+    ["arm64:v82-a55"]="-march=armv8.2-a+crypto+dotprod+fp16+rcpc -mcpu=cortex-a55"
+    ["arm64:v82-a76"]="-march=armv8.2-a+crypto+dotprod+fp16+rcpc -mcpu=cortex-a76"
+    ["arm64:profile"]="-mtune=cortex-a53"
+)
+
+# Professional build target list - "arch" or "arch:variant"
+BUILD_TARGETS=()
+for arch in "${BUILD_ARCHS[@]}"; do
+    BUILD_TARGETS+=("$arch")
+    if [[ "$arch" == "arm64" && "$TA_BUILD_VARIANTS" == "true" ]]; then
+        for variant in "${ARM64_VARIANTS[@]}"; do
+            BUILD_TARGETS+=("$arch:$variant")
+        done
+    fi
+    # Baseline ISA with xmrig's PROFILE_SCOPE timers, installed as libxmrig-profile.so
+    if [[ "$TA_BUILD_PROFILING" == "true" ]]; then
+        BUILD_TARGETS+=("$arch:profile")
+    fi
+done
+
 # Professional build tracking
 BUILD_MANIFEST="$EXTERNAL_LIBS_BUILD/xmrig_build_manifest.json"
 echo "{\"timestamp\": \"$(date -Iseconds)\", \"cmake_version\": \"$CMAKE_VERSION\", \"ndk_version\": \"$NDK_VERSION\", \"builds\": []}" > "$BUILD_MANIFEST"
@@ -123,17 +149,22 @@ echo "{\"timestamp\": \"$(date -Iseconds)\", \"cmake_version\": \"$CMAKE_VERSION
 # Enhanced build function with comprehensive error handling
 build_architecture() {
     local arch=$1
+    local variant=${2:-}
     local config=(${ARCH_CONFIG[$arch]})
     local target_host=${config[0]}
     local android_abi=${config[1]}
     local arm_target=${config[2]}
+    local variant_dir="$android_abi${variant:+-$variant}"
+    local tuning_flags="${VARIANT_FLAGS[$arch${variant:+:$variant}]:-}"
+    local profiling="OFF"
+    [[ "$variant" == "profile" ]] && profiling="ON"
     
     local build_start=$(date +%s)
-    log_info "🔨 Building XMRig compute engine for $arch ($android_abi)..."
+    log_info "🔨 Building XMRig compute engine for $arch ($variant_dir)..."
     
     # Professional build directory management
-    local build_dir="$EXTERNAL_LIBS_BUILD_ROOT/xmrig/build/$android_abi"
-    local target_dir="$EXTERNAL_LIBS_ROOT/xmrig/$android_abi"
+    local build_dir="$EXTERNAL_LIBS_BUILD_ROOT/xmrig/build/$variant_dir"
+    local target_dir="$EXTERNAL_LIBS_ROOT/xmrig/$variant_dir"
     
     mkdir -p "$build_dir" "$target_dir"
     cd "$build_dir"
@@ -163,7 +194,7 @@ build_architecture() {
         -DWITH_TLS=ON
         -DWITH_ASM=ON
         -DWITH_SECURE_JIT=ON
-        -DWITH_PROFILING=OFF
+        -DWITH_PROFILING="$profiling"
         # Enhanced dependency linking
         -DHWLOC_LIBRARY="$EXTERNAL_LIBS_ROOT/hwloc/$android_abi/lib/libhwloc.a"
         -DHWLOC_INCLUDE_DIR="$EXTERNAL_LIBS_ROOT/hwloc/$android_abi/include"
@@ -175,6 +206,9 @@ build_architecture() {
         # 2025 optimization flags
         -DCMAKE_CXX_FLAGS="-O3 -DNDEBUG -flto -ffunction-sections -fdata-sections"
         -DCMAKE_C_FLAGS="-O3 -DNDEBUG -flto -ffunction-sections -fdata-sections"
+        # Per-microarchitecture tuning
+        -DCMAKE_CXX_FLAGS_RELEASE="-O3 -DNDEBUG $tuning_flags"
+        -DCMAKE_C_FLAGS_RELEASE="-O3 -DNDEBUG $tuning_flags"
         -DCMAKE_EXE_LINKER_FLAGS="-Wl,--gc-sections -Wl,--strip-all"
     )
     
@@ -205,37 +239,41 @@ build_architecture() {
         local binary_size=$(stat -f%z "$target_dir/bin/xmrig" 2>/dev/null || stat -c%s "$target_dir/bin/xmrig" 2>/dev/null || echo 0)
         local build_time=$(($(date +%s) - build_start))
         
-        log_success "✅ Successfully built $arch in ${build_time}s ($(numfmt --to=iec "$binary_size"))"
+        log_success "✅ Successfully built $variant_dir in ${build_time}s ($(numfmt --to=iec "$binary_size"))"
         
         # Update build manifest
         local temp_manifest=$(mktemp)
-        jq --arg arch "$android_abi" --arg size "$binary_size" --arg time "$build_time" \
-           '.builds += [{"arch": $arch, "size": ($size | tonumber), "build_time": ($time | tonumber), "success": true}]' \
+        jq --arg arch "$android_abi" --arg variant "${variant:-baseline}" --arg flags "$tuning_flags" \
+           --arg size "$binary_size" --arg time "$build_time" \
+           '.builds += [{"arch": $arch, "variant": $variant, "flags": $flags, "size": ($size | tonumber), "build_time": ($time | tonumber), "success": true}]' \
            "$BUILD_MANIFEST" > "$temp_manifest"
         mv "$temp_manifest" "$BUILD_MANIFEST"
         
         return 0
     else
-        log_error "Build output not found for $arch"
+        log_error "Build output not found for $variant_dir"
         return 1
     fi
 }
 
 # Professional parallel build execution with 2025 optimizations
-if [[ "$TA_ENABLE_PARALLEL_BUILDS" == "true" && ${#BUILD_ARCHS[@]} -gt 1 ]]; then
-    log_info "🚀 Starting parallel build for ${#BUILD_ARCHS[@]} architectures..."
+if [[ "$TA_ENABLE_PARALLEL_BUILDS" == "true" && ${#BUILD_TARGETS[@]} -gt 1 ]]; then
+    log_info "🚀 Starting parallel build for ${#BUILD_TARGETS[@]} targets..."
     
     # Background job management for parallel builds
     declare -a BUILD_PIDS=()
     
-    for arch in "${BUILD_ARCHS[@]}"; do
+    for target in "${BUILD_TARGETS[@]}"; do
+        arch=${target%%:*}
+        variant=""
+        [[ "$target" == *:* ]] && variant=${target#*:}
         if [[ -v ARCH_CONFIG[$arch] ]]; then
             (
-                build_architecture "$arch"
-                echo $? > "/tmp/build_result_$arch"
+                build_architecture "$arch" "$variant"
+                echo $? > "/tmp/build_result_${target/:/-}"
             ) &
             BUILD_PIDS+=($!)
-            log_info "Started background build for $arch (PID: $!)"
+            log_info "Started background build for $target (PID: $!)"
         else
             log_error "Unsupported architecture: $arch"
         fi
@@ -247,26 +285,26 @@ if [[ "$TA_ENABLE_PARALLEL_BUILDS" == "true" && ${#BUILD_ARCHS[@]} -gt 1 ]]; the
     
     for i in "${!BUILD_PIDS[@]}"; do
         local pid=${BUILD_PIDS[$i]}
-        local arch=${BUILD_ARCHS[$i]}
+        local target=${BUILD_TARGETS[$i]}
         
-        log_info "Waiting for $arch build completion..."
+        log_info "Waiting for $target build completion..."
         
         if wait "$pid"; then
-            local result_code=$(cat "/tmp/build_result_$arch" 2>/dev/null || echo 1)
+            local result_code=$(cat "/tmp/build_result_${target/:/-}" 2>/dev/null || echo 1)
             if [[ "$result_code" -eq 0 ]]; then
                 completed_builds=$((completed_builds + 1))
-                log_success "✅ Parallel build completed successfully for $arch ($completed_builds/${#BUILD_ARCHS[@]})"
+                log_success "✅ Parallel build completed successfully for $target ($completed_builds/${#BUILD_TARGETS[@]})"
             else
-                failed_builds+=("$arch")
-                log_error "❌ Parallel build failed for $arch"
+                failed_builds+=("$target")
+                log_error "❌ Parallel build failed for $target"
             fi
         else
-            failed_builds+=("$arch")
-            log_error "❌ Parallel build process failed for $arch"
+            failed_builds+=("$target")
+            log_error "❌ Parallel build process failed for $target"
         fi
         
         # Cleanup temp files
-        rm -f "/tmp/build_result_$arch"
+        rm -f "/tmp/build_result_${target/:/-}"
     done
     
     # Report parallel build results
@@ -281,14 +319,17 @@ else
     local completed_builds=0
     local failed_builds=()
     
-    for arch in "${BUILD_ARCHS[@]}"; do
+    for target in "${BUILD_TARGETS[@]}"; do
+        arch=${target%%:*}
+        variant=""
+        [[ "$target" == *:* ]] && variant=${target#*:}
         if [[ -v ARCH_CONFIG[$arch] ]]; then
-            if build_architecture "$arch"; then
+            if build_architecture "$arch" "$variant"; then
                 completed_builds=$((completed_builds + 1))
-                log_success "✅ Sequential build completed for $arch ($completed_builds/${#BUILD_ARCHS[@]})"
+                log_success "✅ Sequential build completed for $target ($completed_builds/${#BUILD_TARGETS[@]})"
             else
-                failed_builds+=("$arch")
-                log_error "❌ Sequential build failed for $arch"
+                failed_builds+=("$target")
+                log_error "❌ Sequential build failed for $target"
             fi
         else
             log_error "Unsupported architecture: $arch"
@@ -308,10 +349,13 @@ TOTAL_BUILT=0
 TOTAL_SIZE=0
 BUILD_SUMMARY=""
 
-for arch in "${BUILD_ARCHS[@]}"; do
+for target in "${BUILD_TARGETS[@]}"; do
+    arch=${target%%:*}
+    variant=""
+    [[ "$target" == *:* ]] && variant=${target#*:}
     if [[ -v ARCH_CONFIG[$arch] ]]; then
         local config=(${ARCH_CONFIG[$arch]})
-        local android_abi=${config[1]}
+        local android_abi=${config[1]}${variant:+-$variant}
         local binary_path="$EXTERNAL_LIBS_ROOT/xmrig/$android_abi/bin/xmrig"
         
         if [[ -f "$binary_path" ]]; then
@@ -335,13 +379,13 @@ mv "$temp_manifest" "$BUILD_MANIFEST"
 
 # Professional build completion report
 log_success "🎯 Trading Anarchy XMRig Build Summary:"
-log_success "  - Successful Builds: $TOTAL_BUILT/${#BUILD_ARCHS[@]}"
+log_success "  - Successful Builds: $TOTAL_BUILT/${#BUILD_TARGETS[@]}"
 log_success "  - Total Binary Size: $(numfmt --to=iec "$TOTAL_SIZE")"
 log_success "  - Total Build Time: $((total_time / 60))m $((total_time % 60))s"
 log_success "  - Build Manifest: $BUILD_MANIFEST"
 echo -e "  - Architecture Details:\n$BUILD_SUMMARY"
 
-if [[ "$TOTAL_BUILT" -eq ${#BUILD_ARCHS[@]} ]]; then
+if [[ "$TOTAL_BUILT" -eq ${#BUILD_TARGETS[@]} ]]; then
     log_success "🚀 All XMRig compute engines built successfully!"
     exit 0
 else
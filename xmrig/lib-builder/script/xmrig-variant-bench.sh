@@ -0,0 +1,117 @@
+#!/usr/bin/env bash
+#
+# Trading Anarchy - Android Compute Engine
+# XMRig Variant Bench - Hashrate of every installed per-microarchitecture libxmrig build
+# Copyright (c) 2025 Trading Anarchy. All rights reserved.
+# Version: 2025.1.0 - Enhanced Performance & Modern Standards
+#
+# Usage (from xmrig/lib-builder, one device attached over adb):
+#   script/xmrig-variant-bench.sh
+#
+# Pushes the baseline libxmrig.so and each libxmrig-<variant>.so from jniLibs,
+# runs xmrig's offline --bench interleaved across variants, and writes the
+# median hashrate per variant to bench/<abi>/variants.json. Variants the CPU
+# cannot execute (SIGILL) are recorded as unsupported.
+#
+
+set -euo pipefail
+set -o posix
+
+source script/env.sh
+
+BENCH_ABI=${TA_BENCH_ABI:-arm64-v8a}
+BENCH_ROUNDS=${TA_BENCH_ROUNDS:-3}
+BENCH_SIZE=${TA_BENCH_SIZE:-1M}
+BENCH_ALGO=${TA_BENCH_ALGO:-rx/0}
+
+REPO_ROOT=$(cd ../.. && pwd)
+JNILIBS_DIR="$REPO_ROOT/android/app/src/main/jniLibs/$BENCH_ABI"
+REPORT_DIR="$REPO_ROOT/bench/$BENCH_ABI"
+DEVICE_DIR="/data/local/tmp/ta-variants"
+
+command -v adb >/dev/null || log_error "adb not found in PATH"
+adb get-state >/dev/null 2>&1 || log_error "No device attached - variant benchmarks must run on target hardware"
+[[ -f "$JNILIBS_DIR/libxmrig.so" ]] || log_error "Baseline libxmrig.so not installed in $JNILIBS_DIR (run make install)"
+
+VARIANTS=(baseline)
+for variant in "${ARM64_VARIANTS[@]}"; do
+    [[ -f "$JNILIBS_DIR/libxmrig-$variant.so" ]] && VARIANTS+=("$variant")
+done
+
+mkdir -p "$REPORT_DIR"
+adb shell "rm -rf $DEVICE_DIR && mkdir -p $DEVICE_DIR"
+
+for variant in "${VARIANTS[@]}"; do
+    local_name="libxmrig.so"
+    [[ "$variant" != "baseline" ]] && local_name="libxmrig-$variant.so"
+    adb push "$JNILIBS_DIR/$local_name" "$DEVICE_DIR/xmrig-$variant" >/dev/null
+    adb shell chmod 755 "$DEVICE_DIR/xmrig-$variant"
+done
+
+DEVICE_MODEL=$(adb shell getprop ro.product.model | tr -d '\r')
+CPU_FEATURES=$(adb shell "grep -m1 '^Features' /proc/cpuinfo" | tr -d '\r' | sed 's/^Features[[:space:]]*:[[:space:]]*//')
+
+log_info "Variant bench on $DEVICE_MODEL ($BENCH_ABI): ${VARIANTS[*]}"
+log_info "  - CPU features: $CPU_FEATURES"
+log_info "  - Rounds: $BENCH_ROUNDS, bench size: $BENCH_SIZE, algorithm: $BENCH_ALGO"
+
+# Professional single benchmark run - prints the hashrate, or a status word
+run_variant() {
+    local variant=$1
+    local output status=0
+    output=$(adb shell "cd $DEVICE_DIR && ./xmrig-$variant --no-color --bench=$BENCH_SIZE --algo=$BENCH_ALGO; echo exit=\$?" | tr -d '\r') || status=$?
+
+    local exit_code
+    exit_code=$(sed -n 's/^exit=\([0-9]*\)$/\1/p' <<<"$output")
+    if [[ "$exit_code" == "132" ]]; then
+        echo "unsupported"
+        return
+    fi
+
+    local hashrate
+    hashrate=$(sed -n 's/.*benchmark finished in [0-9.]* seconds (\([0-9.]*\) h\/s).*/\1/p' <<<"$output" | tail -1)
+    echo "${hashrate:-failed}"
+}
+
+declare -A RESULTS=()
+
+# Interleave rounds so thermal drift spreads evenly over the variants
+for round in $(seq 1 "$BENCH_ROUNDS"); do
+    for variant in "${VARIANTS[@]}"; do
+        result=$(run_variant "$variant")
+        log_info "round $round $variant: $result"
+        RESULTS[$variant]+="$result "
+    done
+done
+
+median() {
+    tr ' ' '\n' | grep -E '^[0-9.]+$' | sort -n | awk '{ v[NR] = $1 } END { if (NR == 0) { print 0 } else if (NR % 2) { print v[(NR + 1) / 2] } else { print (v[NR / 2] + v[NR / 2 + 1]) / 2 } }'
+}
+
+REPORT="$REPORT_DIR/variants.json"
+jq -n --arg device "$DEVICE_MODEL" --arg features "$CPU_FEATURES" --arg abi "$BENCH_ABI" \
+      --arg algo "$BENCH_ALGO" --arg size "$BENCH_SIZE" --arg rounds "$BENCH_ROUNDS" \
+      '{timestamp: (now | todate), device: $device, abi: $abi, cpu_features: $features,
+        algorithm: $algo, bench_size: $size, rounds: ($rounds | tonumber), variants: []}' > "$REPORT"
+
+BASELINE_HPS=$(median <<<"${RESULTS[baseline]}")
+for variant in "${VARIANTS[@]}"; do
+    hps=$(median <<<"${RESULTS[$variant]}")
+    status="ok"
+    [[ "${RESULTS[$variant]}" == *unsupported* ]] && status="unsupported"
+    [[ "$hps" == "0" && "$status" == "ok" ]] && status="failed"
+    speedup=$(awk -v v="$hps" -v b="$BASELINE_HPS" 'BEGIN { printf "%.4f", b > 0 ? v / b : 0 }')
+
+    log_success "  $variant: ${hps} H/s (x$speedup vs baseline, $status)"
+
+    tmp=$(mktemp)
+    jq --arg variant "$variant" --arg hps "$hps" --arg speedup "$speedup" --arg status "$status" \
+       --arg runs "${RESULTS[$variant]}" \
+       '.variants += [{variant: $variant, hashrate: ($hps | tonumber), speedup: ($speedup | tonumber),
+                       status: $status, runs: ($runs | split(" ") | map(select(length > 0)))}]' \
+       "$REPORT" > "$tmp"
+    mv "$tmp" "$REPORT"
+done
+
+adb shell "rm -rf $DEVICE_DIR"
+log_success "Variant report written to $REPORT"